@@ -41,6 +41,7 @@ list (APPEND MAIN_SOURCE_FILES
       src/opm/common/utility/parameters/ParameterGroup.cpp
       src/opm/common/utility/parameters/ParameterRequirement.cpp
       src/opm/common/utility/parameters/ParameterTools.cpp
+      src/opm/common/utility/ScopedTimer.cpp
       src/opm/common/utility/numeric/calculateCellVol.cpp
       src/opm/common/utility/numeric/RootFinders.cpp
       src/opm/common/utility/shmatch.cpp
@@ -446,11 +447,13 @@ list (APPEND TEST_SOURCE_FILES
       tests/test_cubic.cpp
       tests/test_EvaluationFormat.cpp
       tests/test_densead.cpp
+      tests/test_densead_simd.cpp
       tests/test_messagelimiter.cpp
       tests/test_nonuniformtablelinear.cpp
       tests/test_OpmInputError_format.cpp
       tests/test_OpmLog.cpp
       tests/test_param.cpp
+      tests/test_PersistentMap.cpp
       tests/test_RootFinders.cpp
       tests/test_SegmentMatcher.cpp
       tests/test_sparsevector.cpp
@@ -493,6 +496,7 @@ if(ENABLE_ECL_INPUT)
     tests/test_ExtESmry.cpp
     tests/test_PAvgCalculator.cpp
     tests/test_PAvgDynamicSourceData.cpp
+    tests/test_ScopedTimer.cpp
     tests/test_Serialization.cpp
     tests/material/test_co2brinepvt.cpp
     tests/material/test_h2brinepvt.cpp
@@ -703,6 +707,8 @@ if(ENABLE_ECL_OUTPUT)
 endif()
 
 list (APPEND EXAMPLE_SOURCE_FILES
+  examples/csrgraphbench.cpp
+  examples/tabulated1dbench.cpp
 )
 if(ENABLE_ECL_INPUT)
   list (APPEND TEST_DATA_FILES
@@ -742,6 +748,8 @@ if(ENABLE_ECL_INPUT)
     examples/wellgraph.cpp
     examples/make_ext_smry.cpp
     examples/co2brinepvt.cpp
+    examples/materiallawinitbench.cpp
+    examples/materialbench.cpp
   )
 endif()
 
@@ -793,6 +801,8 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/numeric/SparseVector.hpp
       opm/common/utility/numeric/UniformTableLinear.hpp
       opm/common/utility/OpmInputError.hpp
+      opm/common/utility/ParallelFor.hpp
+      opm/common/utility/PersistentMap.hpp
       opm/common/utility/parameters/ParameterGroup.hpp
       opm/common/utility/parameters/ParameterGroup_impl.hpp
       opm/common/utility/parameters/Parameter.hpp
@@ -802,6 +812,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/parameters/ParameterTools.hpp
       opm/common/utility/platform_dependent/disable_warnings.h
       opm/common/utility/platform_dependent/reenable_warnings.h
+      opm/common/utility/ScopedTimer.hpp
       opm/common/utility/shmatch.hpp
       opm/common/utility/Serializer.hpp
       opm/common/utility/String.hpp
@@ -889,7 +900,9 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/fluidsystems/blackoilpvt/WaterPvtMultiplexer.hpp
       opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp
       opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.hpp
+      opm/material/fluidsystems/blackoilpvt/BrineGasTables.hpp
       opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp
+      opm/material/fluidsystems/blackoilpvt/PvtBatch.hpp
       opm/material/fluidsystems/blackoilpvt/GasPvtMultiplexer.hpp
       opm/material/fluidsystems/blackoilpvt/DryHumidGasPvt.hpp
       opm/material/fluidsystems/blackoilpvt/WetGasPvt.hpp
@@ -969,6 +982,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/common/ResetLocale.hpp
       opm/material/common/HasMemberGeneratorMacros.hpp
       opm/material/common/UniformTabulated2DFunction.hpp
+      opm/material/common/HermiteTabulated2DFunction.hpp
       opm/material/common/FastSmallVector.hpp
       opm/material/common/ConditionalStorage.hpp
       opm/material/common/Means.hpp
@@ -984,6 +998,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/densead/Evaluation11.hpp
       opm/material/densead/DynamicEvaluation.hpp
       opm/material/densead/Math.hpp
+      opm/material/densead/SimdPack.hpp
       opm/material/densead/Evaluation1.hpp
       opm/material/densead/Evaluation12.hpp
       opm/material/densead/Evaluation2.hpp
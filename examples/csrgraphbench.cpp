@@ -0,0 +1,189 @@
+/*
+  Copyright 2024 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*!
+ * \file
+ *
+ * \brief Benchmark for building CSRGraphFromCoordinates.
+ *
+ * Generates the vertex pairs of all neighbouring cells in a Cartesian
+ * nx-by-ny-by-nz grid, mapped through three different vertex assignments:
+ * a few layered regions, areal-by-layer blocks like a typical FIPNUM
+ * array, and the cells themselves.  The first two resemble inter-region
+ * flow graphs with many repeated pairs, the last one a connection graph
+ * with few repetitions.  Reports the time spent compressing the graph
+ * with one thread and with all available threads, and verifies that the
+ * resulting structures and compressed index maps are identical.
+ */
+#include "config.h"
+
+#include <opm/common/utility/CSRGraphFromCoordinates.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+using Graph = Opm::utility::CSRGraphFromCoordinates<int, true>;
+
+struct Distribution
+{
+    std::string name;
+    std::function<int(std::size_t i, std::size_t j, std::size_t k)> vertex;
+};
+
+struct Pairs
+{
+    int numVertices{0};
+    std::vector<int> v1{};
+    std::vector<int> v2{};
+};
+
+Pairs neighbourPairs(const std::size_t nx, const std::size_t ny, const std::size_t nz,
+                     const Distribution& distribution)
+{
+    Pairs pairs;
+
+    const auto add = [&pairs, &distribution](const std::size_t i1, const std::size_t j1, const std::size_t k1,
+                                             const std::size_t i2, const std::size_t j2, const std::size_t k2)
+    {
+        const auto r1 = distribution.vertex(i1, j1, k1);
+        const auto r2 = distribution.vertex(i2, j2, k2);
+        if (r1 == r2) {
+            return;
+        }
+
+        // Both directions, like InterRegFlowMap.
+        pairs.v1.push_back(r1);  pairs.v2.push_back(r2);
+        pairs.v1.push_back(r2);  pairs.v2.push_back(r1);
+        pairs.numVertices = std::max({pairs.numVertices, r1 + 1, r2 + 1});
+    };
+
+    for (std::size_t k = 0; k < nz; ++k) {
+        for (std::size_t j = 0; j < ny; ++j) {
+            for (std::size_t i = 0; i < nx; ++i) {
+                if (i + 1 < nx) { add(i, j, k, i + 1, j, k); }
+                if (j + 1 < ny) { add(i, j, k, i, j + 1, k); }
+                if (k + 1 < nz) { add(i, j, k, i, j, k + 1); }
+            }
+        }
+    }
+
+    return pairs;
+}
+
+Graph build(const Pairs& pairs, const int numThreads, double& seconds)
+{
+#ifdef _OPENMP
+    omp_set_num_threads(numThreads);
+#else
+    static_cast<void>(numThreads);
+#endif
+
+    Graph graph;
+    for (std::size_t n = 0; n < pairs.v1.size(); ++n) {
+        graph.addConnection(pairs.v1[n], pairs.v2[n]);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    graph.compress(pairs.numVertices);
+    const auto stop = std::chrono::steady_clock::now();
+
+    seconds = std::chrono::duration<double>(stop - start).count();
+    return graph;
+}
+
+bool identical(const Graph& g1, const Graph& g2)
+{
+    return (g1.startPointers() == g2.startPointers())
+        && (g1.columnIndices() == g2.columnIndices())
+        && (g1.compressedIndexMap() == g2.compressedIndexMap());
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t nx = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 200;
+    const std::size_t ny = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 200;
+    const std::size_t nz = (argc > 3) ? std::strtoul(argv[3], nullptr, 10) : 50;
+
+    int maxThreads = 1;
+#ifdef _OPENMP
+    maxThreads = omp_get_max_threads();
+#endif
+
+    const auto layersPerRegion = std::max(nz / 5, std::size_t{1});
+    const auto blockX = std::max(nx / 10, std::size_t{1});
+    const auto blockY = std::max(ny / 10, std::size_t{1});
+    const auto numBlocksX = (nx + blockX - 1) / blockX;
+    const auto numBlocksY = (ny + blockY - 1) / blockY;
+
+    const std::vector<Distribution> distributions = {
+        {"layered regions", [layersPerRegion](std::size_t, std::size_t, std::size_t k)
+         { return static_cast<int>(k / layersPerRegion); }},
+
+        {"areal blocks", [=](std::size_t i, std::size_t j, std::size_t k)
+         { return static_cast<int>(((k / layersPerRegion)*numBlocksY + j / blockY)*numBlocksX + i / blockX); }},
+
+        {"cells", [nx, ny](std::size_t i, std::size_t j, std::size_t k)
+         { return static_cast<int>((k*ny + j)*nx + i); }},
+    };
+
+    std::cout << "Cells: " << nx*ny*nz << ", threads: " << maxThreads << "\n"
+              << std::left << std::setw(18) << "Vertices" << std::right
+              << std::setw(12) << "pairs"
+              << std::setw(12) << "edges"
+              << std::setw(12) << "serial [s]"
+              << std::setw(14) << "parallel [s]"
+              << std::setw(11) << "identical" << '\n';
+
+    bool allIdentical = true;
+    for (const auto& distribution : distributions) {
+        const auto pairs = neighbourPairs(nx, ny, nz, distribution);
+
+        double serialSeconds = 0.0;
+        double parallelSeconds = 0.0;
+        const auto serial = build(pairs, 1, serialSeconds);
+        const auto parallel = build(pairs, maxThreads, parallelSeconds);
+
+        const auto same = identical(serial, parallel);
+        allIdentical = allIdentical && same;
+
+        std::cout << std::left << std::setw(18) << distribution.name << std::right << std::fixed
+                  << std::setprecision(3)
+                  << std::setw(12) << pairs.v1.size()
+                  << std::setw(12) << serial.numEdges()
+                  << std::setw(12) << serialSeconds
+                  << std::setw(14) << parallelSeconds
+                  << std::setw(11) << (same ? "yes" : "NO") << '\n';
+    }
+
+    return allIdentical ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,626 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Micro-benchmark for the per-cell hot paths of the material library.
+ *
+ * The benchmark sets up an SPE1-like three-phase model with live oil (PVTO),
+ * wet gas (PVTG) and SWOF/SGOF saturation functions with end-point scaling and
+ * hysteresis, a CO2-brine system and a three-component PT flash. The PVT and
+ * saturation function evaluations are timed for evaluations with 1 to 12
+ * derivatives and the results are reported in nanoseconds per cell, so the
+ * effect of changes to the tabulated functions, the PVT multiplexers and the
+ * material laws can be compared between commits.
+ *
+ * Usage: materialbench [numCells [numRepetitions [numDerivatives ...]]]
+ *
+ * For each operation the fastest of the repetitions is reported.
+ */
+#include "config.h"
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+
+#include <opm/material/constraintsolvers/PTFlash.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
+#include <opm/material/fluidstates/CompositionalFluidState.hpp>
+#include <opm/material/fluidstates/SimpleModularFluidState.hpp>
+#include <opm/material/fluidsystems/ThreeComponentFluidSystem.hh>
+#include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/Co2GasPvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/GasPvtMultiplexer.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/PvtBatch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr int maxNumDerivatives = 12;
+
+using MaterialTraits = Opm::ThreePhaseMaterialTraits<double,
+                                                     /*wettingPhaseIdx=*/0,
+                                                     /*nonWettingPhaseIdx=*/1,
+                                                     /*gasPhaseIdx=*/2>;
+using MaterialLawManager = Opm::EclMaterialLawManager<MaterialTraits>;
+using MaterialLaw = MaterialLawManager::MaterialLaw;
+
+template <class Scalar>
+using SaturationState = Opm::SimpleModularFluidState<Scalar,
+                                                     /*numPhases=*/3,
+                                                     /*numComponents=*/0,
+                                                     /*FluidSystem=*/void,
+                                                     /*storePressure=*/false,
+                                                     /*storeTemperature=*/false,
+                                                     /*storeComposition=*/false,
+                                                     /*storeFugacity=*/false,
+                                                     /*storeSaturation=*/true,
+                                                     /*storeDensity=*/false,
+                                                     /*storeViscosity=*/false,
+                                                     /*storeEnthalpy=*/false>;
+
+std::string deckString(const std::size_t numCells)
+{
+    const std::string n = std::to_string(numCells);
+    const std::size_t half = numCells / 2;
+
+    return
+        "RUNSPEC\n"
+        "DIMENS\n " + n + " 1 1 /\n"
+        "TABDIMS\n/\n"
+        "OIL\nGAS\nWATER\n"
+        "DISGAS\nVAPOIL\n"
+        "FIELD\n"
+        "ENDSCALE\n/\n"
+        "SATOPTS\nHYSTER /\n"
+        "GRID\n"
+        "DX\n " + n + "*1000 /\n"
+        "DY\n " + n + "*1000 /\n"
+        "DZ\n " + n + "*20 /\n"
+        "TOPS\n " + n + "*8325 /\n"
+        "PORO\n " + n + "*0.3 /\n"
+        "PERMX\n " + n + "*500 /\n"
+        "PERMY\n " + n + "*500 /\n"
+        "PERMZ\n " + n + "*50 /\n"
+        "PROPS\n"
+        "EHYSTR\n 0.1 0 0.1 1* BOTH /\n"
+        "DENSITY\n 53.66 64.49 0.0533 /\n"
+        "PVTW\n 4017.55 1.038 3.22E-6 0.318 0.0 /\n"
+        "PVTO\n"
+        "  0.0010    14.7   1.0620  1.0400 /\n"
+        "  0.0905   264.7   1.1500  0.9750 /\n"
+        "  0.1800   514.7   1.2070  0.9100 /\n"
+        "  0.3710  1014.7   1.2950  0.8300 /\n"
+        "  0.6360  2014.7   1.4350  0.6950 /\n"
+        "  0.7750  2514.7   1.5000  0.6410 /\n"
+        "  0.9300  3014.7   1.5650  0.5940 /\n"
+        "  1.2700  4014.7   1.6950  0.5100\n"
+        "          9014.7   1.5790  0.7400 /\n"
+        "  1.6180  5014.7   1.8270  0.4490\n"
+        "          9014.7   1.7370  0.6310 /\n"
+        "/\n"
+        "PVTG\n"
+        "    14.7  0.00010  166.666  0.0080\n"
+        "          0.0      170.0    0.0079 /\n"
+        "  1014.7  0.00050    2.5    0.0125\n"
+        "          0.0        2.52   0.0123 /\n"
+        "  4014.7  0.00200    0.7    0.0250\n"
+        "          0.0        0.71   0.0240 /\n"
+        "  9014.7  0.00400    0.39   0.0470\n"
+        "          0.0        0.40   0.0450 /\n"
+        "/\n"
+        "SWOF\n"
+        "  0.12  0.0     1.0    4.0\n"
+        "  0.20  0.002   0.85   2.5\n"
+        "  0.30  0.02    0.60   1.5\n"
+        "  0.40  0.06    0.38   1.0\n"
+        "  0.50  0.12    0.21   0.6\n"
+        "  0.60  0.21    0.09   0.35\n"
+        "  0.70  0.33    0.03   0.2\n"
+        "  0.80  0.50    0.005  0.1\n"
+        "  1.00  1.0     0.0    0.0 /\n"
+        "SGOF\n"
+        "  0.00  0.0     1.0    0.0\n"
+        "  0.05  0.005   0.88   0.0\n"
+        "  0.12  0.025   0.70   0.1\n"
+        "  0.20  0.075   0.35   0.2\n"
+        "  0.30  0.19    0.09   0.3\n"
+        "  0.40  0.41    0.021  0.4\n"
+        "  0.50  0.72    0.001  0.5\n"
+        "  0.70  0.94    0.0    0.6\n"
+        "  0.88  0.984   0.0    0.7 /\n"
+        "SWL\n " + std::to_string(half) + "*0.12 " + std::to_string(numCells - half) + "*0.15 /\n"
+        "SWCR\n " + std::to_string(half) + "*0.15 " + std::to_string(numCells - half) + "*0.2 /\n"
+        "SGU\n " + n + "*0.85 /\n";
+}
+
+std::vector<int> intFieldProp(const Opm::FieldPropsManager& fieldProps,
+                              const std::string& keyword,
+                              const unsigned int numElems,
+                              bool needsTranslation)
+{
+    std::vector<int> dest(numElems);
+    const auto& data = fieldProps.get_int(keyword);
+    for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
+        dest[elemIdx] = data[elemIdx] - needsTranslation;
+    }
+    return dest;
+}
+
+template <class Evaluation>
+double checksumOf(const Evaluation& value)
+{ return value.value() + value.derivative(0); }
+
+/*!
+ * \brief Time run() and return the fastest repetition in nanoseconds per cell.
+ *
+ * prepare() is called before each repetition and is not timed. run() processes
+ * all cells and returns a checksum of the results.
+ */
+template <class Prepare, class Run>
+double nanosecondsPerBatch(const std::size_t numCells,
+                           const unsigned numRepetitions,
+                           double& checksum,
+                           Prepare&& prepare,
+                           Run&& run)
+{
+    double best = std::numeric_limits<double>::max();
+    for (unsigned repIdx = 0; repIdx < numRepetitions; ++repIdx) {
+        prepare();
+
+        const auto start = std::chrono::steady_clock::now();
+        checksum += run();
+        const auto stop = std::chrono::steady_clock::now();
+
+        best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count());
+    }
+    return best / numCells;
+}
+
+/*!
+ * \brief Time kernel(cellIdx) for all cells and return the fastest repetition in
+ *        nanoseconds per cell.
+ */
+template <class Prepare, class Kernel>
+double nanosecondsPerCell(const std::size_t numCells,
+                          const unsigned numRepetitions,
+                          double& checksum,
+                          Prepare&& prepare,
+                          Kernel&& kernel)
+{
+    return nanosecondsPerBatch(numCells, numRepetitions, checksum,
+                               std::forward<Prepare>(prepare),
+                               [numCells, &kernel]() {
+                                   double sum = 0.0;
+                                   for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+                                       sum += kernel(cellIdx);
+                                   }
+                                   return sum;
+                               });
+}
+
+template <class Kernel>
+double nanosecondsPerCell(const std::size_t numCells,
+                          const unsigned numRepetitions,
+                          double& checksum,
+                          Kernel&& kernel)
+{
+    return nanosecondsPerCell(numCells, numRepetitions, checksum, []() {},
+                              std::forward<Kernel>(kernel));
+}
+
+/*!
+ * \brief The fluid systems and per-cell parameters shared by all evaluation sizes.
+ */
+struct Setup
+{
+    Setup(const std::size_t numCellsIn)
+        : numCells(numCellsIn)
+        , python(std::make_shared<Opm::Python>())
+        , deck(Opm::Parser().parseString(deckString(numCells)))
+        , eclState(deck)
+        , schedule(deck, eclState, python)
+        , co2Salinity({0.1})
+        , brineCo2(co2Salinity)
+        , co2Gas(co2Salinity)
+    {
+        oilPvt.initFromState(eclState, schedule);
+        gasPvt.initFromState(eclState, schedule);
+
+        materialLawManager.initFromState(eclState);
+        materialLawManager.initParamsForElements(eclState, numCells, &intFieldProp,
+                                                 [](unsigned elemIdx) { return elemIdx; });
+
+        tabulatedBrineCo2 = brineCo2;
+        tabulatedBrineCo2.setTabulation(Opm::BrineGasTabulationParams<double>{});
+
+        regionIdx.assign(numCells, 0);
+        temperature.resize(numCells);
+        pressure.resize(numCells);
+        undersaturation.resize(numCells);
+        waterSaturation.resize(numCells);
+        gasSaturation.resize(numCells);
+
+        // a deterministic spread of states: pressures between 50 and 300 bar,
+        // partially undersaturated oil and gas and saturations which cover the
+        // mobile range of the saturation functions
+        SaturationState<double> drainageState;
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            const double xi = static_cast<double>((cellIdx*7919) % numCells) / numCells;
+            temperature[cellIdx] = 273.15 + 40.0 + 60.0*xi;
+            pressure[cellIdx] = 50e5 + 250e5*xi;
+            undersaturation[cellIdx] = 0.6 + 0.4*(1.0 - xi);
+            waterSaturation[cellIdx] = 0.25 + 0.5*xi;
+            gasSaturation[cellIdx] = 0.5*(1.0 - waterSaturation[cellIdx])*(1.0 - xi);
+
+            // move the hysteresis turning points away from the drainage curves
+            drainageState.setSaturation(0, waterSaturation[cellIdx] - 0.1);
+            drainageState.setSaturation(2, gasSaturation[cellIdx] + 0.05);
+            drainageState.setSaturation(1, 1.0 - waterSaturation[cellIdx] - gasSaturation[cellIdx] + 0.05);
+            materialLawManager.updateHysteresis(drainageState, cellIdx);
+        }
+    }
+
+    std::size_t numCells;
+
+    std::shared_ptr<Opm::Python> python;
+    Opm::Deck deck;
+    Opm::EclipseState eclState;
+    Opm::Schedule schedule;
+
+    Opm::OilPvtMultiplexer<double> oilPvt;
+    Opm::GasPvtMultiplexer<double> gasPvt;
+    MaterialLawManager materialLawManager;
+
+    std::vector<double> co2Salinity;
+    Opm::BrineCo2Pvt<double> brineCo2;
+    Opm::BrineCo2Pvt<double> tabulatedBrineCo2;
+    Opm::Co2GasPvt<double> co2Gas;
+
+    std::vector<unsigned> regionIdx;
+    std::vector<double> temperature;
+    std::vector<double> pressure;
+    std::vector<double> undersaturation;
+    std::vector<double> waterSaturation;
+    std::vector<double> gasSaturation;
+};
+
+using Results = std::map<std::string, std::map<int, double>>;
+
+template <int numDerivatives>
+void benchmarkBlackOil(const Setup& setup, const unsigned numRepetitions,
+                       Results& results, std::vector<std::string>& operations,
+                       double& checksum)
+{
+    using Evaluation = Opm::DenseAd::Evaluation<double, numDerivatives>;
+    const std::size_t numCells = setup.numCells;
+
+    const auto record = [&](const std::string& name, double ns) {
+        if (results.count(name) == 0)
+            operations.push_back(name);
+        results[name][numDerivatives] = ns;
+    };
+
+    // the primary variables: pressure, water saturation and gas saturation or
+    // mixing ratio, as in the black-oil model
+    constexpr int swIdx = std::min(1, numDerivatives - 1);
+    constexpr int sgIdx = std::min(2, numDerivatives - 1);
+    std::vector<Evaluation> T(numCells), p(numCells), Rs(numCells), Rv(numCells), Rvw(numCells, 0.0);
+    std::vector<SaturationState<Evaluation>> saturations(numCells);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        T[cellIdx] = setup.temperature[cellIdx];
+        p[cellIdx] = Evaluation::createVariable(setup.pressure[cellIdx], 0);
+        Rs[cellIdx] = setup.oilPvt.saturatedGasDissolutionFactor(0, setup.temperature[cellIdx],
+                                                                 setup.pressure[cellIdx])
+            * Evaluation::createVariable(setup.undersaturation[cellIdx], sgIdx);
+        Rv[cellIdx] = setup.gasPvt.saturatedOilVaporizationFactor(0, setup.temperature[cellIdx],
+                                                                  setup.pressure[cellIdx])
+            * Evaluation::createVariable(setup.undersaturation[cellIdx], sgIdx);
+
+        const Evaluation Sw = Evaluation::createVariable(setup.waterSaturation[cellIdx], swIdx);
+        const Evaluation Sg = Evaluation::createVariable(setup.gasSaturation[cellIdx], sgIdx);
+        saturations[cellIdx].setSaturation(0, Sw);
+        saturations[cellIdx].setSaturation(1, 1.0 - Sw - Sg);
+        saturations[cellIdx].setSaturation(2, Sg);
+    }
+
+    const auto& oilPvt = setup.oilPvt;
+    const auto& gasPvt = setup.gasPvt;
+    const auto& manager = setup.materialLawManager;
+
+    record("oil Rs_sat (PVTO)",
+           nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+               return checksumOf(oilPvt.saturatedGasDissolutionFactor(0, T[i], p[i]));
+           }));
+    record("oil 1/B (PVTO)",
+           nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+               return checksumOf(oilPvt.inverseFormationVolumeFactor(0, T[i], p[i], Rs[i]));
+           }));
+    record("oil mu (PVTO)",
+           nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+               return checksumOf(oilPvt.viscosity(0, T[i], p[i], Rs[i]));
+           }));
+    record("gas Rv_sat (PVTG)",
+           nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+               return checksumOf(gasPvt.saturatedOilVaporizationFactor(0, T[i], p[i]));
+           }));
+    record("gas 1/B (PVTG)",
+           nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+               return checksumOf(gasPvt.inverseFormationVolumeFactor(0, T[i], p[i], Rv[i], Rvw[i]));
+           }));
+    record("gas mu (PVTG)",
+           nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+               return checksumOf(gasPvt.viscosity(0, T[i], p[i], Rv[i], Rvw[i]));
+           }));
+
+    // the same, but with the PVT approach dispatched once for all cells
+    double ns = 0.0;
+    oilPvt.visit([&](const auto& pvt) {
+        ns = nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+            return checksumOf(pvt.inverseFormationVolumeFactor(0, T[i], p[i], Rs[i]));
+        });
+    });
+    record("oil 1/B (PVTO, visited)", ns);
+    gasPvt.visit([&](const auto& pvt) {
+        ns = nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+            return checksumOf(pvt.inverseFormationVolumeFactor(0, T[i], p[i], Rv[i], Rvw[i]));
+        });
+    });
+    record("gas 1/B (PVTG, visited)", ns);
+
+    // the batched interface computes 1/B, mu and the saturated mixing ratio at once
+    std::vector<Evaluation> invB(numCells), mu(numCells), RSat(numCells);
+    const Opm::PvtBatchOutput<Evaluation> batchOutput{invB.data(), mu.data(), RSat.data()};
+    const Opm::PvtBatchInput<Evaluation> oilInput{numCells, setup.regionIdx.data(), T.data(),
+                                                  p.data(), Rs.data(), nullptr};
+    const Opm::PvtBatchInput<Evaluation> gasInput{numCells, setup.regionIdx.data(), T.data(),
+                                                  p.data(), Rv.data(), Rvw.data()};
+    const auto batchChecksum = [&]() {
+        double sum = 0.0;
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            sum += checksumOf(invB[cellIdx]) + checksumOf(mu[cellIdx]) + checksumOf(RSat[cellIdx]);
+        }
+        return sum;
+    };
+    record("oil batch 1/B+mu+Rs_sat",
+           nanosecondsPerBatch(numCells, numRepetitions, checksum, []() {}, [&]() {
+               oilPvt.evaluateBatch(oilInput, batchOutput);
+               return batchChecksum();
+           }));
+    record("gas batch 1/B+mu+Rv_sat",
+           nanosecondsPerBatch(numCells, numRepetitions, checksum, []() {}, [&]() {
+               gasPvt.evaluateBatch(gasInput, batchOutput);
+               return batchChecksum();
+           }));
+
+    record("kr (SWOF/SGOF, EPS, hyst.)",
+           nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+               std::array<Evaluation, 3> kr;
+               MaterialLaw::relativePermeabilities(kr, manager.materialLawParams(i), saturations[i]);
+               return checksumOf(kr[0]) + checksumOf(kr[1]) + checksumOf(kr[2]);
+           }));
+    record("pc (SWOF/SGOF, EPS, hyst.)",
+           nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+               std::array<Evaluation, 3> pc;
+               MaterialLaw::capillaryPressures(pc, manager.materialLawParams(i), saturations[i]);
+               return checksumOf(pc[0]) + checksumOf(pc[2]);
+           }));
+
+    MaterialLaw::visit(manager.threePhaseApproach(), [&](auto law) {
+        ns = nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+            std::array<Evaluation, 3> kr;
+            law.relativePermeabilities(kr, manager.materialLawParams(i), saturations[i]);
+            return checksumOf(kr[0]) + checksumOf(kr[1]) + checksumOf(kr[2]);
+        });
+    });
+    record("kr (SWOF/SGOF, EPS, hyst., visited)", ns);
+
+    // CO2-brine, with the analytic correlations and with the tabulated properties
+    std::vector<Evaluation> co2Rs(numCells);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        co2Rs[cellIdx] = setup.brineCo2.saturatedGasDissolutionFactor(0, T[cellIdx], p[cellIdx])
+            * Evaluation::createVariable(setup.undersaturation[cellIdx], sgIdx);
+    }
+    for (const auto* pvt : {&setup.brineCo2, &setup.tabulatedBrineCo2}) {
+        const std::string suffix = (pvt == &setup.brineCo2) ? "" : " (tab.)";
+        record("brine Rs_sat (CO2STORE)" + suffix,
+               nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+                   return checksumOf(pvt->saturatedGasDissolutionFactor(0, T[i], p[i]));
+               }));
+        record("brine 1/B (CO2STORE)" + suffix,
+               nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+                   return checksumOf(pvt->inverseFormationVolumeFactor(0, T[i], p[i], co2Rs[i]));
+               }));
+    }
+    record("CO2 1/B (CO2STORE)",
+           nanosecondsPerCell(numCells, numRepetitions, checksum, [&](std::size_t i) {
+               return checksumOf(setup.co2Gas.inverseFormationVolumeFactor(0, T[i], p[i], Rvw[i], Rvw[i]));
+           }));
+}
+
+void benchmarkPTFlash(const std::size_t numCells, const unsigned numRepetitions,
+                      Results& results, std::vector<std::string>& operations,
+                      std::vector<std::string>& notes, double& checksum)
+{
+    using FluidSystem = Opm::ThreeComponentFluidSystem<double>;
+    constexpr int numComponents = FluidSystem::numComponents;
+    using Evaluation = Opm::DenseAd::Evaluation<double, numComponents>;
+    using ComponentVector = Dune::FieldVector<Evaluation, numComponents>;
+    using FluidState = Opm::CompositionalFluidState<Evaluation, FluidSystem>;
+    using Flash = Opm::PTFlash<double, FluidSystem>;
+
+    // pressures and compositions which cover single- and two-phase states
+    std::vector<FluidState> initialStates(numCells);
+    std::vector<ComponentVector> z(numCells);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        const double xi = static_cast<double>((cellIdx*7919) % numCells) / numCells;
+        const double eta = static_cast<double>((cellIdx*104729) % numCells) / numCells;
+        const Evaluation p = Evaluation::createVariable(1e5*std::pow(1.4, 19.0*xi), 0);
+        z[cellIdx][0] = Evaluation::createVariable(0.005 + 0.95*eta, 1);
+        z[cellIdx][1] = Evaluation::createVariable(0.3*(1.0 - Opm::getValue(z[cellIdx][0])), 2);
+        z[cellIdx][2] = 1.0 - z[cellIdx][0] - z[cellIdx][1];
+
+        auto& fs = initialStates[cellIdx];
+        fs.setPressure(FluidSystem::oilPhaseIdx, p);
+        fs.setPressure(FluidSystem::gasPhaseIdx, p);
+        fs.setTemperature(300.0);
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fs.setMoleFraction(FluidSystem::oilPhaseIdx, compIdx, z[cellIdx][compIdx]);
+            fs.setMoleFraction(FluidSystem::gasPhaseIdx, compIdx, z[cellIdx][compIdx]);
+        }
+        fs.setSaturation(FluidSystem::oilPhaseIdx, 1.0);
+        fs.setSaturation(FluidSystem::gasPhaseIdx, 0.0);
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fs.setKvalue(compIdx, fs.wilsonK_(compIdx));
+        }
+        fs.setLvalue(1.0);
+    }
+
+    for (const std::string method : {"newton", "ssi+newton"}) {
+        std::vector<FluidState> states;
+        std::size_t numFailures = 0;
+        const std::string name = "PTFlash " + method + " (3 comp.)";
+        operations.push_back(name);
+        results[name][numComponents] =
+            nanosecondsPerCell(numCells, numRepetitions, checksum,
+                               [&]() { states = initialStates; numFailures = 0; },
+                               [&](std::size_t i) {
+                                   try {
+                                       Flash::solve(states[i], z[i], method, 1e-10);
+                                   }
+                                   catch (const std::exception&) {
+                                       ++numFailures;
+                                       return 0.0;
+                                   }
+                                   return checksumOf(states[i].L());
+                               });
+        if (numFailures > 0) {
+            notes.push_back(name + ": " + std::to_string(numFailures) + " of " +
+                            std::to_string(numCells) + " flashes did not converge");
+        }
+    }
+}
+
+template <int... numDerivatives>
+void benchmarkAll(const Setup& setup, const unsigned numRepetitions,
+                  const std::vector<int>& selected, Results& results,
+                  std::vector<std::string>& operations, double& checksum,
+                  std::integer_sequence<int, numDerivatives...>)
+{
+    const auto run = [&](auto size) {
+        constexpr int n = decltype(size)::value;
+        if (std::find(selected.begin(), selected.end(), n) != selected.end())
+            benchmarkBlackOil<n>(setup, numRepetitions, results, operations, checksum);
+    };
+    (run(std::integral_constant<int, numDerivatives + 1>{}), ...);
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t numCells = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 10000;
+    const unsigned numRepetitions = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 5;
+
+    std::vector<int> selected;
+    for (int argIdx = 3; argIdx < argc; ++argIdx) {
+        const int n = std::atoi(argv[argIdx]);
+        if (n < 1 || n > maxNumDerivatives) {
+            std::cerr << "The number of derivatives must be between 1 and "
+                      << maxNumDerivatives << ", got '" << argv[argIdx] << "'\n";
+            return EXIT_FAILURE;
+        }
+        selected.push_back(n);
+    }
+    if (selected.empty()) {
+        for (int n = 1; n <= maxNumDerivatives; ++n)
+            selected.push_back(n);
+    }
+    if (numCells == 0 || numRepetitions == 0) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [numCells [numRepetitions [numDerivatives ...]]]\n";
+        return EXIT_FAILURE;
+    }
+
+    const Setup setup(numCells);
+
+    Results results;
+    std::vector<std::string> operations;
+    std::vector<std::string> notes;
+    double checksum = 0.0;
+    benchmarkAll(setup, numRepetitions, selected, results, operations, checksum,
+                 std::make_integer_sequence<int, maxNumDerivatives>{});
+    if (std::find(selected.begin(), selected.end(), 3) != selected.end())
+        benchmarkPTFlash(numCells, numRepetitions, results, operations, notes, checksum);
+
+    std::cout << "Cells: " << numCells << ", repetitions: " << numRepetitions
+              << ", tabulated CO2-brine error: "
+              << setup.tabulatedBrineCo2.tables().maxRelativeError() << "\n"
+              << "Time per cell [ns] by number of derivatives\n"
+              << std::left << std::setw(40) << "Operation" << std::right;
+    for (const int n : selected)
+        std::cout << std::setw(9) << n;
+    std::cout << '\n';
+
+    for (const auto& name : operations) {
+        std::cout << std::left << std::setw(40) << name << std::right
+                  << std::fixed << std::setprecision(1);
+        const auto& row = results.at(name);
+        for (const int n : selected) {
+            const auto it = row.find(n);
+            if (it == row.end())
+                std::cout << std::setw(9) << "-";
+            else
+                std::cout << std::setw(9) << it->second;
+        }
+        std::cout << '\n';
+    }
+
+    for (const auto& note : notes)
+        std::cout << note << '\n';
+
+    // the checksum keeps the compiler from discarding the evaluations
+    std::cout << "Checksum: " << std::scientific << checksum << '\n';
+    return std::isfinite(checksum) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
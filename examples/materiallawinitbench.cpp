@@ -0,0 +1,246 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Startup benchmark for EclMaterialLawManager::initParamsForElements().
+ *
+ * Builds a synthetic three-phase model with three saturation regions in
+ * which half of the cells use end-point scaling, and reports the time
+ * spent setting up the per-cell material law parameters with one thread,
+ * with all available threads, and with region-shared parameters.  The
+ * relative permeabilities and capillary pressures of all set-ups are
+ * compared to the serial one to verify that they are identical.
+ */
+#include "config.h"
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
+#include <opm/material/fluidstates/SimpleModularFluidState.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+using MaterialTraits = Opm::ThreePhaseMaterialTraits<double,
+                                                     /*wettingPhaseIdx=*/0,
+                                                     /*nonWettingPhaseIdx=*/1,
+                                                     /*gasPhaseIdx=*/2>;
+using MaterialLawManager = Opm::EclMaterialLawManager<MaterialTraits>;
+using MaterialLaw = MaterialLawManager::MaterialLaw;
+
+using FluidState = Opm::SimpleModularFluidState<double,
+                                                /*numPhases=*/3,
+                                                /*numComponents=*/0,
+                                                /*FluidSystem=*/void,
+                                                /*storePressure=*/false,
+                                                /*storeTemperature=*/false,
+                                                /*storeComposition=*/false,
+                                                /*storeFugacity=*/false,
+                                                /*storeSaturation=*/true,
+                                                /*storeDensity=*/false,
+                                                /*storeViscosity=*/false,
+                                                /*storeEnthalpy=*/false>;
+
+std::string deckString(const std::size_t nx, const std::size_t ny, const std::size_t nz)
+{
+    const std::size_t numCells = nx*ny*nz;
+    const std::size_t third = numCells / 3;
+    const std::size_t half = numCells / 2;
+
+    std::string deck =
+        "RUNSPEC\n"
+        "DIMENS\n " + std::to_string(nx) + " " + std::to_string(ny) + " " + std::to_string(nz) + " /\n"
+        "TABDIMS\n 3 /\n"
+        "OIL\nGAS\nWATER\n"
+        "ENDSCALE\n/\n"
+        "METRIC\n"
+        "GRID\n"
+        "DX\n " + std::to_string(numCells) + "*100 /\n"
+        "DY\n " + std::to_string(numCells) + "*100 /\n"
+        "DZ\n " + std::to_string(numCells) + "*10 /\n"
+        "TOPS\n " + std::to_string(nx*ny) + "*2000 /\n"
+        "PORO\n " + std::to_string(numCells) + "*0.25 /\n"
+        "PERMX\n " + std::to_string(numCells) + "*100 /\n"
+        "PERMY\n " + std::to_string(numCells) + "*100 /\n"
+        "PERMZ\n " + std::to_string(numCells) + "*10 /\n"
+        "PROPS\n";
+
+    const std::string swof =
+        "0.1  0.0   1.0   2.0\n"
+        "0.3  0.05  0.6   1.0\n"
+        "0.5  0.2   0.25  0.5\n"
+        "0.7  0.45  0.05  0.2\n"
+        "0.9  0.8   0.0   0.0\n"
+        "1.0  1.0   0.0   0.0 /\n";
+    const std::string sgof =
+        "0.0  0.0   1.0   0.0\n"
+        "0.2  0.1   0.5   0.1\n"
+        "0.5  0.4   0.1   0.3\n"
+        "0.9  1.0   0.0   0.5 /\n";
+    deck += "SWOF\n" + swof + swof + swof;
+    deck += "SGOF\n" + sgof + sgof + sgof;
+    deck += "SWL\n " + std::to_string(half) + "*0.1 "
+        + std::to_string(numCells - half) + "*0.15 /\n";
+    deck += "REGIONS\n"
+        "SATNUM\n " + std::to_string(third) + "*1 " + std::to_string(third) + "*2 "
+        + std::to_string(numCells - 2*third) + "*3 /\n";
+
+    return deck;
+}
+
+std::vector<int> intFieldProp(const Opm::FieldPropsManager& fieldProps,
+                              const std::string& keyword,
+                              const unsigned int numElems,
+                              bool needsTranslation)
+{
+    std::vector<int> dest(numElems);
+    const auto& data = fieldProps.get_int(keyword);
+    for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
+        dest[elemIdx] = data[elemIdx] - needsTranslation;
+    }
+    return dest;
+}
+
+struct SetUp
+{
+    std::string name;
+    int numThreads;
+    bool regionShared;
+};
+
+std::unique_ptr<MaterialLawManager>
+initialize(const Opm::EclipseState& eclState, const std::size_t numCells,
+           const SetUp& setUp, double& seconds)
+{
+#ifdef _OPENMP
+    omp_set_num_threads(setUp.numThreads);
+#endif
+
+    auto manager = std::make_unique<MaterialLawManager>();
+    manager->initFromState(eclState);
+    manager->setRegionSharedParams(setUp.regionShared);
+
+    const auto start = std::chrono::steady_clock::now();
+    manager->initParamsForElements(eclState, numCells, &intFieldProp,
+                                   [](unsigned elemIdx) { return elemIdx; });
+    const auto stop = std::chrono::steady_clock::now();
+
+    seconds = std::chrono::duration<double>(stop - start).count();
+    return manager;
+}
+
+std::size_t countMismatches(const MaterialLawManager& reference,
+                            const MaterialLawManager& candidate,
+                            const std::size_t numCells)
+{
+    std::size_t mismatches = 0;
+    for (std::size_t elemIdx = 0; elemIdx < numCells; ++elemIdx) {
+        for (const double sw : {0.2, 0.5, 0.8}) {
+            FluidState fs;
+            fs.setSaturation(0, sw);
+            fs.setSaturation(1, 0.9 - sw);
+            fs.setSaturation(2, 0.1);
+
+            std::array<double, 3> krRef{}, krCand{}, pcRef{}, pcCand{};
+            MaterialLaw::relativePermeabilities(krRef, reference.materialLawParams(elemIdx), fs);
+            MaterialLaw::relativePermeabilities(krCand, candidate.materialLawParams(elemIdx), fs);
+            MaterialLaw::capillaryPressures(pcRef, reference.materialLawParams(elemIdx), fs);
+            MaterialLaw::capillaryPressures(pcCand, candidate.materialLawParams(elemIdx), fs);
+
+            if (krRef != krCand || pcRef != pcCand) {
+                ++mismatches;
+            }
+        }
+    }
+    return mismatches;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t nx = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 100;
+    const std::size_t ny = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 100;
+    const std::size_t nz = (argc > 3) ? std::strtoul(argv[3], nullptr, 10) : 20;
+    const std::size_t numCells = nx*ny*nz;
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(deckString(nx, ny, nz));
+    const Opm::EclipseState eclState(deck);
+
+    int maxThreads = 1;
+#ifdef _OPENMP
+    maxThreads = omp_get_max_threads();
+#endif
+
+    const std::vector<SetUp> setUps = {
+        {"serial", 1, false},
+        {"parallel", maxThreads, false},
+        {"serial, region-shared", 1, true},
+        {"parallel, region-shared", maxThreads, true},
+    };
+
+    std::cout << "Cells: " << numCells << ", threads: " << maxThreads << "\n"
+              << std::left << std::setw(28) << "Set-up" << std::right
+              << std::setw(12) << "time [s]"
+              << std::setw(14) << "mismatches" << '\n';
+
+    double referenceSeconds = 0.0;
+    const auto reference = initialize(eclState, numCells, setUps.front(), referenceSeconds);
+
+    bool identical = true;
+    for (const auto& setUp : setUps) {
+        double seconds = referenceSeconds;
+        std::size_t mismatches = 0;
+        if (&setUp != &setUps.front()) {
+            const auto manager = initialize(eclState, numCells, setUp, seconds);
+            mismatches = countMismatches(*reference, *manager, numCells);
+        }
+        identical = identical && (mismatches == 0);
+
+        std::cout << std::left << std::setw(28) << setUp.name << std::right << std::fixed
+                  << std::setprecision(3)
+                  << std::setw(12) << seconds
+                  << std::setw(14) << mismatches << '\n';
+    }
+
+    return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+}
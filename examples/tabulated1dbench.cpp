@@ -0,0 +1,182 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Micro benchmark for segment lookup in Tabulated1DFunction.
+ *
+ * Evaluates tables of typical SWOF and PVTO sizes in a pattern resembling
+ * a simulator: each cell is evaluated once per Newton iteration, and the
+ * argument changes only slightly between iterations.  Reports the time per
+ * evaluation for a plain bisection, for eval() with the table's segment
+ * index, and for eval() with a per-cell segment hint.
+ */
+#include "config.h"
+
+#include <opm/material/common/Tabulated1DFunction.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Table
+{
+    std::string name;
+    std::vector<double> x;
+    std::vector<double> y;
+};
+
+// Water saturation table with denser sampling near the end points, as
+// typically generated for SWOF.
+Table swofTable(const std::size_t numRows)
+{
+    Table t{"SWOF (" + std::to_string(numRows) + " rows)", {}, {}};
+    for (std::size_t i = 0; i < numRows; ++i) {
+        const double s = static_cast<double>(i) / (numRows - 1);
+        const double sw = 0.2 + 0.6*(0.5 - 0.5*std::cos(M_PI*s));
+        t.x.push_back(sw);
+        t.y.push_back(std::pow((sw - 0.2)/0.6, 3.0));
+    }
+    return t;
+}
+
+// Saturated oil pressure table with geometrically increasing steps, as in
+// PVTO.
+Table pvtoTable(const std::size_t numRows)
+{
+    Table t{"PVTO (" + std::to_string(numRows) + " rows)", {}, {}};
+    double p = 1.0e5;
+    for (std::size_t i = 0; i < numRows; ++i) {
+        t.x.push_back(p);
+        t.y.push_back(1.0 + 1.0e-9*p);
+        p *= 1.0 + 5.0/numRows;
+    }
+    return t;
+}
+
+template <class Fn>
+double nanosecondsPerEval(const std::size_t numEvals, Fn&& fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const double sum = fn();
+    const auto stop = std::chrono::steady_clock::now();
+
+    // Keep the result alive so that the loop is not optimised away.
+    if (!std::isfinite(sum))
+        std::cerr << "Non-finite checksum\n";
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / numEvals;
+}
+
+void benchmark(const Table& table, const std::size_t numCells, const std::size_t numIter)
+{
+    const Opm::Tabulated1DFunction<double> f(table.x, table.y, /*sortInputs=*/false);
+
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> position(table.x.front(), table.x.back());
+    std::uniform_real_distribution<double> perturbation(-1.0e-4, 1.0e-4);
+
+    std::vector<double> cellX(numCells);
+    std::generate(cellX.begin(), cellX.end(), [&]() { return position(gen); });
+
+    std::vector<double> deltaX(numIter);
+    const double range = table.x.back() - table.x.front();
+    std::generate(deltaX.begin(), deltaX.end(), [&]() { return range*perturbation(gen); });
+
+    const auto clampX = [&table](const double xi)
+    { return std::clamp(xi, table.x.front(), table.x.back()); };
+
+    const std::size_t numEvals = numCells*numIter;
+
+    const double bisection = nanosecondsPerEval(numEvals, [&]() {
+        double sum = 0.0;
+        for (std::size_t iter = 0; iter < numIter; ++iter) {
+            for (const auto& x0 : cellX) {
+                const double xi = clampX(x0 + deltaX[iter]);
+                const auto pos = std::upper_bound(table.x.begin() + 1, table.x.end() - 1, xi);
+                const std::size_t segIdx = std::min<std::size_t>(pos - table.x.begin() - 1, table.x.size() - 2);
+                sum += f.eval(xi, Opm::SegmentIndex{segIdx});
+            }
+        }
+        return sum;
+    });
+
+    const double indexed = nanosecondsPerEval(numEvals, [&]() {
+        double sum = 0.0;
+        for (std::size_t iter = 0; iter < numIter; ++iter) {
+            for (const auto& x0 : cellX) {
+                sum += f.eval(clampX(x0 + deltaX[iter]));
+            }
+        }
+        return sum;
+    });
+
+    std::vector<Opm::SegmentHint> hints(numCells);
+    const double hinted = nanosecondsPerEval(numEvals, [&]() {
+        double sum = 0.0;
+        for (std::size_t iter = 0; iter < numIter; ++iter) {
+            for (std::size_t cell = 0; cell < numCells; ++cell) {
+                sum += f.eval(clampX(cellX[cell] + deltaX[iter]), hints[cell]);
+            }
+        }
+        return sum;
+    });
+
+    std::cout << std::left << std::setw(24) << table.name << std::right << std::fixed
+              << std::setprecision(2)
+              << std::setw(14) << bisection
+              << std::setw(14) << indexed
+              << std::setw(14) << hinted << '\n';
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t numCells = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    const std::size_t numIter  = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 20;
+
+    std::cout << "Cells: " << numCells << ", Newton iterations: " << numIter << "\n"
+              << "Time per evaluation [ns]\n"
+              << std::left << std::setw(24) << "Table" << std::right
+              << std::setw(14) << "bisection"
+              << std::setw(14) << "eval()"
+              << std::setw(14) << "eval(hint)" << '\n';
+
+    for (const auto& table : { swofTable(20), swofTable(100),
+                               pvtoTable(30), pvtoTable(200), pvtoTable(2000) })
+    {
+        benchmark(table, numCells, numIter);
+    }
+
+    return EXIT_SUCCESS;
+}
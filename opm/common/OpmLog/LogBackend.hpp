@@ -27,6 +27,7 @@
 #include <cstdint>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace Opm
 {
@@ -55,6 +56,17 @@ namespace Opm
                               const std::string& messageTag,
                               const std::string& message);
 
+        /// Apply the mask and the message limiter to a tagged message like
+        /// addTaggedMessage(), but return the messages to add instead of
+        /// adding them: a notice if a message limit has just been reached,
+        /// followed by the message itself if it is accepted.
+        std::vector<std::string> filterTaggedMessage(int64_t messageFlag,
+                                                     const std::string& messageTag,
+                                                     const std::string& message);
+
+        /// Add a message returned by filterTaggedMessage().
+        void addFilteredMessage(int64_t messageFlag, const std::string& message);
+
         /// The message mask types are specified in the
         /// Opm::Log::MessageType namespace, in file LogUtils.hpp.
         int64_t getMask() const;
@@ -75,6 +87,10 @@ namespace Opm
         /// and the message limiter returns a PrintMessage response.
         bool includeMessage(int64_t messageFlag, const std::string& messageTag);
 
+        /// Like includeMessage(), but returns the notice about a message
+        /// limit which has just been reached in 'notice' instead of adding it.
+        bool applyLimits(int64_t messageFlag, const std::string& messageTag, std::string& notice);
+
         int64_t m_mask;
         std::shared_ptr<MessageFormatterInterface> m_formatter;
         std::shared_ptr<MessageLimiter> m_limiter;
@@ -24,6 +24,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace Opm {
@@ -34,6 +35,8 @@ class Logger {
 
 public:
     Logger();
+    ~Logger();
+
     void addMessage(int64_t messageType , const std::string& message) const;
     void addTaggedMessage(int64_t messageType, const std::string& tag, const std::string& message) const;
 
@@ -47,8 +50,29 @@ public:
     bool removeBackend(const std::string& name);
     void removeAllBackends();
 
+    /// Hand messages to a dedicated logging thread instead of passing
+    /// them to the backends on the calling thread.
+    ///
+    /// The message masks and limits of all backends are applied on the
+    /// calling thread while holding a mutex shared by all backends, so
+    /// concurrently logging threads are serialized before their messages
+    /// reach the queue. Only the accepted messages are put on the queue,
+    /// which does not block, and the logging thread then formats and
+    /// writes them. Error and bug messages, and switching back to
+    /// synchronous mode or destroying the logger, wait until all queued
+    /// messages have been written. The mode should only be changed while
+    /// no other thread is logging.
+    void setAsynchronous(bool async);
+    bool isAsynchronous() const;
+
+    /// Wait until all queued messages have been passed to the backends.
+    /// Rethrows the first exception thrown by a backend on the logging
+    /// thread since the last flush. Does nothing in synchronous mode.
+    void flush() const;
+
     template <class BackendType>
     std::shared_ptr<BackendType> getBackend(const std::string& name) const {
+        this->flush();
         auto pair = m_backends.find( name );
         if (pair == m_backends.end())
             throw std::invalid_argument("Invalid backend name: " + name);
@@ -70,12 +94,20 @@ public:
 
 
 private:
+    class AsyncQueue;
+
     void updateGlobalMask( int64_t mask );
     static bool enabledMessageType( int64_t enabledTypes , int64_t messageType);
+    void dispatch(int64_t messageType, const std::string& tag, const std::string& message) const;
 
     int64_t m_globalMask;
     int64_t m_enabledTypes;
     std::map<std::string , std::shared_ptr<LogBackend> > m_backends;
+
+    // Guards m_backends and the message limiters of the backends against
+    // concurrently logging threads in asynchronous mode.
+    mutable std::mutex m_backendMutex;
+    std::unique_ptr<AsyncQueue> m_async;
 };
 
 }
@@ -65,6 +65,21 @@ public:
     static bool enabledMessageType( int64_t messageType );
     static void addMessageType( int64_t messageType , const std::string& prefix);
 
+    /// Pass the messages to the backends on a dedicated logging thread.
+    ///
+    /// The calling threads apply the message masks and limits of the
+    /// backends, under a mutex shared by all backends, and queue the
+    /// accepted messages. Formatting and writing the messages is done on
+    /// the logging thread. Error and bug messages are written before the
+    /// call returns, and all pending messages are written when switching
+    /// back to synchronous mode, when removing backends and at program
+    /// exit. See Logger::setAsynchronous().
+    static void setAsynchronous(bool async);
+    static bool isAsynchronous();
+
+    /// Wait until all pending messages have been written by the backends.
+    static void flush();
+
     /// Create a basic logging setup that will send all log messages to standard output.
     ///
     /// By default category prefixes will be printed (i.e. Error: or
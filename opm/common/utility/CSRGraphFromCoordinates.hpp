@@ -440,6 +440,18 @@ namespace Opm { namespace utility {
             /// the input coordinate format.
             void condenseDuplicates();
 
+            /// Multi-threaded version of condenseDuplicates().
+            ///
+            /// Marks the first element of each run of repeated column
+            /// indices and derives the final location of all elements from
+            /// a prefix sum of those marks.  The work is thus balanced on
+            /// the number of non-zero elements irrespective of the length
+            /// of the individual rows.  Forms the same \c ia_, \c ja_ and
+            /// \c compressedIdx_ as the serial version.
+            ///
+            /// \param[in] numWorkers Number of threads to use.
+            void condenseDuplicatesParallel(int numWorkers);
+
             // ---------------------------------------------------------
             // Implementation of assemble()
             // ---------------------------------------------------------
@@ -474,6 +486,50 @@ namespace Opm { namespace utility {
             void groupAndTrackColumnIndicesByRow(const Neighbours& rowIdx,
                                                  const Neighbours& colIdx);
 
+            /// Group column indices by corresponding row index, form the
+            /// row start pointers and track the grouped location of each
+            /// original coordinate format element.
+            ///
+            /// Equivalent to preparePushbackRowGrouping() followed by
+            /// groupAndTrackColumnIndicesByRow(), but distributes the work
+            /// across threads when the input is large enough.
+            ///
+            /// \param[in] numRows Number of rows in final compressed
+            ///    structure.
+            ///
+            /// \param[in] rowIdx Row index of coordinate format input
+            ///    structure.  Used as grouping key.
+            ///
+            /// \param[in] colIdx Column index of coordinate format input
+            ///    structure.
+            void groupColumnIndicesByRow(const int         numRows,
+                                         const Neighbours& rowIdx,
+                                         const Neighbours& colIdx);
+
+            /// Multi-threaded grouping of column indices by row index.
+            ///
+            /// Splits the input into \p numChunks consecutive chunks, each
+            /// of which counts its own contributions per row.  Every chunk
+            /// then inserts its elements at offsets derived from the counts
+            /// of all preceding chunks which reproduces the grouped order
+            /// of groupAndTrackColumnIndicesByRow() exactly.  Needs \p
+            /// numChunks counters per row.
+            ///
+            /// \param[in] numRows Number of rows in final compressed
+            ///    structure.
+            ///
+            /// \param[in] numChunks Number of independent input chunks.
+            ///
+            /// \param[in] rowIdx Row index of coordinate format input
+            ///    structure.  Used as grouping key.
+            ///
+            /// \param[in] colIdx Column index of coordinate format input
+            ///    structure.
+            void groupColumnIndicesByRowParallel(const int         numRows,
+                                                 const int         numChunks,
+                                                 const Neighbours& rowIdx,
+                                                 const Neighbours& colIdx);
+
             // ---------------------------------------------------------
             // General utilities
             // ---------------------------------------------------------
@@ -514,6 +570,24 @@ namespace Opm { namespace utility {
             ///   compress() when TrackCompressedIdx is true.
             void remapCompressedIndex(Start&&                                  compressedIdx,
                                       std::optional<typename Start::size_type> numOrigNNZ = std::nullopt);
+
+            /// Number of threads to use for a processing step.
+            ///
+            /// \param[in] work Number of elements processed by the step.
+            ///
+            /// \return Maximum number of OpenMP threads if \p work is large
+            ///    enough to amortise the threading overhead, and one
+            ///    otherwise.
+            static int numWorkers(Offset work);
+
+            /// Replace each element of a sequence by the sum of itself and
+            /// all preceding elements.
+            ///
+            /// \param[in,out] x Sequence.  Replaced by its inclusive prefix
+            ///    sum on exit.
+            ///
+            /// \param[in] numWorkers Number of threads to use.
+            static void inclusivePrefixSum(Start& x, int numWorkers);
         };
 
         /// Accumulated coordinate format contributions that have not yet
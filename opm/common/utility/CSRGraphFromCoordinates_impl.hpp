@@ -23,12 +23,17 @@
 #include <cassert>
 #include <exception>
 #include <iterator>
+#include <numeric>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // ---------------------------------------------------------------------
 // Class Opm::utility::CSRGraphFromCoordinates::Connections
 // ---------------------------------------------------------------------
@@ -221,15 +226,19 @@ CSR::coordinateFormatRowIndices() const
         return rowIdx;
     }
 
-    rowIdx.reserve(this->ia_.back());
+    rowIdx.resize(this->ia_.back());
 
-    auto row = BaseVertexID{};
+    [[maybe_unused]] const auto nthreads = numWorkers(rowIdx.size());
 
     const auto m = this->ia_.size() - 1;
-    for (auto i = 0*m; i < m; ++i, ++row) {
-        const auto n = this->ia_[i + 1] - this->ia_[i + 0];
 
-        rowIdx.insert(rowIdx.end(), n, row);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (nthreads > 1) num_threads(nthreads)
+#endif
+    for (auto i = 0*m; i < m; ++i) {
+        std::fill(rowIdx.begin() + this->ia_[i + 0],
+                  rowIdx.begin() + this->ia_[i + 1],
+                  static_cast<BaseVertexID>(i));
     }
 
     return rowIdx;
@@ -272,9 +281,7 @@ CSR::assemble(const Neighbours&  rows,
     const auto thisNumRows = std::max(this->numRows_, maxRowIdx + 1);
     const auto thisNumCols = std::max(this->numCols_, maxColIdx + 1);
 
-    this->preparePushbackRowGrouping(thisNumRows, i);
-
-    this->groupAndTrackColumnIndicesByRow(i, j);
+    this->groupColumnIndicesByRow(thisNumRows, i, j);
 
     if constexpr (TrackCompressedIdx) {
         if (expandExistingIdxMap) {
@@ -334,6 +341,11 @@ CSR::condenseDuplicates()
 {
     // Note: Must be called *after* sortColumnIndicesPerRow().
 
+    if (const auto nthreads = numWorkers(this->ja_.size()); nthreads > 1) {
+        this->condenseDuplicatesParallel(nthreads);
+        return;
+    }
+
     const auto colIdx = this->ja_;
     auto end          = colIdx.begin();
 
@@ -365,6 +377,73 @@ CSR::condenseDuplicates()
     this->ia_.back() = this->ja_.size();
 }
 
+template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
+void
+Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
+CSR::condenseDuplicatesParallel([[maybe_unused]] const int numWorkers)
+{
+    // Note: Must be called *after* sortColumnIndicesPerRow().
+
+    const auto nnz = this->ja_.size();
+    const auto numPtr = this->ia_.size();
+
+    // Mark first element of each run of repeated column indices.  Element
+    // 'p' is recorded in pos[p + 1] such that the inclusive prefix sum
+    // below leaves the number of unique elements preceding element 'p' in
+    // pos[p].  Each row starts a new run.
+    auto pos = Start(nnz + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(numWorkers)
+#endif
+    for (auto p = 0*nnz; p < nnz; ++p) {
+        pos[p + 1] = (p == 0) || (this->ja_[p] != this->ja_[p - 1]);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(numWorkers)
+#endif
+    for (auto row = 0*numPtr; row < numPtr - 1; ++row) {
+        if (this->ia_[row + 0] < this->ia_[row + 1]) {
+            pos[this->ia_[row] + 1] = 1;
+        }
+    }
+
+    inclusivePrefixSum(pos, numWorkers);
+
+    auto colIdx = Neighbours(pos.back());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(numWorkers)
+#endif
+    for (auto p = 0*nnz; p < nnz; ++p) {
+        if (pos[p + 1] != pos[p]) {
+            colIdx[pos[p]] = this->ja_[p];
+        }
+    }
+
+    if constexpr (TrackCompressedIdx) {
+        // Final location of grouped element 'p' is pos[p + 1] - 1.
+        const auto n = this->compressedIdx_.size();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(numWorkers)
+#endif
+        for (auto i = 0*n; i < n; ++i) {
+            this->compressedIdx_[i] = pos[this->compressedIdx_[i] + 1] - 1;
+        }
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(numWorkers)
+#endif
+    for (auto row = 0*numPtr; row < numPtr; ++row) {
+        this->ia_[row] = pos[this->ia_[row]];
+    }
+
+    this->ja_.swap(colIdx);
+}
+
 template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
 void
 Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
@@ -447,6 +526,110 @@ CSR::groupAndTrackColumnIndicesByRow(const Neighbours& rowIdx,
     this->ia_[0] = 0;
 }
 
+template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
+void
+Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
+CSR::groupColumnIndicesByRow(const int         numRows,
+                             const Neighbours& rowIdx,
+                             const Neighbours& colIdx)
+{
+    assert (numRows >= 0);
+
+    // Each chunk needs one counter per row.  Limit the number of chunks
+    // such that the counters do not outnumber the input elements.
+    const auto nnz = rowIdx.size();
+    const auto maxChunks = nnz / std::max(static_cast<Offset>(numRows), Offset{1});
+    const auto numChunks = static_cast<int>
+        (std::min(static_cast<Offset>(numWorkers(nnz)), maxChunks));
+
+    if (numChunks > 1) {
+        this->groupColumnIndicesByRowParallel(numRows, numChunks, rowIdx, colIdx);
+    }
+    else {
+        this->preparePushbackRowGrouping(numRows, rowIdx);
+        this->groupAndTrackColumnIndicesByRow(rowIdx, colIdx);
+    }
+}
+
+template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
+void
+Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
+CSR::groupColumnIndicesByRowParallel(const int         numRows,
+                                     const int         numChunks,
+                                     const Neighbours& rowIdx,
+                                     const Neighbours& colIdx)
+{
+    const auto nnz = rowIdx.size();
+    const auto nrows = static_cast<Offset>(numRows);
+
+    const auto chunkStart = [nnz, numChunks](const int chunk)
+    {
+        return (nnz * chunk) / numChunks;
+    };
+
+    // count[chunk*nrows + row] is number of elements of 'row' in 'chunk'.
+    auto count = Start(numChunks * nrows, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(numChunks)
+#endif
+    for (auto chunk = 0; chunk < numChunks; ++chunk) {
+        auto* chunkCount = count.data() + chunk*nrows;
+
+        for (auto nz = chunkStart(chunk), end = chunkStart(chunk + 1); nz < end; ++nz) {
+            ++chunkCount[rowIdx[nz]];
+        }
+    }
+
+    // Convert counts to insertion offsets of each chunk relative to the
+    // start of the row.  Chunks are laid out in input order within each
+    // row, whence the grouped order matches the serial algorithm.
+    this->ia_.assign(nrows + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(numChunks)
+#endif
+    for (auto row = 0*nrows; row < nrows; ++row) {
+        auto total = Offset{0};
+
+        for (auto chunk = 0; chunk < numChunks; ++chunk) {
+            auto& n = count[chunk*nrows + row];
+
+            total += std::exchange(n, total);
+        }
+
+        this->ia_[row + 1] = total;
+    }
+
+    inclusivePrefixSum(this->ia_, numChunks);
+
+    assert (this->ia_.back() == nnz);
+
+    this->ja_.resize(nnz);
+
+    if constexpr (TrackCompressedIdx) {
+        this->compressedIdx_.resize(nnz);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(numChunks)
+#endif
+    for (auto chunk = 0; chunk < numChunks; ++chunk) {
+        auto* chunkOffset = count.data() + chunk*nrows;
+
+        for (auto nz = chunkStart(chunk), end = chunkStart(chunk + 1); nz < end; ++nz) {
+            const auto row = rowIdx[nz];
+            const auto k = this->ia_[row] + chunkOffset[row]++;
+
+            this->ja_[k] = colIdx[nz];
+
+            if constexpr (TrackCompressedIdx) {
+                this->compressedIdx_[nz] = k;
+            }
+        }
+    }
+}
+
 template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
 void
 Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
@@ -458,11 +641,9 @@ CSR::transpose()
         const auto rowIdx = this->coordinateFormatRowIndices();
         const auto colIdx = this->ja_;
 
-        this->preparePushbackRowGrouping(this->numCols_, colIdx);
-
         // Note parameter order.  Transposition switches role of rows and
         // columns.
-        this->groupAndTrackColumnIndicesByRow(colIdx, rowIdx);
+        this->groupColumnIndicesByRow(this->numCols_, colIdx, rowIdx);
     }
 
     if constexpr (TrackCompressedIdx) {
@@ -524,8 +705,14 @@ remapCompressedIndex([[maybe_unused]] Start&&                                  c
                      [[maybe_unused]] std::optional<typename Start::size_type> numOrig)
 {
     if constexpr (TrackCompressedIdx) {
-        for (auto& i : compressedIdx) {
-            i = this->compressedIdx_[i];
+        const auto n = compressedIdx.size();
+        [[maybe_unused]] const auto nthreads = numWorkers(n);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (nthreads > 1) num_threads(nthreads)
+#endif
+        for (auto i = 0*n; i < n; ++i) {
+            compressedIdx[i] = this->compressedIdx_[compressedIdx[i]];
         }
 
         if (numOrig.has_value() && (*numOrig < this->compressedIdx_.size())) {
@@ -541,6 +728,67 @@ remapCompressedIndex([[maybe_unused]] Start&&                                  c
     }
 }
 
+template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
+int
+Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::CSR::
+numWorkers([[maybe_unused]] const Offset work)
+{
+#ifdef _OPENMP
+    // Threading overhead dominates for smaller amounts of work.
+    constexpr auto minWorkPerThread = Offset{1} << 14;
+
+    const auto maxThreads = static_cast<Offset>(omp_get_max_threads());
+
+    return static_cast<int>(std::clamp(work / minWorkPerThread, Offset{1}, maxThreads));
+#else
+    return 1;
+#endif
+}
+
+template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
+void
+Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::CSR::
+inclusivePrefixSum(Start& x, [[maybe_unused]] const int numWorkers)
+{
+    const auto n = x.size();
+    const auto numBlocks = std::min(static_cast<Offset>(numWorkers), n);
+
+    if (numBlocks < 2) {
+        std::partial_sum(x.begin(), x.end(), x.begin());
+        return;
+    }
+
+    const auto blockStart = [&x, n, numBlocks](const Offset block)
+    {
+        return x.begin() + (n * block) / numBlocks;
+    };
+
+    // Sum within each block, then shift each block by the total of all
+    // preceding blocks.
+    auto blockTotal = Start(numBlocks, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(numWorkers)
+#endif
+    for (auto block = 0*numBlocks; block < numBlocks; ++block) {
+        const auto end = blockStart(block + 1);
+
+        std::partial_sum(blockStart(block), end, blockStart(block));
+
+        blockTotal[block] = *(end - 1);
+    }
+
+    std::partial_sum(blockTotal.begin(), blockTotal.end(), blockTotal.begin());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(numWorkers)
+#endif
+    for (auto block = 1 + 0*numBlocks; block < numBlocks; ++block) {
+        std::for_each(blockStart(block), blockStart(block + 1),
+                      [shift = blockTotal[block - 1]](auto& xi) { xi += shift; });
+    }
+}
+
 // =====================================================================
 
 // ---------------------------------------------------------------------
@@ -0,0 +1,87 @@
+/*
+  Copyright 2024 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_PARALLEL_FOR_HPP
+#define OPM_PARALLEL_FOR_HPP
+
+#include <cstddef>
+#include <exception>
+
+namespace Opm {
+
+/// Call body(i) for each index i in [begin, end).
+///
+/// The indices are distributed dynamically, in chunks of 'chunkSize', over
+/// the OpenMP threads if the range holds more than 'serialLimit' indices.
+/// Otherwise, or if OpenMP is not enabled, the loop runs serially on the
+/// calling thread.  The calls must therefore be independent of each other.
+///
+/// Exceptions must not escape an OpenMP parallel region.  All indices are
+/// processed even if some of the calls throw, after which the exception of
+/// the lowest failing index is rethrown.  This is the exception the serial
+/// loop would have thrown, irrespective of the number of threads.
+///
+/// \param[in] begin First index.
+/// \param[in] end One past the last index.
+/// \param[in] serialLimit Largest number of indices processed serially.
+/// \param[in] chunkSize Number of consecutive indices handed to a thread.
+/// \param[in] body Loop body.  Called as body(i) with i of type std::size_t.
+template <typename Body>
+void parallelFor(const std::size_t begin,
+                 const std::size_t end,
+                 const std::size_t serialLimit,
+                 const std::size_t chunkSize,
+                 Body&&            body)
+{
+    if (begin >= end) {
+        return;
+    }
+
+    auto failure = std::exception_ptr{};
+    auto failureIndex = end;
+
+#ifdef _OPENMP
+    const auto chunk = static_cast<int>(chunkSize);
+    #pragma omp parallel for schedule(dynamic, chunk) if ((end - begin) > serialLimit)
+#else
+    static_cast<void>(serialLimit);
+    static_cast<void>(chunkSize);
+#endif
+    for (std::size_t i = begin; i < end; ++i) {
+        try {
+            body(i);
+        }
+        catch (...) {
+#ifdef _OPENMP
+            #pragma omp critical(opm_parallel_for_failure)
+#endif
+            if (i < failureIndex) {
+                failureIndex = i;
+                failure = std::current_exception();
+            }
+        }
+    }
+
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+
+} // namespace Opm
+
+#endif // OPM_PARALLEL_FOR_HPP
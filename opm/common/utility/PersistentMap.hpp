@@ -0,0 +1,535 @@
+/*
+  Copyright 2024 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_UTILITY_PERSISTENTMAP_HPP
+#define OPM_UTILITY_PERSISTENTMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/// \file
+///
+/// Associative container with structural sharing between copies.  Copying
+/// a map is O(1) and updating a copy only replaces the O(log n) trie nodes
+/// on the path to the updated element.
+
+namespace Opm { namespace utility {
+
+    /// Approximate memory use of one or more PersistentMap instances.
+    /// Trie nodes shared between instances are counted once.
+    struct PersistentMapMemoryUsage
+    {
+        /// Number of distinct trie nodes.
+        std::size_t nodes{0};
+
+        /// Number of elements stored in distinct trie nodes.
+        std::size_t entries{0};
+
+        /// Number of distinct objects referenced by the elements.  Only
+        /// counted by clients that know how to identify such objects.
+        std::size_t objects{0};
+
+        /// Approximate number of bytes used by the distinct trie nodes and
+        /// objects.
+        std::size_t bytes{0};
+
+        PersistentMapMemoryUsage& operator+=(const PersistentMapMemoryUsage& other)
+        {
+            this->nodes += other.nodes;
+            this->entries += other.entries;
+            this->objects += other.objects;
+            this->bytes += other.bytes;
+
+            return *this;
+        }
+    };
+
+    /// Persistent hash map implemented as a hash array mapped trie (HAMT).
+    ///
+    /// Trie nodes are immutable and shared between copies of the map.  An
+    /// insertion copies the nodes on the path from the root to the
+    /// affected element, i.e., O(log n) nodes of at most 32 elements each,
+    /// while all other nodes remain shared with the map that was copied.
+    /// This makes the container suitable for long sequences of snapshots
+    /// in which only a few elements change from one snapshot to the next.
+    ///
+    /// Iteration order is determined by the key hashes, except that
+    /// elements whose hashes collide completely are visited in the order
+    /// in which they were inserted.  Two maps with the same keys thus
+    /// iterate in the same order unless some keys have identical hashes.
+    ///
+    /// \tparam K Key type.
+    ///
+    /// \tparam V Mapped type.  Should be cheap to copy, e.g., a
+    ///    std::shared_ptr<>, since elements are copied when the nodes
+    ///    holding them are copied.
+    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+    class PersistentMap
+    {
+    private:
+        struct Node;
+        using NodePtr = std::shared_ptr<const Node>;
+
+    public:
+        /// Element type.  Keys of elements referenced through iterators
+        /// must not be modified.
+        using value_type = std::pair<K, V>;
+        using size_type = std::size_t;
+
+        /// Forward iterator over all elements of a map.
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = PersistentMap::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const value_type*;
+            using reference = const value_type&;
+
+            const_iterator() = default;
+
+            reference operator*() const
+            {
+                const auto& top = this->stack_.back();
+                return top.node->entries[top.pos];
+            }
+
+            pointer operator->() const
+            {
+                return &**this;
+            }
+
+            const_iterator& operator++()
+            {
+                ++this->stack_.back().pos;
+                this->settle();
+
+                return *this;
+            }
+
+            const_iterator operator++(int)
+            {
+                auto iter = *this;
+                ++*this;
+
+                return iter;
+            }
+
+            bool operator==(const const_iterator& other) const
+            {
+                if (this->stack_.empty() || other.stack_.empty()) {
+                    return this->stack_.empty() == other.stack_.empty();
+                }
+
+                return (this->stack_.back().node == other.stack_.back().node)
+                    && (this->stack_.back().pos == other.stack_.back().pos);
+            }
+
+            bool operator!=(const const_iterator& other) const
+            {
+                return ! (*this == other);
+            }
+
+        private:
+            friend class PersistentMap;
+
+            // Position within a node.  Positions less than the number of
+            // entries refer to entries, and subsequent positions refer to
+            // child nodes.
+            struct Frame
+            {
+                const Node* node{nullptr};
+                std::size_t pos{0};
+            };
+
+            std::vector<Frame> stack_{};
+
+            explicit const_iterator(const Node* root)
+            {
+                if (root != nullptr) {
+                    this->stack_.push_back({ root, 0 });
+                    this->settle();
+                }
+            }
+
+            // Advance to the next position which refers to an entry, or
+            // to the end.
+            void settle()
+            {
+                while (! this->stack_.empty()) {
+                    auto& top = this->stack_.back();
+                    const auto numEntries = top.node->entries.size();
+
+                    if (top.pos < numEntries) {
+                        return;
+                    }
+
+                    const auto child = top.pos - numEntries;
+                    if (child < top.node->children.size()) {
+                        ++top.pos;
+                        this->stack_.push_back({ top.node->children[child].get(), 0 });
+                    }
+                    else {
+                        this->stack_.pop_back();
+                    }
+                }
+            }
+        };
+
+        using iterator = const_iterator;
+
+        /// Number of elements in map.
+        size_type size() const
+        {
+            return this->size_;
+        }
+
+        /// Whether or not map is empty.
+        bool empty() const
+        {
+            return this->size_ == 0;
+        }
+
+        /// Look up element.
+        ///
+        /// \param[in] key Element key.
+        ///
+        /// \return Pointer to mapped value, or nullptr if no element with
+        ///    the given key exists.
+        const V* find(const K& key) const
+        {
+            const auto hash = Hash{}(key);
+            auto shift = 0u;
+
+            const auto* node = this->root_.get();
+            while (node != nullptr) {
+                if (shift >= HashBits) {
+                    for (const auto& entry : node->entries) {
+                        if (KeyEqual{}(entry.first, key)) {
+                            return &entry.second;
+                        }
+                    }
+
+                    return nullptr;
+                }
+
+                const auto bit = bitpos(hash, shift);
+                if ((node->datamap & bit) != 0) {
+                    const auto& entry = node->entries[index(node->datamap, bit)];
+
+                    return KeyEqual{}(entry.first, key)
+                        ? &entry.second : nullptr;
+                }
+
+                if ((node->nodemap & bit) == 0) {
+                    return nullptr;
+                }
+
+                node = node->children[index(node->nodemap, bit)].get();
+                shift += BitsPerLevel;
+            }
+
+            return nullptr;
+        }
+
+        /// Look up element which must exist.
+        ///
+        /// Throws std::out_of_range if no element with the given key
+        /// exists.
+        const V& at(const K& key) const
+        {
+            const auto* value = this->find(key);
+            if (value == nullptr) {
+                throw std::out_of_range {
+                    "Key does not exist in PersistentMap"
+                };
+            }
+
+            return *value;
+        }
+
+        /// Whether or not an element with given key exists.
+        bool contains(const K& key) const
+        {
+            return this->find(key) != nullptr;
+        }
+
+        /// Insert element, or replace mapped value of existing element.
+        ///
+        /// Nodes shared with other maps are not modified.
+        void insert_or_assign(const K& key, V value)
+        {
+            auto added = false;
+            this->root_ = insert(this->root_.get(), Hash{}(key), 0u,
+                                 key, std::move(value), added);
+
+            if (added) {
+                ++this->size_;
+            }
+        }
+
+        /// Iterator to first element.
+        const_iterator begin() const
+        {
+            return const_iterator { this->root_.get() };
+        }
+
+        /// Iterator to one past the last element.
+        const_iterator end() const
+        {
+            return const_iterator{};
+        }
+
+        /// Whether or not this map has exactly the same internal structure
+        /// as another map, e.g., because one is an unmodified copy of the
+        /// other.  Sufficient, but not necessary, for the two maps to have
+        /// the same elements.
+        bool sharesStructure(const PersistentMap& other) const
+        {
+            return this->root_ == other.root_;
+        }
+
+        /// Accumulate memory use of this map's trie nodes.
+        ///
+        /// \param[in,out] seen Nodes already accounted for, e.g., because
+        ///    they are shared with other maps.  Nodes of this map are
+        ///    added to the set.
+        ///
+        /// \param[in,out] usage Memory use.  Incremented by the contribution
+        ///    of those nodes of this map which are not already in \p seen.
+        ///
+        /// \param[in] entryFunc Callback invoked once for each element of
+        ///    the newly seen nodes.  Typically used to account for memory
+        ///    referenced by the element.
+        template <typename EntryFunc>
+        void accumulateMemoryUsage(std::unordered_set<const void*>& seen,
+                                   PersistentMapMemoryUsage&        usage,
+                                   EntryFunc&&                      entryFunc) const
+        {
+            if (this->root_ != nullptr) {
+                accumulateMemoryUsage(*this->root_, seen, usage, entryFunc);
+            }
+        }
+
+        /// Accumulate memory use of this map's trie nodes.
+        void accumulateMemoryUsage(std::unordered_set<const void*>& seen,
+                                   PersistentMapMemoryUsage&        usage) const
+        {
+            this->accumulateMemoryUsage(seen, usage, [](const value_type&) {});
+        }
+
+    private:
+        static constexpr auto BitsPerLevel = 5u;
+        static constexpr auto HashBits = static_cast<unsigned>(8 * sizeof(std::size_t));
+
+        /// Trie node.  Nodes at depth HashBits/BitsPerLevel, or deeper,
+        /// hold all elements whose hashes collide in their 'entries'
+        /// member and use neither bitmap.
+        struct Node
+        {
+            /// Bit set for hash fragments stored directly in this node.
+            std::uint32_t datamap{0};
+
+            /// Bit set for hash fragments stored in child nodes.
+            std::uint32_t nodemap{0};
+
+            /// Elements, in increasing order of hash fragment.
+            std::vector<value_type> entries{};
+
+            /// Child nodes, in increasing order of hash fragment.
+            std::vector<NodePtr> children{};
+        };
+
+        NodePtr root_{};
+        size_type size_{0};
+
+        static std::uint32_t bitpos(const std::size_t hash, const unsigned shift)
+        {
+            return std::uint32_t{1} << ((hash >> shift) & 0x1f);
+        }
+
+        static std::size_t popcount(std::uint32_t bits)
+        {
+            auto count = std::size_t{0};
+            for (; bits != 0; bits &= bits - 1) {
+                ++count;
+            }
+
+            return count;
+        }
+
+        static std::size_t index(const std::uint32_t bitmap, const std::uint32_t bit)
+        {
+            return popcount(bitmap & (bit - 1));
+        }
+
+        static NodePtr insert(const Node*       node,
+                              const std::size_t hash,
+                              const unsigned    shift,
+                              const K&          key,
+                              V&&               value,
+                              bool&             added)
+        {
+            if (node == nullptr) {
+                auto leaf = std::make_shared<Node>();
+                leaf->datamap = bitpos(hash, shift);
+                leaf->entries.emplace_back(key, std::move(value));
+
+                added = true;
+                return leaf;
+            }
+
+            auto copy = std::make_shared<Node>(*node);
+
+            if (shift >= HashBits) {
+                for (auto& entry : copy->entries) {
+                    if (KeyEqual{}(entry.first, key)) {
+                        entry.second = std::move(value);
+                        return copy;
+                    }
+                }
+
+                copy->entries.emplace_back(key, std::move(value));
+
+                added = true;
+                return copy;
+            }
+
+            const auto bit = bitpos(hash, shift);
+
+            if ((copy->datamap & bit) != 0) {
+                const auto ix = index(copy->datamap, bit);
+                auto& entry = copy->entries[ix];
+
+                if (KeyEqual{}(entry.first, key)) {
+                    entry.second = std::move(value);
+                    return copy;
+                }
+
+                // Different key with same hash fragment at this level.
+                // Move both elements into a new subtree.
+                const auto entryHash = Hash{}(entry.first);
+                auto child = makeSubtree(std::move(entry), entryHash,
+                                         value_type { key, std::move(value) }, hash,
+                                         shift + BitsPerLevel);
+
+                copy->entries.erase(copy->entries.begin() + ix);
+                copy->datamap &= ~bit;
+
+                copy->children.insert(copy->children.begin() + index(copy->nodemap, bit),
+                                      std::move(child));
+                copy->nodemap |= bit;
+
+                added = true;
+                return copy;
+            }
+
+            if ((copy->nodemap & bit) != 0) {
+                auto& child = copy->children[index(copy->nodemap, bit)];
+                child = insert(child.get(), hash, shift + BitsPerLevel,
+                               key, std::move(value), added);
+
+                return copy;
+            }
+
+            copy->entries.insert(copy->entries.begin() + index(copy->datamap, bit),
+                                 value_type { key, std::move(value) });
+            copy->datamap |= bit;
+
+            added = true;
+            return copy;
+        }
+
+        static NodePtr makeSubtree(value_type&&      entry1,
+                                   const std::size_t hash1,
+                                   value_type&&      entry2,
+                                   const std::size_t hash2,
+                                   const unsigned    shift)
+        {
+            auto node = std::make_shared<Node>();
+
+            if (shift >= HashBits) {
+                // Full hash collision.
+                node->entries.push_back(std::move(entry1));
+                node->entries.push_back(std::move(entry2));
+
+                return node;
+            }
+
+            const auto bit1 = bitpos(hash1, shift);
+            const auto bit2 = bitpos(hash2, shift);
+
+            if (bit1 == bit2) {
+                node->nodemap = bit1;
+                node->children.push_back(makeSubtree(std::move(entry1), hash1,
+                                                     std::move(entry2), hash2,
+                                                     shift + BitsPerLevel));
+                return node;
+            }
+
+            node->datamap = bit1 | bit2;
+            if (bit1 < bit2) {
+                node->entries.push_back(std::move(entry1));
+                node->entries.push_back(std::move(entry2));
+            }
+            else {
+                node->entries.push_back(std::move(entry2));
+                node->entries.push_back(std::move(entry1));
+            }
+
+            return node;
+        }
+
+        template <typename EntryFunc>
+        static void accumulateMemoryUsage(const Node&                      node,
+                                          std::unordered_set<const void*>& seen,
+                                          PersistentMapMemoryUsage&        usage,
+                                          EntryFunc&                       entryFunc)
+        {
+            if (! seen.insert(&node).second) {
+                // Entire subtree already accounted for.
+                return;
+            }
+
+            usage.nodes += 1;
+            usage.entries += node.entries.size();
+            usage.bytes += sizeof(Node)
+                + node.entries.capacity() * sizeof(value_type)
+                + node.children.capacity() * sizeof(NodePtr);
+
+            for (const auto& entry : node.entries) {
+                entryFunc(entry);
+            }
+
+            for (const auto& child : node.children) {
+                accumulateMemoryUsage(*child, seen, usage, entryFunc);
+            }
+        }
+    };
+
+}} // namespace Opm::utility
+
+#endif // OPM_UTILITY_PERSISTENTMAP_HPP
@@ -0,0 +1,120 @@
+/*
+  Copyright 2024 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_SCOPED_TIMER_HPP
+#define OPM_SCOPED_TIMER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+
+/// Low-overhead hierarchical timing of program phases.
+///
+/// Timing is compiled in but disabled by default.  While disabled a
+/// Scope object costs a single relaxed atomic load.  When enabled, every
+/// Scope records its start time and duration in a buffer local to the
+/// calling thread, along with the counters attributed to it through
+/// addCount() while it was the innermost open scope.  Counters are
+/// inclusive, i.e. a scope reports the sum of its own counts and the
+/// counts of all nested scopes.
+///
+/// The recorded events can be written as a Chrome trace (loadable in
+/// chrome://tracing or Perfetto) or as a JSON report in which the scopes
+/// are aggregated by their call path.
+///
+/// Typical use:
+///
+///   Opm::Timing::enable(true);
+///   {
+///       Opm::Timing::Scope timer{"Schedule"};
+///       ...
+///   }
+///   Opm::Timing::writeReport(std::cout);
+namespace Opm { namespace Timing {
+
+enum class Counter : int {
+    BytesRead,
+    BytesWritten,
+    Allocations,
+    NumCounters
+};
+
+namespace detail {
+    extern std::atomic<bool> isEnabled;
+
+    void begin(const char* name);
+    void end();
+}
+
+/// Turn recording on or off.  Enabling the timing when it is currently
+/// disabled also resets the time origin of the trace.
+void enable(bool on);
+
+/// Whether or not scopes are currently being recorded.
+inline bool enabled()
+{
+    return detail::isEnabled.load(std::memory_order_relaxed);
+}
+
+/// Discard all recorded events.  Must not be called while any scope is
+/// open.
+void reset();
+
+/// Attribute 'count' units to the innermost open scope of the calling
+/// thread.  Does nothing if no scope is open.  Does not allocate, so may
+/// be called from a replacement of the global operator new to track
+/// allocations.
+void addCount(Counter counter, std::uint64_t count);
+
+/// Write all closed scopes as Chrome trace events.  Times are in
+/// microseconds relative to the moment timing was enabled.
+void writeChromeTrace(std::ostream& os);
+
+/// Write the closed scopes aggregated by call path, with the number of
+/// calls, the total wall-clock time in seconds and the inclusive counters
+/// of each path.
+void writeReport(std::ostream& os);
+
+/// RAII timer recording the lifetime of the object as a named phase.  The
+/// name must outlive the recorded events, normally it is a string literal.
+class Scope
+{
+public:
+    explicit Scope(const char* name)
+        : active_(enabled())
+    {
+        if (this->active_)
+            detail::begin(name);
+    }
+
+    ~Scope()
+    {
+        if (this->active_)
+            detail::end();
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    bool active_;
+};
+
+}} // namespace Opm::Timing
+
+#endif // OPM_SCOPED_TIMER_HPP
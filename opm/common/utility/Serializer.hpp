@@ -22,6 +22,7 @@
 #define SERIALIZER_HPP
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <memory>
@@ -83,6 +84,9 @@ using remove_cvr_t = std::remove_cv_t<std::remove_reference_t<T>>;
 template<class Packer>
 class Serializer {
 public:
+    //! \brief Type of the callback receiving the data in packStream().
+    using Sink = std::function<void(const char*, std::size_t)>;
+
     //! \brief Constructor.
     //! \param packer Packer to use
     explicit Serializer(const Packer& packer) :
@@ -114,8 +118,11 @@ public:
         } else {
             if (m_op == Operation::PACKSIZE)
                 m_packSize += m_packer.packSize(data);
-            else if (m_op == Operation::PACK)
+            else if (m_op == Operation::PACK) {
+                growBuffer(m_packer.packSize(data));
                 m_packer.pack(data, m_buffer, m_position);
+                flushBuffer();
+            }
             else if (m_op == Operation::UNPACK)
                 m_packer.unpack(const_cast<T&>(data), m_buffer, m_position);
         }
@@ -127,6 +134,8 @@ public:
     template<class T>
     void pack(const T& data)
     {
+        m_grow = false;
+        m_sink = nullptr;
         m_op = Operation::PACKSIZE;
         m_packSize = 0;
         (*this)(data);
@@ -142,6 +151,8 @@ public:
     template<class... Args>
     void pack(const Args&... data)
     {
+        m_grow = false;
+        m_sink = nullptr;
         m_op = Operation::PACKSIZE;
         m_packSize = 0;
         variadic_call(data...);
@@ -151,6 +162,55 @@ public:
         variadic_call(data...);
     }
 
+    //! \brief Call this to serialize data in a single traversal.
+    //! \details Unlike pack() no PACKSIZE pass is done up front. The buffer
+    //!          is instead grown geometrically while packing and trimmed to
+    //!          the packed size at the end. The result is identical to pack().
+    //! \param data Classes to serialize
+    template<class... Args>
+    void packSinglePass(const Args&... data)
+    {
+        m_op = Operation::PACK;
+        m_grow = true;
+        m_sink = nullptr;
+        m_position = 0;
+        m_buffer.clear();
+        variadic_call(data...);
+        m_buffer.resize(m_position);
+        m_packSize = m_position;
+        m_grow = false;
+    }
+
+    //! \brief Call this to serialize data to a sink in a single traversal.
+    //! \details The packed data is handed to the sink in consecutive chunks
+    //!          of at least chunkSize bytes (except for the last one), so at
+    //!          most one chunk plus the largest single entry is held in
+    //!          memory. Concatenating the chunks gives the same bytes as
+    //!          pack(). The sink may e.g. write to a file or a socket.
+    //! \param sink Called as sink(data, size) for each chunk
+    //! \param chunkSize Number of bytes to collect before calling the sink
+    //! \param data Classes to serialize
+    //! \return Total number of bytes passed to the sink
+    template<class... Args>
+    std::size_t packStream(const Sink& sink,
+                           const std::size_t chunkSize,
+                           const Args&... data)
+    {
+        m_op = Operation::PACK;
+        m_grow = true;
+        m_sink = &sink;
+        m_chunkSize = std::max(chunkSize, std::size_t{1});
+        m_position = 0;
+        m_packSize = 0;
+        m_buffer.clear();
+        variadic_call(data...);
+        m_chunkSize = 0;
+        flushBuffer();
+        m_sink = nullptr;
+        m_grow = false;
+        return m_packSize;
+    }
+
     //! \brief Call this to de-serialize data.
     //! \tparam T Type of class to de-serialize
     //! \param data Class to de-serialize
@@ -217,7 +277,9 @@ protected:
               m_packSize += m_packer.packSize(data.data(), data.size());
           } else if (m_op == Operation::PACK) {
               (*this)(data.size());
+              growBuffer(m_packer.packSize(data.data(), data.size()));
               m_packer.pack(getVectorData(data), data.size(), m_buffer, m_position);
+              flushBuffer();
           } else if (m_op == Operation::UNPACK) {
               std::size_t size = 0;
               (*this)(size);
@@ -273,8 +335,11 @@ protected:
         if constexpr (std::is_pod_v<T>) {
             if (m_op == Operation::PACKSIZE)
                 m_packSize += m_packer.packSize(getVectorData(data), data.size());
-            else if (m_op == Operation::PACK)
+            else if (m_op == Operation::PACK) {
+                growBuffer(m_packer.packSize(getVectorData(data), data.size()));
                 m_packer.pack(getVectorData(data), data.size(), m_buffer, m_position);
+                flushBuffer();
+            }
             else if (m_op == Operation::UNPACK) {
                 auto& data_mut = const_cast<Array&>(data);
                 m_packer.unpack(getVectorData(data_mut), data_mut.size(), m_buffer, m_position);
@@ -540,6 +605,29 @@ protected:
         T, std::void_t<decltype(std::declval<T>().serializeOp(std::declval<Serializer<Packer>&>()))>
     > : public std::true_type {};
 
+    //! \brief Makes room for size more bytes when growing the buffer on the fly.
+    void growBuffer(const std::size_t size)
+    {
+        if (!m_grow)
+            return;
+
+        const std::size_t required = m_position + size;
+        if (required > m_buffer.size())
+            m_buffer.resize(std::max({required, 2*m_buffer.size(), std::size_t{4096}}));
+    }
+
+    //! \brief Hands the packed data to the sink once a chunk is complete.
+    void flushBuffer()
+    {
+        if (m_sink == nullptr || static_cast<std::size_t>(m_position) < m_chunkSize)
+            return;
+
+        if (m_position > 0)
+            (*m_sink)(m_buffer.data(), m_position);
+        m_packSize += m_position;
+        m_position = 0;
+    }
+
     //! \brief Handler for smart pointers.
     template<class PtrType>
     void ptr(const PtrType& data)
@@ -560,6 +648,9 @@ protected:
     size_t m_packSize = 0; //!< Required buffer size after PACKSIZE has been done
     int m_position = 0; //!< Current position in buffer
     std::vector<char> m_buffer; //!< Buffer for serialized data
+    bool m_grow = false; //!< True to grow the buffer while packing
+    const Sink* m_sink = nullptr; //!< Sink receiving packed chunks, if any
+    std::size_t m_chunkSize = 0; //!< Chunk size for the sink
 };
 
 }
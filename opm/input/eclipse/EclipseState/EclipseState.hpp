@@ -49,6 +49,10 @@ namespace Opm {
     class DeckSection;
 } // namespace Opm
 
+namespace Opm { namespace Timing {
+    class Scope;
+}} // namespace Opm::Timing
+
 namespace Opm { namespace RestartIO {
     class RstAquifer;
     class RstNetwork;
@@ -155,6 +159,11 @@ namespace Opm {
 
 
     private:
+        // The timer is opened by the public constructor before the data
+        // members are built, so that their construction is timed as part
+        // of the EclipseState.
+        EclipseState(Timing::Scope&& timer, const Deck& deck);
+
         void initIOConfigPostSchedule(const Deck& deck);
         void assignRunTitle(const Deck& deck);
         void reportNumberOfActivePhases() const;
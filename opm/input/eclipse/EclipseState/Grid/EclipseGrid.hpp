@@ -40,6 +40,7 @@ namespace Opm {
     struct NNCdata;
     class UnitSystem;
     class ZcornMapper;
+    namespace Timing { class Scope; }
 
     /**
        About cell information and dimension: The actual grid
@@ -193,6 +194,24 @@ namespace Opm {
         double getCellDepth(size_t globalIndex) const;
         ZcornMapper zcornMapper() const;
 
+        /*
+          The geometry cache holds the center, dimensions, depth and
+          volume of all active cells. It is computed in one parallel pass
+          over the cells and thereafter used by getCellCenter(),
+          getCellDims(), getCellThickness(), getCellDepth() and
+          getCellVolume() for active cells, instead of recomputing the
+          cell corners from COORD and ZCORN on every call. The cache is
+          discarded when ACTNUM or ZCORN changes.
+
+          With single_precision the values are stored as float, which
+          halves the memory of the cache; the getters will then return
+          values rounded to float precision.  The activeVolume() vector
+          is filled in full double precision in both modes.
+        */
+        void cacheGeometry(bool single_precision = false) const;
+        bool hasGeometryCache() const;
+        void clearGeometryCache() const;
+
         const std::vector<double>& getCOORD() const;
         const std::vector<double>& getZCORN() const;
         const std::vector<int>& getACTNUM( ) const;
@@ -207,6 +226,38 @@ namespace Opm {
         size_t fixupZCORN();
         size_t getZcornFixed() { return zcorn_fixed; };
 
+        /*
+          The compactStorage() method will replace the double precision
+          COORD and ZCORN arrays with a compact representation which needs
+          roughly half the memory:
+
+            ZCORN: Each value is stored as a float offset from the smallest
+              ZCORN value on the same pillar, which is kept in double
+              precision.
+
+            COORD: The top point of each pillar is kept in double precision
+              and the bottom point is stored as a float offset from the top
+              point.
+
+          The cell corners are reconstructed on the fly. Rounding to float
+          gives a relative error of at most 2^-24, i.e. a reconstructed
+          ZCORN value differs from the original by less than 6e-8 times the
+          depth span of its pillar, and a COORD bottom point by less than
+          6e-8 times the pillar length. The maximum error is measured when
+          compacting, and the grid is left unchanged if it exceeds the
+          tolerance (in SI units); e.g. pillars with undefined points at
+          1e20 will not be compacted. The return value tells whether the
+          compact storage is in use.
+
+          The expandStorage() method, which is also called by
+          fixupZCORN(), restores the full double precision arrays. The
+          getCOORD() and getZCORN() methods will throw std::logic_error
+          while the grid is in compact storage mode.
+        */
+        bool compactStorage(double tolerance = 1.0e-4);
+        bool hasCompactStorage() const;
+        void expandStorage();
+
         // resetACTNUM with no arguments will make all cells in the grid active.
 
         void resetACTNUM();
@@ -226,6 +277,11 @@ namespace Opm {
         static bool allEqual(const std::vector<double> &v);
 
     private:
+        // The timer is opened by the public constructor before the data
+        // members are built, so that their construction is timed as part
+        // of the EclipseGrid.
+        EclipseGrid(Timing::Scope&& timer, const Deck& deck, const int* actnum);
+
         std::vector<double> m_minpvVector;
         MinpvMode m_minpvMode;
         std::optional<double> m_pinch;
@@ -236,6 +292,20 @@ namespace Opm {
 
         mutable std::optional<std::vector<double>> active_volume;
 
+        struct GeometryCache {
+            enum Field { CenterX, CenterY, CenterZ, DimX, DimY, DimZ, Depth, Volume, NumFields };
+
+            std::vector<double> values;
+            std::vector<float> single_values;
+
+            double get(size_t active_index, Field field) const {
+                const auto index = active_index*NumFields + field;
+                return this->single_values.empty() ? this->values[index] : this->single_values[index];
+            }
+        };
+
+        mutable std::optional<GeometryCache> m_geometry;
+
         bool m_circle = false;
 
         size_t zcorn_fixed = 0;
@@ -248,6 +318,23 @@ namespace Opm {
         std::vector<double> m_zcorn;
         std::vector<double> m_coord;
 
+        // Compact representation of COORD and ZCORN, see compactStorage().
+        struct CompactCornerData {
+            std::vector<double> pillar_top;
+            std::vector<float> pillar_bottom;
+            std::vector<double> zcorn_origin;
+            std::vector<float> zcorn_offset;
+
+            static CompactCornerData compress(const std::array<int, 3>& dims,
+                                              const std::vector<double>& coord,
+                                              const std::vector<double>& zcorn);
+            std::vector<double> coord() const;
+            std::vector<double> zcorn(const std::array<int, 3>& dims) const;
+        };
+
+        std::optional<CompactCornerData> m_compact;
+        mutable std::optional<CompactCornerData> m_compact_input;
+
 
         std::vector<int> m_actnum;
         std::optional<MapAxes> m_mapaxes;
@@ -267,6 +354,11 @@ namespace Opm {
 
         void updateNumericalAquiferCells(const Deck&);
         double computeCellGeometricDepth(size_t globalIndex) const;
+        double computeCellVolume(size_t globalIndex,
+                                 const std::array<double,8>& X,
+                                 const std::array<double,8>& Y,
+                                 const std::array<double,8>& Z) const;
+        const GeometryCache* cachedGeometry(size_t globalIndex, size_t& active_index) const;
 
         void initGridFromEGridFile(Opm::EclIO::EclFile& egridfile, std::string fileName);
         void resetACTNUM( const int* actnum);
@@ -51,6 +51,7 @@ namespace Opm {
 class Deck;
 class EclipseGrid;
 class NumericalAquifers;
+namespace Timing { class Scope; }
 
 namespace Fieldprops
 {
@@ -541,6 +542,11 @@ public:
     std::vector<std::string> fip_regions() const;
 
 private:
+    // The timer is opened by the public constructor before the data
+    // members are built, so that the cell volume and depth extraction is
+    // timed as part of the FieldProps.
+    FieldProps(Timing::Scope&& timer, const Deck& deck, const Phases& phases, const EclipseGrid& grid, const TableManager& table_arg);
+
     void scanGRIDSection(const GRIDSection& grid_section);
     void scanGRIDSectionOnlyACTNUM(const GRIDSection& grid_section);
     void scanEDITSection(const EDITSection& edit_section);
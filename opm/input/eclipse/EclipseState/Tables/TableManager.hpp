@@ -59,6 +59,10 @@
 #include <opm/input/eclipse/EclipseState/Tables/TLMixpar.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/Ppcwmax.hpp>
 
+namespace Opm { namespace Timing {
+    class Scope;
+}} // namespace Opm::Timing
+
 namespace Opm {
 
     class Deck;
@@ -287,6 +291,11 @@ namespace Opm {
         }
 
     private:
+        // The timer is opened by the public constructor before the data
+        // members are built, so that their construction is timed as part
+        // of the TableManager.
+        TableManager(Timing::Scope&& timer, const Deck& deck);
+
         TableContainer& forceGetTables( const std::string& tableName , size_t numTables);
 
         void complainAboutAmbiguousKeyword(const Deck& deck, const std::string& keywordName);
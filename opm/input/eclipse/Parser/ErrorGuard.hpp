@@ -21,6 +21,7 @@
 #ifndef ERROR_GUARD_HPP
 #define ERROR_GUARD_HPP
 
+#include <iosfwd>
 #include <string>
 #include <vector>
 
@@ -42,6 +43,7 @@ public:
     ~ErrorGuard();
     void terminate() const;
     void dump() const;
+    void dump(std::ostream& os) const;
 
 private:
 
@@ -96,6 +96,15 @@ class KeywordLocation;
         void update(InputErrorAction action);
         void update(const std::string& keyString , InputErrorAction action);
         void ignoreKeyword(const std::string& keyword);
+        /*
+          With lazy schedule loading the Schedule constructor only processes
+          the SCHEDULE section up to and including the first simulated report
+          step, and the remaining report steps are loaded on demand. See the
+          Schedule class for details. The default is to load the complete
+          SCHEDULE section up front.
+        */
+        void setLazyScheduleLoading(bool lazy);
+        bool lazyScheduleLoading() const;
         InputErrorAction get(const std::string& key) const;
         std::map<std::string,InputErrorAction>::const_iterator begin() const;
         std::map<std::string,InputErrorAction>::const_iterator end() const;
@@ -375,6 +384,14 @@ class KeywordLocation;
         const static std::string SIMULATOR_KEYWORD_ITEM_NOT_SUPPORTED;
         const static std::string SIMULATOR_KEYWORD_ITEM_NOT_SUPPORTED_CRITICAL;
 
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(m_errorContexts);
+            serializer(ignore_keywords);
+            serializer(lazy_schedule_loading);
+        }
+
     private:
         void initDefault();
         void initEnv();
@@ -383,6 +400,7 @@ class KeywordLocation;
 
         std::map<std::string , InputErrorAction> m_errorContexts;
         std::set<std::string> ignore_keywords;
+        bool lazy_schedule_loading = false;
     };
 }
 
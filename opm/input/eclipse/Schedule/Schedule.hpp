@@ -32,6 +32,9 @@
 #include <utility>
 #include <vector>
 
+#include <opm/common/OpmLog/KeywordLocation.hpp>
+
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Schedule/Action/WGNames.hpp>
 #include <opm/input/eclipse/Schedule/CompletedCells.hpp>
 #include <opm/input/eclipse/Schedule/Group/Group.hpp>
@@ -63,8 +66,6 @@ namespace Opm
     class GuideRateConfig;
     class GuideRateModel;
     class HandlerContext;
-    enum class InputErrorAction;
-    class ParseContext;
     class Python;
     class Runspec;
     class RPTConfig;
@@ -84,10 +85,11 @@ namespace Opm
     class WellTestConfig;
 
     namespace RestartIO { struct RstState; }
+    namespace Timing { class Scope; }
 
     class Schedule {
     public:
-        Schedule() = default;
+        Schedule();
         explicit Schedule(std::shared_ptr<const Python> python_handle);
         Schedule(const Deck& deck,
                  const EclipseGrid& grid,
@@ -150,8 +152,34 @@ namespace Opm
                  const std::optional<int>& output_interval = {},
                  const RestartIO::RstState* rst = nullptr);
 
+        Schedule(const Schedule& other);
+        Schedule(Schedule&& other);
+        ~Schedule();
+
+        Schedule& operator=(const Schedule& other);
+        Schedule& operator=(Schedule&& other);
+
         static Schedule serializationTestObject();
 
+        /*
+          By default the constructor internalizes the complete SCHEDULE
+          section. With ParseContext::setLazyScheduleLoading(true) the
+          constructor only processes the report steps up to and including
+          the first simulated report step, and the remaining ScheduleState
+          snapshots are materialized on demand when they are requested through
+          the public API - e.g. sched[report_step] or getWells(report_step).
+          Queries which need the final state, like getWellsatEnd() or end(),
+          will load the rest of the Schedule section. For a restarted run
+          the iteration starts at the restart step. Serialization transfers
+          the report steps which are not yet loaded as part of the schedule
+          deck, and the receiving side loads them on demand as well.
+
+          The Schedule does not refer to the EclipseGrid and FieldPropsManager
+          instances passed to the constructor after construction, also not in
+          lazy mode.
+        */
+        std::size_t numLoadedSteps() const;
+
         /*
          * If the input deck does not specify a start time, Eclipse's 1. Jan
          * 1983 is defaulted
@@ -226,6 +254,24 @@ namespace Opm
         void filterConnections(const ActiveGridCells& grid);
         std::size_t size() const;
 
+        /*
+          Approximate memory used by the wells, groups and VFP tables of all
+          the snapshots. Objects and internal map nodes which are shared
+          between snapshots are counted only once, so the sum is a measure of
+          the memory actually held by the Schedule for these members.
+        */
+        struct MemoryUsage {
+            std::size_t snapshots{0};
+            utility::PersistentMapMemoryUsage wells{};
+            utility::PersistentMapMemoryUsage groups{};
+            utility::PersistentMapMemoryUsage vfpprod{};
+            utility::PersistentMapMemoryUsage vfpinj{};
+
+            utility::PersistentMapMemoryUsage total() const;
+        };
+
+        MemoryUsage memory_usage() const;
+
         bool write_rst_file(std::size_t report_step) const;
         const std::map< std::string, int >& rst_keywords( size_t timestep ) const;
 
@@ -274,6 +320,10 @@ namespace Opm
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
+            // The report steps which are not yet loaded are loaded on the
+            // receiving side from the serialized schedule deck.
+            auto tail = serializer.isSerializing() ? this->lazyTail() : LazyTail{};
+            serializer(tail);
             serializer(this->m_static);
             serializer(this->m_sched_deck);
             serializer(this->action_wgnames);
@@ -307,130 +357,211 @@ namespace Opm
             this->template pack_unpack_map<int, VFPInjTable>(serializer);
             this->template pack_unpack_map<std::string, Group>(serializer);
             this->template pack_unpack_map<std::string, Well>(serializer);
+
+            if (! serializer.isSerializing())
+                this->resumeLazyLoading(std::move(tail));
         }
 
+        /*
+          The ptr_member and map_member objects are serialized as a list of
+          distinct objects and a list of runs. Each run gives the first
+          report step of the run and the position of its object in the
+          object list; the object is shared by all report steps up to the
+          next run. Objects which are shared (same shared_ptr) with an
+          earlier report step, or which compare equal to the object of the
+          previous report step, are not emitted again but referenced, and
+          that sharing is restored when unpacking.
+        */
         template <typename T, class Serializer>
         void pack_unpack(Serializer& serializer) {
-            std::vector<T> value_list;
             std::vector<std::size_t> index_list;
-
-            if (serializer.isSerializing())
-                this->template pack_state<T>(value_list, index_list);
-
-            serializer(value_list);
-            serializer(index_list);
-
-            if (!serializer.isSerializing())
-                this->template unpack_state<T>(value_list, index_list);
+            std::vector<std::size_t> value_index;
+
+            if (serializer.isSerializing()) {
+                std::vector<const T*> value_list;
+                this->template pack_state<T>(value_list, index_list, value_index);
+
+                pack_values(serializer, value_list);
+                serializer(index_list);
+                serializer(value_index);
+            } else {
+                std::vector<T> value_list;
+                serializer(value_list);
+                serializer(index_list);
+                serializer(value_index);
+
+                this->template unpack_state<T>(value_list, index_list, value_index);
+            }
         }
 
+        /*
+          The value of the ptr_member at each report step where it changes,
+          taken from the same tables as the serialization. All the report
+          steps are loaded.
+        */
         template <typename T>
         std::vector<std::pair<std::size_t,  T>> unique() const {
+            this->materializeAll();
+
+            std::vector<const T*> value_list;
+            std::vector<std::size_t> index_list;
+            std::vector<std::size_t> value_index;
+            this->template pack_state<T>(value_list, index_list, value_index);
+
             std::vector<std::pair<std::size_t, T>> values;
-            for (std::size_t index = 0; index < this->snapshots.size(); index++) {
-                const auto& member = this->snapshots[index].get<T>();
-                const auto& value = member.get();
-                if (values.empty() || !(value == values.back().second))
-                    values.push_back( std::make_pair(index, value));
-            }
+            values.reserve(index_list.size());
+            for (std::size_t run = 0; run < index_list.size(); run++)
+                values.emplace_back(index_list[run], *value_list[value_index[run]]);
+
             return values;
         }
 
-
         template <typename T>
-        void pack_state(std::vector<T>& value_list, std::vector<std::size_t>& index_list) const {
-            auto unique_values = this->template unique<T>();
-            for (auto& [index, value] : unique_values) {
-                value_list.push_back( std::move(value) );
-                index_list.push_back( index );
+        void pack_state(std::vector<const T*>& value_list,
+                        std::vector<std::size_t>& index_list,
+                        std::vector<std::size_t>& value_index) const {
+            std::unordered_map<const T*, std::size_t> seen;
+            const T* current = nullptr;
+            for (std::size_t index = 0; index < this->snapshots.size(); index++) {
+                const T* value = &this->snapshots[index].get<T>().get();
+                if (value == current)
+                    continue;
+
+                if ((current != nullptr) && (*value == *current)) {
+                    seen.emplace(value, seen.at(current));
+                    current = value;
+                    continue;
+                }
+
+                auto [pos, inserted] = seen.emplace(value, value_list.size());
+                if (inserted)
+                    value_list.push_back(value);
+
+                index_list.push_back(index);
+                value_index.push_back(pos->second);
+                current = value;
             }
         }
 
 
         template <typename T>
-        void unpack_state(const std::vector<T>& value_list, const std::vector<std::size_t>& index_list) {
-            std::size_t unique_index = 0;
-            while (unique_index < value_list.size()) {
-                const auto& value = value_list[unique_index];
-                const auto& first_index = index_list[unique_index];
-                auto last_index = this->snapshots.size();
-                if (unique_index < (value_list.size() - 1))
-                    last_index = index_list[unique_index + 1];
+        void unpack_state(std::vector<T>& value_list,
+                          const std::vector<std::size_t>& index_list,
+                          const std::vector<std::size_t>& value_index) {
+            // First report step holding each object after unpacking.
+            std::vector<std::size_t> origin(value_list.size(), this->snapshots.size());
+
+            for (std::size_t run = 0; run < index_list.size(); run++) {
+                const auto first_index = index_list[run];
+                const auto last_index = (run + 1 < index_list.size())
+                    ? index_list[run + 1] : this->snapshots.size();
 
                 auto& target_state = this->snapshots[first_index];
-                target_state.get<T>().update( std::move(value) );
+                const auto value = value_index[run];
+                if (origin[value] == this->snapshots.size()) {
+                    target_state.get<T>().update( std::move(value_list[value]) );
+                    origin[value] = first_index;
+                }
+                else
+                    target_state.get<T>().update( this->snapshots[origin[value]].get<T>() );
+
                 for (std::size_t index=first_index + 1; index < last_index; index++)
                     this->snapshots[index].get<T>().update( target_state.get<T>() );
-
-                unique_index++;
             }
         }
 
 
         template <typename K, typename T, class Serializer>
         void pack_unpack_map(Serializer& serializer) {
-            std::vector<T> value_list;
             std::vector<std::size_t> index_list;
-
-            if (serializer.isSerializing())
-                pack_map<K,T>(value_list, index_list);
-
-            serializer(value_list);
-            serializer(index_list);
-
-            if (!serializer.isSerializing())
-                unpack_map<K,T>(value_list, index_list);
+            std::vector<std::size_t> value_index;
+
+            if (serializer.isSerializing()) {
+                std::vector<const T*> value_list;
+                pack_map<K,T>(value_list, index_list, value_index);
+
+                pack_values(serializer, value_list);
+                serializer(index_list);
+                serializer(value_index);
+            } else {
+                std::vector<T> value_list;
+                serializer(value_list);
+                serializer(index_list);
+                serializer(value_index);
+
+                unpack_map<K,T>(value_list, index_list, value_index);
+            }
         }
 
 
         template <typename K, typename T>
-        void pack_map(std::vector<T>& value_list,
-                      std::vector<std::size_t>& index_list) {
+        void pack_map(std::vector<const T*>& value_list,
+                      std::vector<std::size_t>& index_list,
+                      std::vector<std::size_t>& value_index) {
 
             const auto& last_map = this->snapshots.back().get_map<K,T>();
             std::vector<K> key_list{ last_map.keys() };
-            std::unordered_map<K,T> current_value;
+            std::unordered_map<K, const T*> current_value;
+            std::unordered_map<const T*, std::size_t> seen;
 
             for (std::size_t index = 0; index < this->snapshots.size(); index++) {
-                auto& state = this->snapshots[index];
-                const auto& current_map = state.template get_map<K,T>();
+                const auto& current_map = this->snapshots[index].template get_map<K,T>();
                 for (const auto& key : key_list) {
-                    auto& value = current_map.get_ptr(key);
-                    if (value) {
-                        auto it = current_value.find(key);
-                        if (it == current_value.end() || !(*value == it->second)) {
-                            value_list.push_back( *value );
-                            index_list.push_back( index );
-
-                            current_value[key] = *value;
-                        }
+                    const auto& value_ptr = current_map.get_ptr(key);
+                    if (!value_ptr)
+                        continue;
+
+                    const T* value = value_ptr.get();
+                    auto& current = current_value[key];
+                    if (value == current)
+                        continue;
+
+                    if ((current != nullptr) && (*value == *current)) {
+                        seen.emplace(value, seen.at(current));
+                        current = value;
+                        continue;
                     }
+
+                    auto [pos, inserted] = seen.emplace(value, value_list.size());
+                    if (inserted)
+                        value_list.push_back(value);
+
+                    index_list.push_back(index);
+                    value_index.push_back(pos->second);
+                    current = value;
                 }
             }
         }
 
 
         template <typename K, typename T>
-        void unpack_map(const std::vector<T>& value_list,
-                        const std::vector<std::size_t>& index_list) {
-
-            std::unordered_map<K, std::vector<std::pair<std::size_t, T>>> storage;
-            for (std::size_t storage_index = 0; storage_index < value_list.size(); storage_index++) {
-                const auto& value = value_list[storage_index];
-                const auto& time_index = index_list[storage_index];
-
-                storage[ value.name() ].emplace_back( time_index, value );
+        void unpack_map(std::vector<T>& value_list,
+                        const std::vector<std::size_t>& index_list,
+                        const std::vector<std::size_t>& value_index) {
+
+            // Runs of each key as (first report step, object position).
+            std::unordered_map<K, std::vector<std::pair<std::size_t, std::size_t>>> storage;
+            for (std::size_t run = 0; run < index_list.size(); run++) {
+                const auto value = value_index[run];
+                storage[ value_list[value].name() ].emplace_back( index_list[run], value );
             }
 
-            for (const auto& [key, values] : storage) {
-                for (std::size_t unique_index = 0; unique_index < values.size(); unique_index++) {
-                    const auto& [time_index, value] = values[unique_index];
-                    auto last_index = this->snapshots.size();
-                    if (unique_index < (values.size() - 1))
-                        last_index = values[unique_index + 1].first;
+            // First report step holding each object after unpacking.
+            std::vector<std::size_t> origin(value_list.size(), this->snapshots.size());
+
+            for (const auto& [key, runs] : storage) {
+                for (std::size_t run = 0; run < runs.size(); run++) {
+                    const auto& [time_index, value] = runs[run];
+                    const auto last_index = (run + 1 < runs.size())
+                        ? runs[run + 1].first : this->snapshots.size();
 
                     auto& map_value = this->snapshots[time_index].template get_map<K,T>();
-                    map_value.update(std::move(value));
+                    if (origin[value] == this->snapshots.size()) {
+                        map_value.update(std::move(value_list[value]));
+                        origin[value] = time_index;
+                    }
+                    else
+                        map_value.update(key, this->snapshots[origin[value]].template get_map<K,T>());
 
                     for (std::size_t index=time_index + 1; index < last_index; index++) {
                         auto& forward_map = this->snapshots[index].template get_map<K,T>();
@@ -440,12 +571,36 @@ namespace Opm
             }
         }
 
+
+        //! Serializes the pointed-to objects in the same format as a std::vector<T>.
+        template <typename T, class Serializer>
+        static void pack_values(Serializer& serializer, const std::vector<const T*>& value_list) {
+            serializer(value_list.size());
+            for (const auto* value : value_list)
+                serializer(*value);
+        }
+
         friend std::ostream& operator<<(std::ostream& os, const Schedule& sched);
         void dump_deck(std::ostream& os) const;
 
     private:
         friend class HandlerContext;
 
+        // The timer is opened by the public constructor before the data
+        // members are built, so that their construction is timed as part
+        // of the Schedule.
+        Schedule(Timing::Scope&& timer,
+                 const Deck& deck,
+                 const EclipseGrid& grid,
+                 const FieldPropsManager& fp,
+                 const Runspec &runspec,
+                 const ParseContext& parseContext,
+                 ErrorGuard& errors,
+                 std::shared_ptr<const Python> python,
+                 const std::optional<int>& output_interval,
+                 const RestartIO::RstState* rst,
+                 const TracerConfig* tracer_config);
+
         // Please update the member functions
         //   - operator==(const Schedule&) const
         //   - serializationTestObject()
@@ -459,6 +614,49 @@ namespace Opm
         WriteRestartFileEvents restart_output;
         CompletedCells completed_cells;
 
+        // Set while report steps remain to be loaded in lazy mode. The
+        // loader owns the report steps which are not yet loaded, and loads
+        // them into this Schedule - also from const member functions.
+        class LazyLoader;
+        std::unique_ptr<LazyLoader> m_lazy;
+
+        // The state needed to continue lazy loading after deserialization.
+        struct LazyTail
+        {
+            bool active{false};
+            ParseContext parse_context{};
+            std::vector<std::pair<std::string, KeywordLocation>> welsegs_wells{};
+            std::set<std::string> compsegs_wells{};
+            std::optional<std::unordered_map<std::string, double>> target_wellpi{};
+
+            template<class Serializer>
+            void serializeOp(Serializer& serializer)
+            {
+                serializer(this->active);
+                if (! this->active)
+                    return;
+
+                serializer(this->parse_context);
+                serializer(this->welsegs_wells);
+                serializer(this->compsegs_wells);
+                serializer(this->target_wellpi);
+            }
+        };
+
+        void materialize(std::size_t report_step) const;
+        void materializeAll() const;
+        LazyTail lazyTail() const;
+        void resumeLazyLoading(LazyTail&& tail);
+        void skipToRestart(std::size_t restart_step,
+                           const ParseContext& parseContext,
+                           ErrorGuard& errors,
+                           const ScheduleGrid& grid);
+
+        // Access to the snapshots by report step, loading them if needed.
+        const ScheduleState& snapshot(std::size_t report_step) const;
+        ScheduleState& snapshot(std::size_t report_step);
+        void updateLastSnapshot(const std::function<void(ScheduleState&)>& update);
+
         void load_rst(const RestartIO::RstState& rst,
                       const TracerConfig& tracer_config,
                       const ScheduleGrid& grid,
@@ -491,7 +689,9 @@ namespace Opm
                                     const ScheduleGrid& grid,
                                     const std::unordered_map<std::string, double> * target_wellpi,
                                     const std::string& prefix,
-                                    const bool log_to_debug = false);
+                                    const bool log_to_debug = false,
+                                    WelSegsSet* welsegs_wells = nullptr,
+                                    std::set<std::string>* compsegs_wells = nullptr);
         void addACTIONX(const Action::ActionX& action);
         void addGroupToGroup( const std::string& parent_group, const std::string& child_group);
         void addGroup(const std::string& groupName , std::size_t timeStep);
@@ -517,7 +717,7 @@ namespace Opm
                            WelSegsSet* welsegs_wells = nullptr,
                            std::set<std::string>* compsegs_wells = nullptr);
 
-        void prefetch_cell_properties(const ScheduleGrid& grid, const DeckKeyword& keyword);
+        static void prefetch_cell_properties(const ScheduleGrid& grid, const DeckKeyword& keyword);
         void store_wgnames(const DeckKeyword& keyword);
         std::vector<std::string> wellNames(const std::string& pattern,
                                            const HandlerContext& context,
@@ -21,6 +21,7 @@
 #define SCHEDULE_TSTEP_HPP
 
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/common/utility/PersistentMap.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/input/eclipse/EclipseState/Runspec.hpp>
@@ -43,6 +44,7 @@
 #include <optional>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 namespace {
@@ -154,6 +156,11 @@ namespace Opm {
               const K& T::name() const;
 
           Which is used to get the storage key for the objects.
+
+          The map itself is a persistent map, so copying a map_member from
+          one snapshot to the next is O(1) and updating a single object in
+          the new snapshot only copies O(log n) internal nodes; all other
+          nodes are shared with the previous snapshot.
          */
 
         template <typename K, typename T>
@@ -177,29 +184,28 @@ namespace Opm {
 
 
             const std::shared_ptr<T> get_ptr(const K& key) const {
-                auto iter = this->m_data.find(key);
-                if (iter != this->m_data.end())
-                    return iter->second;
+                const auto* ptr = this->m_data.find(key);
+                if (ptr != nullptr)
+                    return *ptr;
 
                 return {};
             }
 
 
             bool has(const K& key) const {
-                auto ptr = this->get_ptr(key);
-                return (ptr != nullptr);
+                return this->m_data.contains(key);
             }
 
 
             void update(T object) {
                 auto key = object.name();
-                this->m_data[key] = std::make_shared<T>( std::move(object) );
+                this->m_data.insert_or_assign(key, std::make_shared<T>( std::move(object) ));
             }
 
             void update(const K& key, const map_member<K,T>& other) {
                 auto other_ptr = other.get_ptr(key);
                 if (other_ptr)
-                    this->m_data[key] = other.get_ptr(key);
+                    this->m_data.insert_or_assign(key, std::move(other_ptr));
                 else
                     throw std::logic_error(std::string{"Tried to update member: "} + as_string(key) + std::string{"with uninitialized object"});
             }
@@ -257,26 +263,43 @@ namespace Opm {
                 return this->m_data.size();
             }
 
-            typename std::unordered_map<K, std::shared_ptr<T>>::const_iterator begin() const {
+            typename utility::PersistentMap<K, std::shared_ptr<T>>::const_iterator begin() const {
                 return this->m_data.begin();
             }
 
-            typename std::unordered_map<K, std::shared_ptr<T>>::const_iterator end() const {
+            typename utility::PersistentMap<K, std::shared_ptr<T>>::const_iterator end() const {
                 return this->m_data.end();
             }
 
+            /*
+              Accumulates the memory used by this map's internal nodes and
+              by the objects it references, skipping nodes and objects
+              which are already in @seen, i.e., which are shared with maps
+              that have already been accounted for.
+            */
+            void memory_usage(std::unordered_set<const void*>& seen,
+                              utility::PersistentMapMemoryUsage& usage) const {
+                this->m_data.accumulateMemoryUsage(seen, usage, [&seen, &usage](const auto& elm)
+                {
+                    if (seen.insert(elm.second.get()).second) {
+                        usage.objects += 1;
+                        usage.bytes += sizeof(T);
+                    }
+                });
+            }
+
 
             static map_member<K,T> serializationTestObject() {
                 map_member<K,T> map_object;
                 T value_object = T::serializationTestObject();
                 K key = value_object.name();
-                map_object.m_data.emplace( key, std::make_shared<T>( std::move(value_object) ));
+                map_object.m_data.insert_or_assign( key, std::make_shared<T>( std::move(value_object) ));
                 return map_object;
             }
 
 
         private:
-            std::unordered_map<K, std::shared_ptr<T>> m_data;
+            utility::PersistentMap<K, std::shared_ptr<T>> m_data;
         };
 
         struct BHPDefaults {
@@ -308,6 +331,14 @@ namespace Opm {
         ScheduleState(const ScheduleState& src, const time_point& start_time);
         ScheduleState(const ScheduleState& src, const time_point& start_time, const time_point& end_time);
 
+        /// Start and end time of a report step as stored by the
+        /// constructors above.  The start time is rounded to whole
+        /// seconds, the end time only for the first report step.
+        static std::pair<time_point, time_point>
+        step_times(const time_point& start_time,
+                   const time_point& end_time,
+                   bool              first_step);
+
 
         time_point start_time() const;
         time_point end_time() const;
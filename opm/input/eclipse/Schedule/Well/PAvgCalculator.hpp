@@ -35,6 +35,7 @@ namespace Opm {
 class Connection;
 class GridDims;
 class PAvg;
+class PAvgCalculatorCollection;
 class PAvgDynamicSourceData;
 class WellConnections;
 
@@ -368,9 +369,26 @@ protected:
     Accumulator accumPV_{};
 
 private:
+    /// Batched calculation accesses the gathered source terms and the
+    /// individual calculation stages.
+    friend class PAvgCalculatorCollection;
+
     /// Type representing enumeration of locally contributing cells.
     using ContrIndexType = std::vector<std::size_t>::size_type;
 
+    /// Dynamic source terms of a single contributing cell.
+    struct BlockSource
+    {
+        /// Dynamic pressure value.
+        double pressure{};
+
+        /// Dynamic mixture density.
+        double density{};
+
+        /// Dynamic pore volume.
+        double porevol{};
+    };
+
     /// Type for translating (linearised) global cell indices to enumerated
     /// local, contributing cells.
     ///
@@ -438,6 +456,21 @@ private:
     /// to this block-average well pressure calculation.
     std::vector<std::size_t> contributingCells_{};
 
+    /// Stamp of the current contents of \c contributingCells_.
+    ///
+    /// Distinct between calculation objects and renewed whenever \c
+    /// contributingCells_ changes.  Enables \c PAvgCalculatorCollection to
+    /// detect stale cell structures without inspecting the cell lists.
+    std::size_t cellsStamp_{nextCellsStamp()};
+
+    /// Dynamic source terms of all contributing cells.
+    ///
+    /// Gathered once per call to \code inferBlockAveragePressures()
+    /// \endcode, in the order of \c contributingCells_, so each source
+    /// location is looked up only once irrespective of how many reservoir
+    /// connections it contributes to.
+    std::vector<BlockSource> blockSource_{};
+
     /// Well level pressure values derived from block-averaging procedures.
     ///
     /// Cached end result from \code inferBlockAveragePressures() \endcode.
@@ -460,6 +493,9 @@ private:
                        const Connection& conn,
                        SetupMap&         setupHelperMap);
 
+    /// Generate a new, previously unused, value for \c cellsStamp_.
+    static std::size_t nextCellsStamp();
+
     /// Top-level entry point for accumulating local WBP contributions.
     ///
     /// Will dispatch to lower-level entry points depending on control's
@@ -480,6 +516,31 @@ private:
                                       const double   gravity,
                                       const double   refDepth);
 
+    /// Copy dynamic source terms of all contributing cells into \c
+    /// blockSource_.
+    ///
+    /// \param[in] wellBlocks Cell-level raw data.
+    void gatherBlockSources(const PAvgDynamicSourceData& wellBlocks);
+
+    /// Accumulate local WBP contributions from previously gathered cell
+    /// level source terms in \c blockSource_.
+    ///
+    /// Writes to \c accumCTF_ and \c accumPV_.
+    ///
+    /// \param[in] sources Connection and cell-level raw data.  Only the
+    ///   connection level data is used.
+    ///
+    /// \param[in] controls Averaging procedure controls.
+    ///
+    /// \param[in] gravity Strength of gravity in SI units [m/s^2].
+    ///
+    /// \param[in] refDepth Well's reference depth for block-average
+    ///   pressure calculation.
+    void accumulateGatheredContributions(const Sources& sources,
+                                         const PAvg&    controls,
+                                         const double   gravity,
+                                         const double   refDepth);
+
     /// Communicate local contributions and collect global (off-rank)
     /// contributions.
     ///
@@ -583,14 +644,12 @@ private:
     ///   double w = weight(src)
     /// \endcode
     ///   is well formed for an object \c weight of type \p
-    ///   CTFPressureWeightFunction and a \c src object of type \code
-    ///   PAvgDynamicSourceData::SourceDataSpan<const double> \endcode.
+    ///   CTFPressureWeightFunction and a \c src object of type \c
+    ///   BlockSource.
     ///   Will typically be a lambda that returns the pore volume in \c src
     ///   if the weighting factor F1 in WPAVE is negative, or a lambda that
     ///   just returns the number one (1.0) otherwise.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] connDP Pressure correction term for each reservoir
@@ -602,8 +661,7 @@ private:
     /// \param[in] ctfPressWeight Pressure weighting method for CTF term's
     ///   individual contributions.
     template <typename ConnIndexMap, typename CTFPressureWeightFunction>
-    void accumulateLocalContributions(const Sources&             sources,
-                                      const PAvg&                controls,
+    void accumulateLocalContributions(const PAvg&                controls,
                                       const std::vector<double>& connDP,
                                       ConnIndexMap               connIndex,
                                       CTFPressureWeightFunction  ctfPressWeight);
@@ -630,8 +688,6 @@ private:
     ///   identity mapping \code [](i){return i} \endcode or the open
     ///   connection mapping \code [](i){return openConns_[i]} \endcode.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] connDP Pressure correction term for each reservoir
@@ -640,8 +696,7 @@ private:
     /// \param[in] connIndex Translation method from active connection index
     ///   to index into all known reservoir connections.
     template <typename ConnIndexMap>
-    void accumulateLocalContributions(const Sources&             sources,
-                                      const PAvg&                controls,
+    void accumulateLocalContributions(const PAvg&                controls,
                                       const std::vector<double>& connDP,
                                       ConnIndexMap&&             connIndex);
 
@@ -650,14 +705,11 @@ private:
     ///
     /// Invokes final dispatch level on set of open connections only.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] connDP Pressure correction term for each reservoir
     ///   connection.
-    void accumulateLocalContribOpen(const Sources&             sources,
-                                    const PAvg&                controls,
+    void accumulateLocalContribOpen(const PAvg&                controls,
                                     const std::vector<double>& connDP);
 
     /// First dispatch level before going to calculation routine which
@@ -665,14 +717,11 @@ private:
     ///
     /// Invokes final dispatch level on set of all known connections.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] connDP Pressure correction term for each reservoir
     ///   connection.
-    void accumulateLocalContribAll(const Sources&             sources,
-                                   const PAvg&                controls,
+    void accumulateLocalContribAll(const PAvg&                controls,
                                    const std::vector<double>& connDP);
 
     /// Compute pressure correction term/offset using Well method
@@ -732,8 +781,6 @@ private:
     ///
     /// \param[in] nconn Number of elements in active connection subset.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] gravity Strength of gravity in SI units [m/s^2].
     ///
     /// \param[in] refDepth Well's reference depth for block-average
@@ -747,7 +794,6 @@ private:
     template <typename ConnIndexMap>
     std::vector<double>
     connectionPressureOffsetRes(const std::size_t nconn,
-                                const Sources&    sources,
                                 const double      gravity,
                                 const double      refDepth,
                                 ConnIndexMap      connIndex) const;
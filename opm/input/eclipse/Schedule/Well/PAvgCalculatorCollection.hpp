@@ -28,7 +28,9 @@
 #include <vector>
 
 namespace Opm {
+    class PAvg;
     class PAvgCalculator;
+    class PAvgDynamicSourceData;
 } // namespace Opm
 
 namespace Opm {
@@ -56,6 +58,22 @@ public:
     using ActivePredicate = std::function<
         std::vector<bool>(const std::vector<std::size_t>&)>;
 
+    /// Per-well inputs to collection-wide block-average pressure
+    /// calculation.
+    struct WellInputs
+    {
+        /// Connection-level contributions for this well.  Calculation
+        /// object is skipped if null.
+        const PAvgDynamicSourceData* wellConns{nullptr};
+
+        /// Averaging procedure controls for this well.  Calculation object
+        /// is skipped if null.
+        const PAvg* controls{nullptr};
+
+        /// Well's reference depth for block-average pressure calculation.
+        double refDepth{};
+    };
+
     /// Default constructor.
     PAvgCalculatorCollection() = default;
 
@@ -125,6 +143,27 @@ public:
     /// Mainly intended to configure \c PAvgDynamicSourceData objects.
     std::vector<std::size_t> allWBPCells() const;
 
+    /// Compute block-average well-level pressure values for all WBPn
+    /// calculation objects in this collection.
+    ///
+    /// Equivalent to calling \code inferBlockAveragePressures() \endcode
+    /// on each calculation object in turn, but looks up each distinct
+    /// source location in \p wellBlocks only once and accumulates local
+    /// contributions of all wells concurrently.  Global contributions are
+    /// collected in calculation object order once all local contributions
+    /// are known.
+    ///
+    /// \param[in] wellBlocks Cell-level raw data for all source locations
+    ///   in \code allWBPCells() \endcode.
+    ///
+    /// \param[in] inputs Per-well inputs, indexed by calculation object
+    ///   index.  Must have \code numCalculators() \endcode elements.
+    ///
+    /// \param[in] gravity Strength of gravity in SI units [m/s^2].
+    void inferBlockAveragePressures(const PAvgDynamicSourceData& wellBlocks,
+                                    const std::vector<WellInputs>& inputs,
+                                    const double                   gravity);
+
 private:
     /// Representation of calculator indices.
     using CalcIndex = std::vector<CalculatorPtr>::size_type;
@@ -134,6 +173,30 @@ private:
 
     /// Collection of WBPn calculation objects.
     std::vector<CalculatorPtr> calculators_{};
+
+    /// Distinct source locations of all calculation objects, in sorted
+    /// order.  Formed on demand.
+    std::vector<std::size_t> uniqueCells_{};
+
+    /// Start pointers, in CSR format, into \c cellIndex_ for each
+    /// calculation object.
+    std::vector<std::vector<std::size_t>::size_type> cellStart_{};
+
+    /// Index into \c uniqueCells_ of each calculation object's source
+    /// locations, in the order of \code PAvgCalculator::allWBPCells()
+    /// \endcode.
+    std::vector<std::vector<std::size_t>::size_type> cellIndex_{};
+
+    /// Cell list stamp of each calculation object at the time the cell
+    /// structure was formed.  Empty if the cell structure must be rebuilt.
+    std::vector<std::size_t> cellsStamp_{};
+
+    /// Form \c uniqueCells_, \c cellStart_, and \c cellIndex_ from the
+    /// calculation objects' source locations, unless already current.
+    void buildCellStructure();
+
+    /// Discard cached cell structure.
+    void invalidateCellStructure();
 };
 
 } // namespace Opm
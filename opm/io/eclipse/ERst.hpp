@@ -21,6 +21,7 @@
 
 #include <opm/io/eclipse/EclFile.hpp>
 
+#include <cstddef>
 #include <ios>
 #include <map>
 #include <string>
@@ -64,6 +65,15 @@ public:
     template <typename T>
     const std::vector<T>& getRestartData(const std::string& name, int reportStepNumber, const std::string& lgr_name);
 
+    // Selected elements, e.g., the cells of a local partition, of a
+    // numeric restart array.  Element indices must be sorted.
+    template <typename T>
+    std::vector<T> getRestartDataElements(const std::string& name, int reportStepNumber,
+                                          const std::vector<std::size_t>& elements, int occurrence = 0)
+    {
+        return this->getElements<T>(getArrayIndex(name, reportStepNumber, occurrence), elements);
+    }
+
     template <typename T>
     const std::vector<T>& getRestartData(int index, int reportStepNumber, const std::string& lgr_name);
 
@@ -21,6 +21,7 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstddef>
 #include <ios>
 #include <map>
 #include <string>
@@ -68,6 +69,13 @@ public:
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    // Selected elements of an INTE, REAL or DOUB array.  Element indices
+    // must be sorted in increasing order.  For binary files that are not
+    // already loaded, only the data blocks holding the requested elements
+    // are read.
+    template <typename T>
+    std::vector<T> getElements(int arrIndex, const std::vector<std::size_t>& elements);
+
     bool hasKey(const std::string &name) const;
     std::size_t count(const std::string& name) const;
 
@@ -99,6 +107,12 @@ protected:
                                   const std::unordered_map<int, std::vector<T>>& array,
                                   const std::string& typeStr);
 
+    template<class T>
+    std::vector<T> getElementsImpl(int arrIndex, eclArrType type,
+                                   const std::unordered_map<int, std::vector<T>>& array,
+                                   const std::string& typeStr,
+                                   const std::vector<std::size_t>& elements);
+
     std::streampos
     seekPosition(const std::vector<std::string>::size_type arrIndex) const;
 
@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace Opm { namespace EclIO {
@@ -33,8 +34,15 @@ namespace Opm { namespace EclIO {
 class RestartFileView
 {
 public:
+    /// Constructor.
+    ///
+    /// \param[in] restart_file Restart file.
+    /// \param[in] report_step Report step of this view.
+    /// \param[in] preload Whether or not to load all arrays of the report
+    ///   step up front.  Otherwise arrays are loaded on first access.
     explicit RestartFileView(std::shared_ptr<ERst> restart_file,
-                             const int             report_step);
+                             const int             report_step,
+                             const bool            preload = true);
 
     ~RestartFileView();
 
@@ -56,6 +64,21 @@ public:
     const std::vector<ElmType>&
     getKeyword(const std::string& vector, const int occurrence = 0) const;
 
+    /// Number of elements in a vector, without loading its data.
+    std::size_t keywordSize(const std::string& vector) const;
+
+    /// Selected elements of a numeric (int, float or double) vector.
+    ///
+    /// Reads only the needed parts of the vector from binary restart
+    /// files unless the vector is already loaded.
+    ///
+    /// \param[in] elements Element indices.  Must be sorted.
+    template <typename ElmType>
+    std::vector<ElmType>
+    getKeywordElements(const std::string&              vector,
+                       const std::vector<std::size_t>& elements,
+                       const int                       occurrence = 0) const;
+
     const std::vector<int>& intehead() const;
     const std::vector<bool>& logihead() const;
     const std::vector<double>& doubhead() const;
@@ -0,0 +1,277 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \copydoc Opm::HermiteTabulated2DFunction
+ */
+#ifndef OPM_HERMITE_TABULATED_2D_FUNCTION_HPP
+#define OPM_HERMITE_TABULATED_2D_FUNCTION_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Implements a scalar function of two variables which is sampled together with
+ *        its partial derivatives on an uniform X-Y grid.
+ *
+ * The function is interpolated by bicubic Hermite polynomials, i.e., the interpolant
+ * and its first derivatives are continuous. This makes it suitable as a replacement of
+ * expensive correlations inside a Newton solver. The derivatives at the sampling points
+ * are obtained by evaluating the sampled function with automatic differentiation, the
+ * mixed second derivative is approximated by finite differences.
+ */
+template <class Scalar>
+class HermiteTabulated2DFunction
+{
+public:
+    HermiteTabulated2DFunction() = default;
+
+    HermiteTabulated2DFunction(Scalar minX, Scalar maxX, unsigned m,
+                               Scalar minY, Scalar maxY, unsigned n)
+    { resize(minX, maxX, m, minY, maxY, n); }
+
+    /*!
+     * \brief Resize the tabulation to a new range.
+     */
+    void resize(Scalar minX, Scalar maxX, unsigned m,
+                Scalar minY, Scalar maxY, unsigned n)
+    {
+        assert(m > 1 && n > 1);
+
+        nodes_.resize(m*n);
+
+        m_ = m;
+        n_ = n;
+
+        xMin_ = minX;
+        xMax_ = maxX;
+
+        yMin_ = minY;
+        yMax_ = maxY;
+    }
+
+    /*!
+     * \brief Sample a function at all grid points.
+     *
+     * The function is called as fn(x, y) with x and y being evaluations of two
+     * variables and must return an evaluation which carries the partial derivatives
+     * with regard to x and y.
+     */
+    template <class Function>
+    void sample(Function&& fn)
+    {
+        using Eval = DenseAd::Evaluation<Scalar, 2>;
+
+        for (unsigned j = 0; j < n_; ++j) {
+            for (unsigned i = 0; i < m_; ++i) {
+                const Eval value = fn(Eval::createVariable(iToX(i), 0),
+                                      Eval::createVariable(jToY(j), 1));
+                auto& node = node_(i, j);
+                node.value = value.value();
+                node.dx = value.derivative(0);
+                node.dy = value.derivative(1);
+            }
+        }
+
+        // approximate the mixed derivative by differentiating d/dy in x direction
+        for (unsigned j = 0; j < n_; ++j) {
+            for (unsigned i = 0; i < m_; ++i) {
+                const unsigned iLow = (i > 0) ? i - 1 : i;
+                const unsigned iHigh = std::min(i + 1, m_ - 1);
+                node_(i, j).dxy = (node_(iHigh, j).dy - node_(iLow, j).dy) / (iToX(iHigh) - iToX(iLow));
+            }
+        }
+    }
+
+    Scalar xMin() const
+    { return xMin_; }
+
+    Scalar xMax() const
+    { return xMax_; }
+
+    Scalar yMin() const
+    { return yMin_; }
+
+    Scalar yMax() const
+    { return yMax_; }
+
+    unsigned numX() const
+    { return m_; }
+
+    unsigned numY() const
+    { return n_; }
+
+    /*!
+     * \brief Return the position on the x-axis of the i-th sampling point.
+     */
+    Scalar iToX(unsigned i) const
+    {
+        assert(i < numX());
+        return xMin() + i*(xMax() - xMin())/(numX() - 1);
+    }
+
+    /*!
+     * \brief Return the position on the y-axis of the j-th sampling point.
+     */
+    Scalar jToY(unsigned j) const
+    {
+        assert(j < numY());
+        return yMin() + j*(yMax() - yMin())/(numY() - 1);
+    }
+
+    /*!
+     * \brief Returns true if a coordinate lies in the tabulation range.
+     */
+    template <class Evaluation>
+    bool applies(const Evaluation& x, const Evaluation& y) const
+    {
+        return
+            xMin() <= x && x <= xMax() &&
+            yMin() <= y && y <= yMax();
+    }
+
+    /*!
+     * \brief Evaluate the function at a given (x,y) position.
+     *
+     * Positions outside of the tabulated range are extrapolated using the polynomials
+     * of the closest interval.
+     */
+    template <class Evaluation>
+    Evaluation eval(const Evaluation& x, const Evaluation& y) const
+    {
+        const Scalar hx = (xMax() - xMin())/(numX() - 1);
+        const Scalar hy = (yMax() - yMin())/(numY() - 1);
+
+        const Evaluation alpha = (x - xMin())/hx;
+        const Evaluation beta = (y - yMin())/hy;
+
+        const unsigned i =
+            static_cast<unsigned>(std::max(0, std::min(static_cast<int>(numX()) - 2,
+                                                       static_cast<int>(scalarValue(alpha)))));
+        const unsigned j =
+            static_cast<unsigned>(std::max(0, std::min(static_cast<int>(numY()) - 2,
+                                                       static_cast<int>(scalarValue(beta)))));
+
+        const Evaluation tx = alpha - i;
+        const Evaluation ty = beta - j;
+
+        // cubic Hermite basis functions for the values (h0, h1) and the slopes (g0, g1)
+        // at the left and right end of the interval
+        const Evaluation hx0 = (1.0 + 2.0*tx)*(1.0 - tx)*(1.0 - tx);
+        const Evaluation hx1 = tx*tx*(3.0 - 2.0*tx);
+        const Evaluation gx0 = tx*(1.0 - tx)*(1.0 - tx)*hx;
+        const Evaluation gx1 = tx*tx*(tx - 1.0)*hx;
+
+        const Evaluation hy0 = (1.0 + 2.0*ty)*(1.0 - ty)*(1.0 - ty);
+        const Evaluation hy1 = ty*ty*(3.0 - 2.0*ty);
+        const Evaluation gy0 = ty*(1.0 - ty)*(1.0 - ty)*hy;
+        const Evaluation gy1 = ty*ty*(ty - 1.0)*hy;
+
+        const auto corner = [](const Node& node,
+                               const Evaluation& hxk, const Evaluation& gxk,
+                               const Evaluation& hyl, const Evaluation& gyl)
+        {
+            return
+                node.value*hxk*hyl
+                + node.dx*gxk*hyl
+                + node.dy*hxk*gyl
+                + node.dxy*gxk*gyl;
+        };
+
+        return
+            corner(node_(i, j), hx0, gx0, hy0, gy0)
+            + corner(node_(i + 1, j), hx1, gx1, hy0, gy0)
+            + corner(node_(i, j + 1), hx0, gx0, hy1, gy1)
+            + corner(node_(i + 1, j + 1), hx1, gx1, hy1, gy1);
+    }
+
+    bool operator==(const HermiteTabulated2DFunction<Scalar>& data) const
+    {
+        return nodes_ == data.nodes_ &&
+               m_ == data.m_ &&
+               n_ == data.n_ &&
+               xMin_ == data.xMin_ &&
+               xMax_ == data.xMax_ &&
+               yMin_ == data.yMin_ &&
+               yMax_ == data.yMax_;
+    }
+
+private:
+    struct Node
+    {
+        Scalar value{};
+        Scalar dx{};
+        Scalar dy{};
+        Scalar dxy{};
+
+        bool operator==(const Node& other) const
+        {
+            return value == other.value &&
+                   dx == other.dx &&
+                   dy == other.dy &&
+                   dxy == other.dxy;
+        }
+    };
+
+    const Node& node_(unsigned i, unsigned j) const
+    {
+        assert(i < m_);
+        assert(j < n_);
+
+        return nodes_[j*m_ + i];
+    }
+
+    Node& node_(unsigned i, unsigned j)
+    {
+        assert(i < m_);
+        assert(j < n_);
+
+        return nodes_[j*m_ + i];
+    }
+
+    // the sampling points f(x_i, y_j) stored row by row
+    std::vector<Node> nodes_;
+
+    // the number of sample points in x and y direction
+    unsigned m_ = 0;
+    unsigned n_ = 0;
+
+    // the range of the tabulation
+    Scalar xMin_ = 0.0;
+    Scalar xMax_ = 0.0;
+
+    Scalar yMin_ = 0.0;
+    Scalar yMax_ = 0.0;
+};
+
+} // namespace Opm
+
+#endif
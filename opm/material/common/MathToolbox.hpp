@@ -189,6 +189,14 @@ public:
         return std::abs(valueDiff) < tolerance || std::abs(valueDiff)/denom < tolerance;
     }
 
+    /*!
+     * \brief Choose between two values depending on a condition
+     *
+     * This is the scalar counterpart of the lane-wise choice of SIMD packed values.
+     */
+    static Scalar select(bool mask, Scalar a, Scalar b)
+    { return mask ? a : b; }
+
     ////////////
     // arithmetic functions
     ////////////
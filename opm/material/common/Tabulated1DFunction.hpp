@@ -32,6 +32,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
 #include <iosfwd>
 #include <stdexcept>
 #include <vector>
@@ -42,6 +44,18 @@ struct SegmentIndex {
     size_t value;
 };
 
+/*!
+ * \brief Caller-held hint for the segment of a tabulated function which was
+ *        used by the previous evaluation.
+ *
+ * Checked before any search is done, so repeated evaluations within the same
+ * segment, e.g., for the same cell in subsequent Newton iterations, do not
+ * need to search the table.
+ */
+struct SegmentHint {
+    size_t value{0};
+};
+
 /*!
  * \brief Implements a linearly interpolated scalar function that depends on one
  *        variable.
@@ -120,6 +134,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        buildSegmentIndex_();
     }
 
     /*!
@@ -144,6 +160,8 @@ public:
             else if (xValues_[0] > xValues_[numSamples() - 1])
                 reverseSamplingPoints_();
         }
+
+        buildSegmentIndex_();
     }
 
     /*!
@@ -168,6 +186,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        buildSegmentIndex_();
     }
 
     /*!
@@ -204,6 +224,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        buildSegmentIndex_();
     }
 
     /*!
@@ -265,6 +287,21 @@ public:
         return eval(x, segIdx);
     }
 
+    /*!
+     * \brief Evaluate the function at a given position using a caller-held
+     *        segment hint.
+     *
+     * Equivalent to eval(x, extrapolate), but first checks whether \p x is
+     * in the interior of the segment in \p hint.  The hint is updated to
+     * the segment actually used.
+     */
+    template <class Evaluation>
+    Evaluation eval(const Evaluation& x, SegmentHint& hint, bool extrapolate = false) const
+    {
+        SegmentIndex segIdx = findSegmentIndex(x, hint, extrapolate);
+        return eval(x, segIdx);
+    }
+
     template <class Evaluation>
     Evaluation eval(const Evaluation& x, SegmentIndex segIdxIn) const
     {
@@ -460,6 +497,7 @@ public:
             // bisection
             size_t lowerIdx = 1;
             size_t upperIdx = xValues_.size() - 2;
+            narrowSegmentRange_(x, lowerIdx, upperIdx);
             while (lowerIdx + 1 < upperIdx) {
                 size_t pivotIdx = (lowerIdx + upperIdx) / 2;
                 if (x < xValues_[pivotIdx])
@@ -500,7 +538,96 @@ public:
         }
     }
 
+    /*!
+     * \brief Find the segment containing a given position using a caller-held
+     *        segment hint.
+     *
+     * Returns the same segment as findSegmentIndex(x, extrapolate).  If \p x
+     * is strictly inside the hinted segment, that segment is returned
+     * without further checks.  Otherwise, falls back to the full search and
+     * updates \p hint.
+     */
+    template <class Evaluation>
+    SegmentIndex findSegmentIndex(const Evaluation& x,
+                                  SegmentHint& hint,
+                                  bool extrapolate = false) const
+    {
+        const size_t segIdx = hint.value;
+        if (segIdx + 1 < numSamples() &&
+            xValues_[segIdx] < x && x < xValues_[segIdx + 1])
+        {
+            return SegmentIndex{segIdx};
+        }
+
+        const SegmentIndex result = findSegmentIndex(x, extrapolate);
+        hint.value = result.value;
+        return result;
+    }
+
 private:
+    /*!
+     * \brief Narrow the bisection range [lowerIdx, upperIdx] for an interior
+     *        position using the uniform bucket index.
+     *
+     * Leaves the range unchanged if there is no bucket index or if rounding
+     * placed \p x outside the bucket's range.
+     */
+    template <class Evaluation>
+    void narrowSegmentRange_(const Evaluation& x, size_t& lowerIdx, size_t& upperIdx) const
+    {
+        if (bucketSegment_.empty())
+            return;
+
+        const size_t numBuckets = bucketSegment_.size() - 1;
+        size_t bucketIdx = static_cast<size_t>((scalarValue(x) - xValues_[0])*bucketScale_);
+        bucketIdx = std::min(bucketIdx, numBuckets - 1);
+
+        const size_t lower = std::max(lowerIdx, static_cast<size_t>(bucketSegment_[bucketIdx]));
+        const size_t upper = std::min(upperIdx, static_cast<size_t>(bucketSegment_[bucketIdx + 1]) + 1);
+        if (xValues_[lower] <= x && x < xValues_[upper]) {
+            lowerIdx = lower;
+            upperIdx = upper;
+        }
+    }
+
+    /*!
+     * \brief Build the uniform bucket index used to narrow segment searches.
+     *
+     * The range [xMin, xMax] is split into numSamples() - 1 buckets of equal
+     * width, and for each bucket edge we store the index of the segment
+     * containing it.  Only built for sorted tables large enough for
+     * bisection to be noticeably expensive.
+     */
+    void buildSegmentIndex_()
+    {
+        bucketSegment_.clear();
+        bucketScale_ = 0.0;
+
+        const size_t n = numSamples();
+        if (n < minSamplesForSegmentIndex_ ||
+            !std::is_sorted(xValues_.begin(), xValues_.end()) ||
+            !(xValues_[0] < xValues_[n - 1]))
+        {
+            return;
+        }
+
+        const size_t numBuckets = n - 1;
+        const Scalar width = (xValues_[n - 1] - xValues_[0]) / numBuckets;
+        const Scalar scale = numBuckets / (xValues_[n - 1] - xValues_[0]);
+        if (!std::isfinite(scale))
+            return;
+
+        bucketSegment_.resize(numBuckets + 1);
+        for (size_t b = 0; b <= numBuckets; ++b) {
+            const Scalar edge = xValues_[0] + b*width;
+            const auto pos = std::upper_bound(xValues_.begin(), xValues_.end(), edge);
+            bucketSegment_[b] = static_cast<unsigned>(std::max<std::ptrdiff_t>(pos - xValues_.begin() - 1, 0));
+        }
+
+        bucketScale_ = scale;
+    }
+
+
     template <class Evaluation>
     Evaluation evalDerivative_(const Evaluation& x, size_t segIdx) const
     {
@@ -613,6 +740,13 @@ private:
 
     std::vector<Scalar> xValues_;
     std::vector<Scalar> yValues_;
+
+    // Segment index of each bucket edge in a uniform partition of [xMin,
+    // xMax].  Empty if the table is unsorted or too small to benefit.
+    std::vector<unsigned> bucketSegment_;
+    Scalar bucketScale_{0.0};
+
+    static constexpr size_t minSamplesForSegmentIndex_ = 16;
 };
 
 } // namespace Opm
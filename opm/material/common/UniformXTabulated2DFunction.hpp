@@ -35,9 +35,11 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <iosfwd>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -48,6 +50,11 @@ namespace Opm {
  * "Uniform on the X-axis" means that all Y sampling points must be located along a line
  * for this value. This class can be used when the sampling points are calculated at run
  * time.
+ *
+ * Besides the sampling points of each column, the Y coordinates and values of all
+ * columns are stored contiguously, column by column, with the start of each column
+ * given by an offset array. A lookup only uses the contiguous storage and thus touches
+ * only the Y coordinates and values of the two columns involved.
  */
 template <class Scalar>
 class UniformXTabulated2DFunction
@@ -55,6 +62,19 @@ class UniformXTabulated2DFunction
 public:
     typedef std::tuple</*x=*/Scalar, /*y=*/Scalar, /*value=*/Scalar> SamplePoint;
 
+    /*!
+     * \brief The contiguous storage of the sampling points.
+     *
+     * The Y coordinates and values of column i are located at the positions
+     * [columnStart[i], columnStart[i + 1]) of y and value.
+     */
+    struct FlatSamples
+    {
+        const std::vector<Scalar>& y;
+        const std::vector<Scalar>& value;
+        const std::vector<std::size_t>& columnStart;
+    };
+
     /*!
      * \brief Indicates how interpolation will be performed.
      *
@@ -83,7 +103,15 @@ public:
         , xPos_(xPos)
         , yPos_(yPos)
         , interpolationGuide_(interpolationGuide)
-    { }
+    {
+        for (const auto& column : samples) {
+            for (const auto& point : column) {
+                sampleY_.push_back(std::get<1>(point));
+                sampleValue_.push_back(std::get<2>(point));
+            }
+            columnStart_.push_back(sampleY_.size());
+        }
+    }
 
     /*!
      * \brief Returns the minimum of the X coordinate of the sampling points.
@@ -107,13 +135,13 @@ public:
      * \brief Returns the value of the Y coordinate of a sampling point.
      */
     Scalar yAt(size_t i, size_t j) const
-    { return std::get<1>(samples_[i][j]); }
+    { return sampleY_[columnStart_[i] + j]; }
 
     /*!
      * \brief Returns the value of a sampling point.
      */
     Scalar valueAt(size_t i, size_t j) const
-    { return std::get<2>(samples_[i][j]); }
+    { return sampleValue_[columnStart_[i] + j]; }
 
     /*!
      * \brief Returns the number of sampling points in X direction.
@@ -125,19 +153,19 @@ public:
      * \brief Returns the minimum of the Y coordinate of the sampling points for a given column.
      */
     Scalar yMin(unsigned i) const
-    { return std::get<1>(samples_.at(i).front()); }
+    { return sampleY_[columnStart_.at(i)]; }
 
     /*!
      * \brief Returns the maximum of the Y coordinate of the sampling points for a given column.
      */
     Scalar yMax(unsigned i) const
-    { return std::get<1>(samples_.at(i).back()); }
+    { return sampleY_[columnStart_.at(i + 1) - 1]; }
 
     /*!
      * \brief Returns the number of sampling points in Y direction a given column.
      */
     size_t numY(unsigned i) const
-    { return samples_.at(i).size(); }
+    { return columnStart_.at(i + 1) - columnStart_[i]; }
 
     /*!
      * \brief Return the position on the x-axis of the i-th interval.
@@ -154,6 +182,14 @@ public:
         return samples_;
     }
 
+    /*!
+     * \brief Return the contiguous storage of the sampling points used for lookups.
+     */
+    FlatSamples flatSamples() const
+    {
+        return {sampleY_, sampleValue_, columnStart_};
+    }
+
     const std::vector<Scalar>& xPos() const
     {
         return xPos_;
@@ -175,9 +211,9 @@ public:
     Scalar jToY(unsigned i, unsigned j) const
     {
         assert(i < numX());
-        assert(size_t(j) < samples_[i].size());
+        assert(size_t(j) < numY(i));
 
-        return std::get<1>(samples_.at(i).at(j));
+        return sampleY_[columnStart_.at(i) + j];
     }
 
     /*!
@@ -236,24 +272,25 @@ public:
                            [[maybe_unused]] bool extrapolate = false) const
     {
         assert(xSampleIdx < numX());
-        const auto& colSamplePoints = samples_.at(xSampleIdx);
+        const Scalar* colY = sampleY_.data() + columnStart_.at(xSampleIdx);
+        const size_t colSize = numY(xSampleIdx);
 
-        assert(colSamplePoints.size() >= 2);
+        assert(colSize >= 2);
         assert(extrapolate || (yMin(xSampleIdx) <= y && y <= yMax(xSampleIdx)));
 
-        if (y <= std::get<1>(colSamplePoints[1]))
+        if (y <= colY[1])
             return 0;
-        else if (y >= std::get<1>(colSamplePoints[colSamplePoints.size() - 2]))
-            return colSamplePoints.size() - 2;
+        else if (y >= colY[colSize - 2])
+            return colSize - 2;
         else {
-            assert(colSamplePoints.size() >= 3);
+            assert(colSize >= 3);
 
             // bisection
             unsigned lowerIdx = 1;
-            unsigned upperIdx = colSamplePoints.size() - 2;
+            unsigned upperIdx = colSize - 2;
             while (lowerIdx + 1 < upperIdx) {
                 unsigned pivotIdx = (lowerIdx + upperIdx) / 2;
-                if (y < std::get<1>(colSamplePoints[pivotIdx]))
+                if (y < colY[pivotIdx])
                     upperIdx = pivotIdx;
                 else
                     lowerIdx = pivotIdx;
@@ -275,10 +312,10 @@ public:
         assert(xSampleIdx < numX());
         assert(ySegmentIdx < numY(xSampleIdx) - 1);
 
-        const auto& colSamplePoints = samples_.at(xSampleIdx);
+        const Scalar* colY = sampleY_.data() + columnStart_.at(xSampleIdx);
 
-        Scalar y1 = std::get<1>(colSamplePoints[ySegmentIdx]);
-        Scalar y2 = std::get<1>(colSamplePoints[ySegmentIdx + 1]);
+        Scalar y1 = colY[ySegmentIdx];
+        Scalar y2 = colY[ySegmentIdx + 1];
 
         return (y - y1)/(y2 - y1);
     }
@@ -295,16 +332,13 @@ public:
         unsigned i = xSegmentIndex(x, /*extrapolate=*/false);
         Scalar alpha = xToAlpha(decay<Scalar>(x), i);
 
-        const auto& col1SamplePoints = samples_.at(i);
-        const auto& col2SamplePoints = samples_.at(i + 1);
-
         Scalar minY =
-                alpha*std::get<1>(col1SamplePoints.front()) +
-                (1 - alpha)*std::get<1>(col2SamplePoints.front());
+                alpha*yMin(i) +
+                (1 - alpha)*yMin(i + 1);
 
         Scalar maxY =
-                alpha*std::get<1>(col1SamplePoints.back()) +
-                (1 - alpha)*std::get<1>(col2SamplePoints.back());
+                alpha*yMax(i) +
+                (1 - alpha)*yMax(i + 1);
 
         return minY <= y && y <= maxY;
     }
@@ -323,6 +357,45 @@ public:
         return eval(i, j1, j2, alpha, beta1, beta2);
     }
 
+    /*!
+     * \brief Evaluate this function and another function with the same sampling
+     *        points at a given (x,y) position using a single lookup.
+     *
+     * \p other must have the same sampling points and interpolation policy as this
+     * function, i.e., hasSameSampling(other) must be true.  Typically used for
+     * evaluating both 1/B and 1/(B*mu) in a PVT model.
+     *
+     * \return Pair of this function's value and \p other's value at (x,y).
+     */
+    template <class Evaluation>
+    std::pair<Evaluation, Evaluation>
+    evalWith(const UniformXTabulated2DFunction& other,
+             const Evaluation& x, const Evaluation& y, bool extrapolate=false) const
+    {
+        assert(hasSameSampling(other));
+
+        Evaluation alpha, beta1, beta2;
+        unsigned i, j1, j2;
+        findPoints(i, j1, j2, alpha, beta1, beta2, x, y, extrapolate);
+        return { eval(i, j1, j2, alpha, beta1, beta2),
+                 other.eval(i, j1, j2, alpha, beta1, beta2) };
+    }
+
+    /*!
+     * \brief Whether or not another function has the same sampling points and
+     *        interpolation policy as this function.
+     *
+     * The sampled values may differ.
+     */
+    bool hasSameSampling(const UniformXTabulated2DFunction& other) const
+    {
+        return this->xPos_ == other.xPos_ &&
+               this->yPos_ == other.yPos_ &&
+               this->columnStart_ == other.columnStart_ &&
+               this->sampleY_ == other.sampleY_ &&
+               this->interpolationGuide_ == other.interpolationGuide_;
+    }
+
     template <class Evaluation>
     void findPoints(unsigned& i,
                     unsigned& j1,
@@ -419,6 +492,7 @@ public:
             xPos_.push_back(nextX);
             yPos_.push_back(-1e100);
             samples_.push_back({});
+            columnStart_.push_back(columnStart_.back());
             return xPos_.size() - 1;
         }
         else if (xPos_.front() > nextX) {
@@ -426,6 +500,7 @@ public:
             xPos_.insert(xPos_.begin(), nextX);
             yPos_.insert(yPos_.begin(), -1e100);
             samples_.insert(samples_.begin(), std::vector<SamplePoint>());
+            columnStart_.insert(columnStart_.begin(), 0);
             return 0;
         }
         throw std::invalid_argument("Sampling points should be specified either monotonically "
@@ -440,17 +515,19 @@ public:
     size_t appendSamplePoint(size_t i, Scalar y, Scalar value)
     {
         assert(i < numX());
-        Scalar x = iToX(i);
-        if (samples_[i].empty() || std::get<1>(samples_[i].back()) < y) {
-            samples_[i].push_back(SamplePoint(x, y, value));
+        const bool empty = numY(i) == 0;
+        if (empty || yMax(i) < y) {
+            samples_[i].emplace_back(xPos_[i], y, value);
+            insertSamplePoint_(i, columnStart_[i + 1], y, value);
             if (interpolationGuide_ == InterpolationPolicy::RightExtreme) {
                 yPos_[i] = y;
             }
-            return samples_[i].size() - 1;
+            return numY(i) - 1;
         }
-        else if (std::get<1>(samples_[i].front()) > y) {
+        else if (yMin(i) > y) {
             // slow, but we still don't care...
-            samples_[i].insert(samples_[i].begin(), SamplePoint(x, y, value));
+            samples_[i].insert(samples_[i].begin(), SamplePoint(xPos_[i], y, value));
+            insertSamplePoint_(i, columnStart_[i], y, value);
             if (interpolationGuide_ == InterpolationPolicy::LeftExtreme) {
                 yPos_[i] = y;
             }
@@ -470,17 +547,30 @@ public:
     void print(std::ostream& os) const;
 
     bool operator==(const UniformXTabulated2DFunction<Scalar>& data) const {
-        return this->xPos() == data.xPos() &&
-               this->yPos() == data.yPos() &&
-               this->samples() == data.samples() &&
-               this->interpolationGuide() == data.interpolationGuide();
+        return this->hasSameSampling(data) &&
+               this->sampleValue_ == data.sampleValue_;
     }
 
 private:
-    // the vector which contains the values of the sample points
-    // f(x_i, y_j). don't use this directly, use getSamplePoint(i,j)
-    // instead!
-    std::vector<std::vector<SamplePoint> > samples_;
+    // insert a sample point at position 'pos' of the contiguous sample
+    // storage and shift the start of all subsequent columns.
+    void insertSamplePoint_(size_t i, size_t pos, Scalar y, Scalar value)
+    {
+        sampleY_.insert(sampleY_.begin() + pos, y);
+        sampleValue_.insert(sampleValue_.begin() + pos, value);
+        for (size_t k = i + 1; k < columnStart_.size(); ++k) {
+            ++columnStart_[k];
+        }
+    }
+
+    // the sample points f(x_i, y_j) of each column
+    std::vector<std::vector<SamplePoint>> samples_;
+
+    // the y coordinates and values of the sample points of all columns, used for
+    // lookups. column i occupies [columnStart_[i], columnStart_[i + 1]).
+    std::vector<Scalar> sampleY_;
+    std::vector<Scalar> sampleValue_;
+    std::vector<size_t> columnStart_{0};
 
     // the position of each vertical line on the x-axis
     std::vector<Scalar> xPos_;
@@ -29,6 +29,8 @@
 #ifndef OPM_CHI_FLASH_HPP
 #define OPM_CHI_FLASH_HPP
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/material/fluidmatrixinteractions/NullMaterial.hpp>
 #include <opm/material/fluidmatrixinteractions/MaterialTraits.hpp>
 #include <opm/material/fluidstates/CompositionalFluidState.hpp>
@@ -43,14 +45,44 @@
 #include <dune/common/fmatrix.hh>
 #include <dune/common/classname.hh>
 
+#include <array>
+#include <cstddef>
 #include <limits>
 #include <iostream>
 #include <iomanip>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 namespace Opm {
 
+/*!
+ * \brief Iteration counts of a single flash calculation.
+ */
+struct PTFlashStatistics
+{
+    //! Whether the stability test was performed, i.e. no two-phase state was known
+    bool stabilityTest = false;
+    //! Whether the fluid was found to be single phase
+    bool singlePhase = false;
+
+    unsigned stabilityIterations = 0;
+    unsigned rachfordRiceIterations = 0;
+    unsigned successiveSubstitutionIterations = 0;
+    unsigned newtonIterations = 0;
+
+    //! Accumulate the iterations of another flash, e.g. to summarize a batch
+    PTFlashStatistics& operator+=(const PTFlashStatistics& other)
+    {
+        stabilityIterations += other.stabilityIterations;
+        rachfordRiceIterations += other.rachfordRiceIterations;
+        successiveSubstitutionIterations += other.successiveSubstitutionIterations;
+        newtonIterations += other.newtonIterations;
+        return *this;
+    }
+};
+
 /*!
  * \brief Determines the phase compositions, pressures and saturations
  *        given the total mass of all components for the chiwoms problem.
@@ -81,8 +113,12 @@ public:
                       const Dune::FieldVector<typename FluidState::Scalar, numComponents>& z,
                       std::string twoPhaseMethod,
                       Scalar tolerance = -1.,
-                      int verbosity = 0)
+                      int verbosity = 0,
+                      PTFlashStatistics* statistics = nullptr)
     {
+        if (statistics) {
+            *statistics = PTFlashStatistics{};
+        }
 
         using InputEval = typename FluidState::Scalar;
         using ComponentVector = Dune::FieldVector<typename FluidState::Scalar, numComponents>;
@@ -138,7 +174,10 @@ public:
              if (verbosity >= 1) {
                  std::cout << "Perform stability test (L <= 0 or L == 1)!" << std::endl;
              }
-            phaseStabilityTest_(is_stable, K_scalar, fluid_state_scalar, z_scalar, verbosity);
+            phaseStabilityTest_(is_stable, K_scalar, fluid_state_scalar, z_scalar, verbosity, statistics);
+            if (statistics) {
+                statistics->stabilityTest = true;
+            }
         }
         if (verbosity >= 1) {
             std::cout << "Inputs after stability test are K = [" << K_scalar << "], L = [" << L_scalar << "], z = [" << z_scalar << "], P = " << fluid_state.pressure(0) << ", and T = " << fluid_state.temperature(0) << std::endl;
@@ -150,11 +189,14 @@ public:
         // Update the composition if cell is two-phase
         if ( !is_single_phase ) {
             // Rachford Rice equation to get initial L for composition solver
-            L_scalar = solveRachfordRice_g_(K_scalar, z_scalar, verbosity);
-            flash_2ph(z_scalar, twoPhaseMethod, K_scalar, L_scalar, fluid_state_scalar, verbosity);
+            L_scalar = solveRachfordRice_g_(K_scalar, z_scalar, verbosity, statistics);
+            flash_2ph(z_scalar, twoPhaseMethod, K_scalar, L_scalar, fluid_state_scalar, verbosity, statistics);
         } else {
             // Cell is one-phase. Use Li's phase labeling method to see if it's liquid or vapor
             L_scalar = li_single_phase_label_(fluid_state_scalar, z_scalar, verbosity);
+            if (statistics) {
+                statistics->singlePhase = true;
+            }
         }
         fluid_state_scalar.setLvalue(L_scalar);
 
@@ -181,6 +223,43 @@ public:
         updateDerivatives_(fluid_state_scalar, z, fluid_state, is_single_phase);
     }//end solve
 
+    /*!
+     * \brief Flash a batch of fluid states, e.g. all cells of a grid.
+     *
+     * Each fluid state is flashed as in solve(), i.e. the K-values and the vapour
+     * fraction L stored in a fluid state are used as the initial guess, so flashing
+     * the states of the previous iteration skips the stability test for cells which
+     * are known to be two-phase. The fluid states are flashed in parallel if OpenMP
+     * is enabled. If the flash fails for some cells, the remaining ones are still
+     * flashed and the exception of the first failing cell is rethrown afterwards.
+     *
+     * \param statistics If non-null, it is resized to the number of fluid states and
+     *                   receives the iteration counts of each flash.
+     */
+    template <class FluidState>
+    static void solveBatch(std::vector<FluidState>& fluid_states,
+                           const std::vector<Dune::FieldVector<typename FluidState::Scalar, numComponents>>& z,
+                           const std::string& twoPhaseMethod,
+                           Scalar tolerance = -1.,
+                           std::vector<PTFlashStatistics>* statistics = nullptr)
+    {
+        if (z.size() != fluid_states.size()) {
+            throw std::invalid_argument("The number of global compositions (" + std::to_string(z.size()) +
+                                        ") does not match the number of fluid states (" +
+                                        std::to_string(fluid_states.size()) + ")");
+        }
+        if (statistics) {
+            statistics->assign(fluid_states.size(), PTFlashStatistics{});
+        }
+
+        parallelFor(0, fluid_states.size(), /*serialLimit=*/256, /*chunkSize=*/64,
+                    [&fluid_states, &z, &twoPhaseMethod, tolerance, statistics](const std::size_t idx)
+                    {
+                        solve(fluid_states[idx], z[idx], twoPhaseMethod, tolerance, /*verbosity=*/0,
+                              statistics ? &(*statistics)[idx] : nullptr);
+                    });
+    }
+
     /*!
      * \brief Calculates the chemical equilibrium from the component
      *        fugacities in a phase.
@@ -290,7 +369,8 @@ protected:
     }
 
     template <class Vector>
-    static typename Vector::field_type solveRachfordRice_g_(const Vector& K, const Vector& z, int verbosity)
+    static typename Vector::field_type solveRachfordRice_g_(const Vector& K, const Vector& z, int verbosity,
+                                                            PTFlashStatistics* statistics = nullptr)
     {
         // Find min and max K. Have to do a laborious for loop to avoid water component (where K=0)
         // TODO: Replace loop with Dune::min_value() and Dune::max_value() when water component is properly handled
@@ -326,6 +406,9 @@ protected:
 
         // Newton-Raphson loop
         for (int iteration=1; iteration<100; ++iteration){
+            if (statistics) {
+                ++statistics->rachfordRiceIterations;
+            }
             // Calculate function and derivative values
             auto g = rachfordRice_g_(K, L, z);
             auto dg_dL = rachfordRice_dg_dL_(K, L, z);
@@ -343,7 +426,7 @@ protected:
                     }
 
                     // Run bisection
-                    L = bisection_g_(K, Lmin, Lmax, z, verbosity);
+                    L = bisection_g_(K, Lmin, Lmax, z, verbosity, statistics);
 
                     // Ensure that L is in the range (0, 1)
                     L = Opm::min(Opm::max(L, 0.0), 1.0);
@@ -377,7 +460,8 @@ protected:
 
     template <class Vector>
     static typename Vector::field_type bisection_g_(const Vector& K, typename Vector::field_type Lmin,
-                                                    typename Vector::field_type Lmax, const Vector& z, int verbosity)
+                                                    typename Vector::field_type Lmax, const Vector& z, int verbosity,
+                                                    PTFlashStatistics* statistics = nullptr)
     {
         // Calculate for g(Lmin) for first comparison with gMid = g(L)
         typename Vector::field_type gLmin = rachfordRice_g_(K, Lmin, z);
@@ -390,6 +474,9 @@ protected:
         constexpr int max_it = 100;
         // Bisection loop
         for (int iteration = 0; iteration < max_it; ++iteration){
+            if (statistics) {
+                ++statistics->rachfordRiceIterations;
+            }
             // New midpoint
             auto L = (Lmin + Lmax) / 2;
             auto gMid = rachfordRice_g_(K, L, z);
@@ -417,7 +504,8 @@ protected:
     }
 
     template <class FlashFluidState, class ComponentVector>
-    static void phaseStabilityTest_(bool& isStable, ComponentVector& K, FlashFluidState& fluid_state, const ComponentVector& z, int verbosity)
+    static void phaseStabilityTest_(bool& isStable, ComponentVector& K, FlashFluidState& fluid_state, const ComponentVector& z, int verbosity,
+                                    PTFlashStatistics* statistics = nullptr)
     {
         // Declarations
         bool isTrivialL, isTrivialV;
@@ -430,14 +518,14 @@ protected:
         if (verbosity == 3 || verbosity == 4) {
             std::cout << "Stability test for vapor phase:" << std::endl;
         }
-        checkStability_(fluid_state, isTrivialV, K0, y, S_v, z, /*isGas=*/true, verbosity);
+        checkStability_(fluid_state, isTrivialV, K0, y, S_v, z, /*isGas=*/true, verbosity, statistics);
         bool V_unstable = (S_v < (1.0 + 1e-5)) || isTrivialV;
 
         // Check for liquids stable phase
         if (verbosity == 3 || verbosity == 4) {
             std::cout << "Stability test for liquid phase:" << std::endl;
         }
-        checkStability_(fluid_state, isTrivialL, K1, x, S_l, z, /*isGas=*/false, verbosity);
+        checkStability_(fluid_state, isTrivialL, K1, x, S_l, z, /*isGas=*/false, verbosity, statistics);
         bool L_stable = (S_l < (1.0 + 1e-5)) || isTrivialL;
 
         // L-stable means success in making liquid, V-unstable means no success in making vapour
@@ -460,7 +548,8 @@ protected:
 
     template <class FlashFluidState, class ComponentVector>
     static void checkStability_(const FlashFluidState& fluid_state, bool& isTrivial, ComponentVector& K, ComponentVector& xy_loc,
-                                typename FlashFluidState::Scalar& S_loc, const ComponentVector& z, bool isGas, int verbosity)
+                                typename FlashFluidState::Scalar& S_loc, const ComponentVector& z, bool isGas, int verbosity,
+                                PTFlashStatistics* statistics = nullptr)
     {
         using FlashEval = typename FlashFluidState::Scalar;
         using PengRobinsonMixture = typename Opm::PengRobinsonMixture<Scalar, FluidSystem>;
@@ -477,6 +566,9 @@ protected:
         // Michelsens stability test.
         // Make two fake phases "inside" one phase and check for positive volume
         for (int i = 0; i < 20000; ++i) {
+            if (statistics) {
+                ++statistics->stabilityIterations;
+            }
             S_loc = 0.0;
             if (isGas) {
                 for (int compIdx=0; compIdx<numComponents; ++compIdx){
@@ -595,7 +687,8 @@ protected:
                           ComponentVector& K_scalar,
                           typename FluidState::Scalar& L_scalar,
                           FluidState& fluid_state_scalar,
-                          int verbosity = 0) {
+                          int verbosity = 0,
+                          PTFlashStatistics* statistics = nullptr) {
         if (verbosity >= 1) {
             std::cout << "Cell is two-phase! Solve Rachford-Rice with initial K = [" << K_scalar << "]" << std::endl;
         }
@@ -606,16 +699,16 @@ protected:
             if (verbosity >= 1) {
                 std::cout << "Calculate composition using Newton." << std::endl;
             }
-            newtonComposition_(K_scalar, L_scalar, fluid_state_scalar, z_scalar, verbosity);
+            newtonComposition_(K_scalar, L_scalar, fluid_state_scalar, z_scalar, verbosity, statistics);
         } else if (flash_2p_method == "ssi") {
             // Successive substitution
             if (verbosity >= 1) {
                 std::cout << "Calculate composition using Succcessive Substitution." << std::endl;
             }
-            successiveSubstitutionComposition_(K_scalar, L_scalar, fluid_state_scalar, z_scalar, false, verbosity);
+            successiveSubstitutionComposition_(K_scalar, L_scalar, fluid_state_scalar, z_scalar, false, verbosity, statistics);
         } else if (flash_2p_method == "ssi+newton") {
-            successiveSubstitutionComposition_(K_scalar, L_scalar, fluid_state_scalar, z_scalar, true, verbosity);
-            newtonComposition_(K_scalar, L_scalar, fluid_state_scalar, z_scalar, verbosity);
+            successiveSubstitutionComposition_(K_scalar, L_scalar, fluid_state_scalar, z_scalar, true, verbosity, statistics);
+            newtonComposition_(K_scalar, L_scalar, fluid_state_scalar, z_scalar, verbosity, statistics);
         } else {
             throw std::runtime_error("unknown two phase flash method " + flash_2p_method + " is specified");
         }
@@ -624,7 +717,8 @@ protected:
     template <class FlashFluidState, class ComponentVector>
     static void newtonComposition_(ComponentVector& K, typename FlashFluidState::Scalar& L,
                                    FlashFluidState& fluid_state, const ComponentVector& z,
-                                   int verbosity)
+                                   int verbosity,
+                                   PTFlashStatistics* statistics = nullptr)
     {
         // Note: due to the need for inverse flash update for derivatives, the following two can be different
         // Looking for a good way to organize them
@@ -671,7 +765,7 @@ protected:
         // AD type
         using Eval = DenseAd::Evaluation<Scalar, num_primary_variables>;
         // TODO: we might need to use numMiscibleComponents here
-        std::vector<Eval> x(numComponents), y(numComponents);
+        std::array<Eval, numComponents> x, y;
         Eval l;
 
         // TODO: I might not need to set soln anything here.
@@ -728,6 +822,10 @@ protected:
             if (converged) {
                 break;
             }
+            ++iter;
+            if (statistics) {
+                ++statistics->newtonIterations;
+            }
 
             jac.solve(soln, res);
             constexpr Scalar damping_factor = 1.0;
@@ -790,7 +888,7 @@ protected:
                                 Dune::FieldVector<double, num_equation>& res)
     {
         using Eval = DenseAd::Evaluation<double, num_primary>;
-        std::vector<Eval> x(numComponents), y(numComponents);
+        std::array<Eval, numComponents> x, y;
         for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
             x[compIdx] = fluid_state.moleFraction(oilPhaseIdx, compIdx);
             y[compIdx] = fluid_state.moleFraction(gasPhaseIdx, compIdx);
@@ -841,7 +939,7 @@ protected:
                                 Dune::FieldVector<double, num_equation>& res)
     {
         using Eval = DenseAd::Evaluation<double, num_primary>;
-        std::vector<Eval> x(numComponents), y(numComponents);
+        std::array<Eval, numComponents> x, y;
         for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
             x[compIdx] = fluid_state.moleFraction(oilPhaseIdx, compIdx);
             y[compIdx] = fluid_state.moleFraction(gasPhaseIdx, compIdx);
@@ -1029,7 +1127,7 @@ protected:
 
         const auto p_l = fluid_state.pressure(FluidSystem::oilPhaseIdx);
         const auto p_v = fluid_state.pressure(FluidSystem::gasPhaseIdx);
-        std::vector<double> K(numComponents);
+        std::array<double, numComponents> K{};
 
         for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
             K[compIdx] = fluid_state_scalar.K(compIdx);
@@ -1043,7 +1141,7 @@ protected:
 
         constexpr size_t num_deri = numComponents;
         for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
-            std::vector<double> deri(num_deri, 0.);
+            std::array<double, num_deri> deri{};
             // derivatives from P
             for (unsigned idx = 0; idx < num_deri; ++idx) {
                 deri[idx] = -sec_jac[compIdx][0] * p_l.derivative(idx);
@@ -1075,7 +1173,7 @@ protected:
             }
 
             // handling derivatives of L
-            std::vector<double> deriL(num_deri, 0.);
+            std::array<double, num_deri> deriL{};
             for (unsigned idx = 0; idx < num_deri; ++idx) {
                 deriL[idx] = -sec_jac[2 * numComponents][0] * p_v.derivative(idx);
             }
@@ -1122,7 +1220,8 @@ protected:
     // TODO: or use typename FlashFluidState::Scalar
     template <class FlashFluidState, class ComponentVector>
     static void successiveSubstitutionComposition_(ComponentVector& K, typename ComponentVector::field_type& L, FlashFluidState& fluid_state, const ComponentVector& z,
-                                                   const bool newton_afterwards, const int verbosity)
+                                                   const bool newton_afterwards, const int verbosity,
+                                                   PTFlashStatistics* statistics = nullptr)
     {
         // Determine max. iterations based on if it will be used as a standalone flash or as a pre-process to Newton (or other) method.
         const int maxIterations = newton_afterwards ? 3 : 100;
@@ -1144,6 +1243,9 @@ protected:
         // Successive substitution loop
         //
         for (int i=0; i < maxIterations; ++i){
+            if (statistics) {
+                ++statistics->successiveSubstitutionIterations;
+            }
             // Compute (normalized) liquid and vapor mole fractions
             computeLiquidVapor_(fluid_state, L, K, z);
 
@@ -1183,8 +1285,11 @@ protected:
 
             // Check convergence
             if (convFugRatio.two_norm() < 1e-6) {
-                // Restore cout format
-                std::cout.flags(f);
+                // Restore cout format. It is only changed when printing, which also
+                // keeps concurrent flashes from touching the stream.
+                if (verbosity >= 2) {
+                    std::cout.flags(f);
+                }
 
                 // Print info
                 if (verbosity >= 1) {
@@ -1220,7 +1325,7 @@ protected:
                 }
 
                 // Solve Rachford-Rice to get L from updated K
-                L = solveRachfordRice_g_(K, z, 0);
+                L = solveRachfordRice_g_(K, z, 0, statistics);
             }
 
         }
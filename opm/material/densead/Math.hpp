@@ -42,21 +42,92 @@ namespace DenseAd {
 template <class ValueT, int numVars, unsigned staticSize>
 class Evaluation;
 
+// forward declarations of the SIMD pack value type, see SimdPack.hpp
+template <int width>
+class SimdMask;
+
+template <class ScalarT, int width>
+class SimdPack;
+
+template <class T>
+struct is_simd_pack
+{
+    static constexpr bool value = false;
+};
+
+template <class ScalarT, int width>
+struct is_simd_pack<SimdPack<ScalarT, width>>
+{
+    static constexpr bool value = true;
+};
+
+/*!
+ * \brief The type of the result of comparing two objects of a given value type.
+ *
+ * This is bool for scalars and SimdMask for packs.
+ */
+template <class ValueType>
+struct SimdMaskType
+{
+    typedef bool type;
+};
+
+template <class ScalarT, int width>
+struct SimdMaskType<SimdPack<ScalarT, width>>
+{
+    typedef SimdMask<width> type;
+};
+
+// lane-wise choice between two evaluations: the value and the derivatives of the
+// result are taken from a where the mask is set and from b otherwise. for scalar value
+// types the mask is a bool.
+template <class ValueType, int numVars, unsigned staticSize>
+Evaluation<ValueType, numVars, staticSize> select(const typename SimdMaskType<ValueType>::type& mask,
+                                                  const Evaluation<ValueType, numVars, staticSize>& a,
+                                                  const Evaluation<ValueType, numVars, staticSize>& b)
+{
+    if constexpr (is_simd_pack<ValueType>::value) {
+        Evaluation<ValueType, numVars, staticSize> result(a);
+        result.setValue(select(mask, a.value(), b.value()));
+        for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
+            result.setDerivative(curVarIdx, select(mask, a.derivative(curVarIdx), b.derivative(curVarIdx)));
+
+        return result;
+    }
+    else
+        return mask ? a : b;
+}
+
 // provide some algebraic functions
 template <class ValueType, int numVars, unsigned staticSize>
 Evaluation<ValueType, numVars, staticSize> abs(const Evaluation<ValueType, numVars, staticSize>& x)
-{ return (x > 0.0)?x:-x; }
+{
+    if constexpr (is_simd_pack<ValueType>::value)
+        return select(x.value() > 0.0, x, -x);
+    else
+        return (x > 0.0)?x:-x;
+}
 
 template <class ValueType, int numVars, unsigned staticSize>
 Evaluation<ValueType, numVars, staticSize> min(const Evaluation<ValueType, numVars, staticSize>& x1,
                                                const Evaluation<ValueType, numVars, staticSize>& x2)
-{ return (x1 < x2)?x1:x2; }
+{
+    if constexpr (is_simd_pack<ValueType>::value)
+        return select(x1.value() < x2.value(), x1, x2);
+    else
+        return (x1 < x2)?x1:x2;
+}
 
 template <class Arg1ValueType, class ValueType, int numVars, unsigned staticSize>
 Evaluation<ValueType, numVars, staticSize> min(const Arg1ValueType& x1,
                                                const Evaluation<ValueType, numVars, staticSize>& x2)
 {
-    if (x1 < x2) {
+    if constexpr (is_simd_pack<ValueType>::value) {
+        Evaluation<ValueType, numVars, staticSize> ret(x2);
+        ret = x1;
+        return select(ValueType(x1) < x2.value(), ret, x2);
+    }
+    else if (x1 < x2) {
         Evaluation<ValueType, numVars, staticSize> ret(x2);
         ret = x1;
         return ret;
@@ -73,13 +144,23 @@ Evaluation<ValueType, numVars, staticSize> min(const Evaluation<ValueType, numVa
 template <class ValueType, int numVars, unsigned staticSize>
 Evaluation<ValueType, numVars, staticSize> max(const Evaluation<ValueType, numVars, staticSize>& x1,
                                                const Evaluation<ValueType, numVars, staticSize>& x2)
-{ return (x1 > x2)?x1:x2; }
+{
+    if constexpr (is_simd_pack<ValueType>::value)
+        return select(x1.value() > x2.value(), x1, x2);
+    else
+        return (x1 > x2)?x1:x2;
+}
 
 template <class Arg1ValueType, class ValueType, int numVars, unsigned staticSize>
 Evaluation<ValueType, numVars, staticSize> max(const Arg1ValueType& x1,
                                                const Evaluation<ValueType, numVars, staticSize>& x2)
 {
-    if (x1 > x2) {
+    if constexpr (is_simd_pack<ValueType>::value) {
+        Evaluation<ValueType, numVars, staticSize> ret(x2);
+        ret = x1;
+        return select(ValueType(x1) > x2.value(), ret, x2);
+    }
+    else if (x1 > x2) {
         Evaluation<ValueType, numVars, staticSize> ret(x2);
         ret = x1;
         return ret;
@@ -374,7 +455,17 @@ Evaluation<ValueType, numVars, staticSize> pow(const Evaluation<ValueType, numVa
     const ValueType& pow_x = ValueTypeToolbox::pow(base.value(), exp);
     result.setValue(pow_x);
 
-    if (base == 0.0) {
+    if constexpr (is_simd_pack<ValueType>::value) {
+        // same as below, but the base 0 case is handled lane by lane
+        const ValueType& df_dx = pow_x/base.value()*exp;
+        for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
+            result.setDerivative(curVarIdx, df_dx*base.derivative(curVarIdx));
+
+        Evaluation<ValueType, numVars, staticSize> zero(base);
+        zero = 0.0;
+        result = select(base.value() == 0.0, zero, result);
+    }
+    else if (base == 0.0) {
         // we special case the base 0 case because 0.0 is in the valid range of the
         // base but the generic code leads to NaNs.
         result = 0.0;
@@ -398,7 +489,21 @@ Evaluation<ValueType, numVars, staticSize> pow(const BaseType& base,
 
     Evaluation<ValueType, numVars, staticSize> result(exp);
 
-    if (base == 0.0) {
+    if constexpr (is_simd_pack<ValueType>::value) {
+        // same as below, but the base 0 case is handled lane by lane
+        const ValueType baseValue(base);
+        const ValueType& lnBase = ValueTypeToolbox::log(baseValue);
+        result.setValue(ValueTypeToolbox::exp(lnBase*exp.value()));
+
+        const ValueType& df_dx = lnBase*result.value();
+        for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
+            result.setDerivative(curVarIdx, df_dx*exp.derivative(curVarIdx));
+
+        Evaluation<ValueType, numVars, staticSize> zero(exp);
+        zero = 0.0;
+        result = select(baseValue == 0.0, zero, result);
+    }
+    else if (base == 0.0) {
         // we special case the base 0 case because 0.0 is in the valid range of the
         // base but the generic code leads to NaNs.
         result = 0.0;
@@ -426,7 +531,25 @@ Evaluation<ValueType, numVars, staticSize> pow(const Evaluation<ValueType, numVa
 
     Evaluation<ValueType, numVars, staticSize> result(base);
 
-    if (base == 0.0) {
+    if constexpr (is_simd_pack<ValueType>::value) {
+        // same as below, but the base 0 case is handled lane by lane
+        ValueType valuePow = ValueTypeToolbox::pow(base.value(), exp.value());
+        result.setValue(valuePow);
+
+        const ValueType& f = base.value();
+        const ValueType& g = exp.value();
+        const ValueType& logF = ValueTypeToolbox::log(f);
+        for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx) {
+            const ValueType& fPrime = base.derivative(curVarIdx);
+            const ValueType& gPrime = exp.derivative(curVarIdx);
+            result.setDerivative(curVarIdx, (g*fPrime/f + logF*gPrime) * valuePow);
+        }
+
+        Evaluation<ValueType, numVars, staticSize> zero(base);
+        zero = 0.0;
+        result = select(base.value() == 0.0, zero, result);
+    }
+    else if (base == 0.0) {
         // we special case the base 0 case because 0.0 is in the valid range of the
         // base but the generic code leads to NaNs.
         result = 0.0;
@@ -561,6 +684,12 @@ public:
         return true;
     }
 
+    // lane-wise choice, see DenseAd::select()
+    static Evaluation select(const typename DenseAd::SimdMaskType<ValueType>::type& mask,
+                             const Evaluation& arg1,
+                             const Evaluation& arg2)
+    { return DenseAd::select(mask, arg1, arg2); }
+
     // arithmetic functions
     template <class Arg1Eval, class Arg2Eval>
     static Evaluation max(const Arg1Eval& arg1, const Arg2Eval& arg2)
@@ -0,0 +1,513 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief A fixed-width pack of floating point values which can be used as the value
+ *        type of the localized OPM automatic differentiation (AD) framework.
+ *
+ * Using Evaluation<SimdPack<Scalar, width>, numVars> lets code which is templated on
+ * the evaluation type process several cells at once: every arithmetic operation on
+ * the evaluation acts on all lanes of the value and of each derivative.  The lane
+ * loops have a fixed trip count and no dependencies between lanes, so the compiler
+ * maps them to vector instructions.
+ *
+ * Comparisons of packs yield a SimdMask instead of a bool.  Code which branches on
+ * values must thus use select() to combine the results of both branches lane by
+ * lane.  This is done by the functions of densead/Math.hpp, but not by the
+ * comparison operators of Evaluation, which return bool and thus do not compile for
+ * packs; compare the value() of evaluations instead.  Packs also do not have a
+ * single scalar value, so code which needs one, e.g. to look up the segment of a
+ * tabulated function, cannot be used with packed evaluations.  What can be used are
+ * the branch-free parts of the fluid and PVT code, such as the constant
+ * compressibility PVT classes.
+ */
+#ifndef OPM_DENSEAD_SIMD_PACK_HPP
+#define OPM_DENSEAD_SIMD_PACK_HPP
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/common/MathToolbox.hpp>
+
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Opm {
+namespace DenseAd {
+
+/*!
+ * \brief The result of a lane-wise comparison of two SimdPack objects.
+ */
+template <int width>
+class SimdMask
+{
+public:
+    SimdMask() : data_()
+    {}
+
+    explicit SimdMask(bool value)
+    {
+        for (int i = 0; i < width; ++i)
+            data_[i] = value;
+    }
+
+    static constexpr int size()
+    { return width; }
+
+    bool operator[](int laneIdx) const
+    { return data_[laneIdx]; }
+
+    bool& operator[](int laneIdx)
+    { return data_[laneIdx]; }
+
+    SimdMask operator!() const
+    {
+        SimdMask result;
+        for (int i = 0; i < width; ++i)
+            result.data_[i] = !data_[i];
+        return result;
+    }
+
+    SimdMask operator&&(const SimdMask& other) const
+    {
+        SimdMask result;
+        for (int i = 0; i < width; ++i)
+            result.data_[i] = data_[i] && other.data_[i];
+        return result;
+    }
+
+    SimdMask operator||(const SimdMask& other) const
+    {
+        SimdMask result;
+        for (int i = 0; i < width; ++i)
+            result.data_[i] = data_[i] || other.data_[i];
+        return result;
+    }
+
+    //! return true iff the condition holds for all lanes
+    bool all() const
+    {
+        bool result = true;
+        for (int i = 0; i < width; ++i)
+            result = result && data_[i];
+        return result;
+    }
+
+    //! return true iff the condition holds for at least one lane
+    bool any() const
+    {
+        bool result = false;
+        for (int i = 0; i < width; ++i)
+            result = result || data_[i];
+        return result;
+    }
+
+private:
+    bool data_[width];
+};
+
+/*!
+ * \brief A fixed number of floating point values which are operated on lane by lane.
+ */
+template <class ScalarT, int width>
+class SimdPack
+{
+    static_assert(std::is_floating_point<ScalarT>::value,
+                  "SimdPack expects a floating point lane type");
+    static_assert(width > 0, "SimdPack needs at least one lane");
+
+public:
+    typedef ScalarT Scalar;
+    typedef SimdMask<width> Mask;
+
+    static constexpr int size()
+    { return width; }
+
+    SimdPack() : data_()
+    {}
+
+    // broadcast a scalar to all lanes
+    template <class RhsScalar,
+              typename std::enable_if<std::is_arithmetic<RhsScalar>::value, int>::type = 0>
+    SimdPack(const RhsScalar& value)
+    {
+        for (int i = 0; i < width; ++i)
+            data_[i] = static_cast<Scalar>(value);
+    }
+
+    Scalar operator[](int laneIdx) const
+    { return data_[laneIdx]; }
+
+    Scalar& operator[](int laneIdx)
+    { return data_[laneIdx]; }
+
+    SimdPack& operator+=(const SimdPack& other)
+    {
+        for (int i = 0; i < width; ++i)
+            data_[i] += other.data_[i];
+        return *this;
+    }
+
+    SimdPack& operator-=(const SimdPack& other)
+    {
+        for (int i = 0; i < width; ++i)
+            data_[i] -= other.data_[i];
+        return *this;
+    }
+
+    SimdPack& operator*=(const SimdPack& other)
+    {
+        for (int i = 0; i < width; ++i)
+            data_[i] *= other.data_[i];
+        return *this;
+    }
+
+    SimdPack& operator/=(const SimdPack& other)
+    {
+        for (int i = 0; i < width; ++i)
+            data_[i] /= other.data_[i];
+        return *this;
+    }
+
+    SimdPack operator-() const
+    {
+        SimdPack result;
+        for (int i = 0; i < width; ++i)
+            result.data_[i] = -data_[i];
+        return result;
+    }
+
+    friend SimdPack operator+(const SimdPack& a, const SimdPack& b)
+    {
+        SimdPack result(a);
+        result += b;
+        return result;
+    }
+
+    friend SimdPack operator-(const SimdPack& a, const SimdPack& b)
+    {
+        SimdPack result(a);
+        result -= b;
+        return result;
+    }
+
+    friend SimdPack operator*(const SimdPack& a, const SimdPack& b)
+    {
+        SimdPack result(a);
+        result *= b;
+        return result;
+    }
+
+    friend SimdPack operator/(const SimdPack& a, const SimdPack& b)
+    {
+        SimdPack result(a);
+        result /= b;
+        return result;
+    }
+
+    friend Mask operator<(const SimdPack& a, const SimdPack& b)
+    { return compare_(a, b, [](Scalar x, Scalar y) { return x < y; }); }
+
+    friend Mask operator>(const SimdPack& a, const SimdPack& b)
+    { return compare_(a, b, [](Scalar x, Scalar y) { return x > y; }); }
+
+    friend Mask operator<=(const SimdPack& a, const SimdPack& b)
+    { return compare_(a, b, [](Scalar x, Scalar y) { return x <= y; }); }
+
+    friend Mask operator>=(const SimdPack& a, const SimdPack& b)
+    { return compare_(a, b, [](Scalar x, Scalar y) { return x >= y; }); }
+
+    friend Mask operator==(const SimdPack& a, const SimdPack& b)
+    { return compare_(a, b, [](Scalar x, Scalar y) { return x == y; }); }
+
+    friend Mask operator!=(const SimdPack& a, const SimdPack& b)
+    { return compare_(a, b, [](Scalar x, Scalar y) { return x != y; }); }
+
+    //! apply a unary function to each lane
+    template <class Fn>
+    SimdPack apply(Fn&& fn) const
+    {
+        SimdPack result;
+        for (int i = 0; i < width; ++i)
+            result.data_[i] = fn(data_[i]);
+        return result;
+    }
+
+    //! apply a binary function to each pair of lanes
+    template <class Fn>
+    SimdPack apply(const SimdPack& other, Fn&& fn) const
+    {
+        SimdPack result;
+        for (int i = 0; i < width; ++i)
+            result.data_[i] = fn(data_[i], other.data_[i]);
+        return result;
+    }
+
+private:
+    template <class Fn>
+    static Mask compare_(const SimdPack& a, const SimdPack& b, Fn&& fn)
+    {
+        Mask result;
+        for (int i = 0; i < width; ++i)
+            result[i] = fn(a.data_[i], b.data_[i]);
+        return result;
+    }
+
+    alignas(sizeof(ScalarT)*(width & -width)) Scalar data_[width];
+};
+
+// the operators for mixing packs and scalars. these are restricted to arithmetic
+// scalars so that they do not compete with the ones of the Evaluation class.
+#define OPM_SIMD_PACK_SCALAR_OP(OP)                                                 \
+    template <class ScalarT, int width, class RhsScalar>                            \
+    typename std::enable_if<std::is_arithmetic<RhsScalar>::value,                   \
+                            SimdPack<ScalarT, width> >::type                        \
+    operator OP(const SimdPack<ScalarT, width>& a, const RhsScalar& b)               \
+    { return a OP SimdPack<ScalarT, width>(b); }                                    \
+                                                                                    \
+    template <class ScalarT, int width, class LhsScalar>                            \
+    typename std::enable_if<std::is_arithmetic<LhsScalar>::value,                   \
+                            SimdPack<ScalarT, width> >::type                        \
+    operator OP(const LhsScalar& a, const SimdPack<ScalarT, width>& b)              \
+    { return SimdPack<ScalarT, width>(a) OP b; }
+
+OPM_SIMD_PACK_SCALAR_OP(+)
+OPM_SIMD_PACK_SCALAR_OP(-)
+OPM_SIMD_PACK_SCALAR_OP(*)
+OPM_SIMD_PACK_SCALAR_OP(/)
+
+#undef OPM_SIMD_PACK_SCALAR_OP
+
+#define OPM_SIMD_PACK_SCALAR_CMP(OP)                                                \
+    template <class ScalarT, int width, class RhsScalar>                            \
+    typename std::enable_if<std::is_arithmetic<RhsScalar>::value,                   \
+                            SimdMask<width> >::type                                 \
+    operator OP(const SimdPack<ScalarT, width>& a, const RhsScalar& b)              \
+    { return a OP SimdPack<ScalarT, width>(b); }                                    \
+                                                                                    \
+    template <class ScalarT, int width, class LhsScalar>                            \
+    typename std::enable_if<std::is_arithmetic<LhsScalar>::value,                   \
+                            SimdMask<width> >::type                                 \
+    operator OP(const LhsScalar& a, const SimdPack<ScalarT, width>& b)              \
+    { return SimdPack<ScalarT, width>(a) OP b; }
+
+OPM_SIMD_PACK_SCALAR_CMP(<)
+OPM_SIMD_PACK_SCALAR_CMP(>)
+OPM_SIMD_PACK_SCALAR_CMP(<=)
+OPM_SIMD_PACK_SCALAR_CMP(>=)
+OPM_SIMD_PACK_SCALAR_CMP(==)
+OPM_SIMD_PACK_SCALAR_CMP(!=)
+
+#undef OPM_SIMD_PACK_SCALAR_CMP
+
+//! Lane-wise choice between two packs: mask[i] ? a[i] : b[i]
+template <class ScalarT, int width>
+SimdPack<ScalarT, width> select(const SimdMask<width>& mask,
+                                const SimdPack<ScalarT, width>& a,
+                                const SimdPack<ScalarT, width>& b)
+{
+    SimdPack<ScalarT, width> result;
+    for (int i = 0; i < width; ++i)
+        result[i] = mask[i] ? a[i] : b[i];
+    return result;
+}
+
+//! The scalar counterpart of the lane-wise select()
+template <class Scalar>
+typename std::enable_if<std::is_floating_point<Scalar>::value, Scalar>::type
+select(bool mask, const Scalar& a, const Scalar& b)
+{ return mask ? a : b; }
+
+//! Return a single lane of an evaluation with a pack as its value type.
+template <class ScalarT, int width, int numVars, unsigned staticSize>
+Evaluation<ScalarT, numVars, staticSize>
+extractLane(const Evaluation<SimdPack<ScalarT, width>, numVars, staticSize>& eval, int laneIdx)
+{
+    Evaluation<ScalarT, numVars, staticSize> result;
+    result.setValue(eval.value()[laneIdx]);
+    for (int varIdx = 0; varIdx < eval.size(); ++varIdx)
+        result.setDerivative(varIdx, eval.derivative(varIdx)[laneIdx]);
+
+    return result;
+}
+
+//! Set a single lane of an evaluation with a pack as its value type.
+template <class ScalarT, int width, int numVars, unsigned staticSize>
+void insertLane(Evaluation<SimdPack<ScalarT, width>, numVars, staticSize>& eval,
+                int laneIdx,
+                const Evaluation<ScalarT, numVars, staticSize>& laneEval)
+{
+    auto value = eval.value();
+    value[laneIdx] = laneEval.value();
+    eval.setValue(value);
+
+    for (int varIdx = 0; varIdx < eval.size(); ++varIdx) {
+        auto deriv = eval.derivative(varIdx);
+        deriv[laneIdx] = laneEval.derivative(varIdx);
+        eval.setDerivative(varIdx, deriv);
+    }
+}
+
+} // namespace DenseAd
+
+template <class ScalarT, int width>
+struct MathToolbox<DenseAd::SimdPack<ScalarT, width>>
+{
+    typedef ScalarT Scalar;
+    typedef DenseAd::SimdPack<ScalarT, width> ValueType;
+    typedef MathToolbox<Scalar> InnerToolbox;
+    typedef DenseAd::SimdMask<width> Mask;
+
+    static ValueType value(const ValueType& value)
+    { return value; }
+
+    // a pack does not have a single primitive scalar value. this is only declared
+    // so that the toolbox of packed evaluations can be instantiated; calling it fails
+    // to compile.
+    template <class T>
+    static Scalar scalarValue(const T&)
+    {
+        static_assert(!std::is_same<T, ValueType>::value,
+                      "SIMD packs do not have a single scalar value");
+        return Scalar();
+    }
+
+    static ValueType createBlank(const ValueType&)
+    { return ValueType(); }
+
+    static ValueType createConstant(Scalar value)
+    { return ValueType(value); }
+
+    static ValueType createConstant(const ValueType& value)
+    { return value; }
+
+    static ValueType createConstant(unsigned numDerivatives, const ValueType& value)
+    {
+        if (numDerivatives != 0)
+            throw std::logic_error("SIMD packs cannot represent any derivatives");
+        return value;
+    }
+
+    static ValueType createConstant(const ValueType&, const ValueType& value)
+    { return value; }
+
+    template <class LhsEval>
+    static typename std::enable_if<std::is_same<ValueType, LhsEval>::value, LhsEval>::type
+    decay(const ValueType& value)
+    { return value; }
+
+    static bool isSame(const ValueType& a, const ValueType& b, Scalar tolerance)
+    {
+        for (int i = 0; i < width; ++i)
+            if (!InnerToolbox::isSame(a[i], b[i], tolerance))
+                return false;
+
+        return true;
+    }
+
+    static ValueType select(const Mask& mask, const ValueType& a, const ValueType& b)
+    { return DenseAd::select(mask, a, b); }
+
+    static ValueType max(const ValueType& arg1, const ValueType& arg2)
+    { return arg1.apply(arg2, [](Scalar x, Scalar y) { return std::max(x, y); }); }
+
+    static ValueType min(const ValueType& arg1, const ValueType& arg2)
+    { return arg1.apply(arg2, [](Scalar x, Scalar y) { return std::min(x, y); }); }
+
+    static ValueType abs(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::abs(x); }); }
+
+    static ValueType tan(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::tan(x); }); }
+
+    static ValueType atan(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::atan(x); }); }
+
+    static ValueType atan2(const ValueType& arg1, const ValueType& arg2)
+    { return arg1.apply(arg2, [](Scalar x, Scalar y) { return std::atan2(x, y); }); }
+
+    static ValueType sin(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::sin(x); }); }
+
+    static ValueType asin(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::asin(x); }); }
+
+    static ValueType sinh(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::sinh(x); }); }
+
+    static ValueType asinh(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::asinh(x); }); }
+
+    static ValueType cos(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::cos(x); }); }
+
+    static ValueType acos(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::acos(x); }); }
+
+    static ValueType cosh(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::cosh(x); }); }
+
+    static ValueType acosh(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::acosh(x); }); }
+
+    static ValueType sqrt(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::sqrt(x); }); }
+
+    static ValueType exp(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::exp(x); }); }
+
+    static ValueType log10(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::log10(x); }); }
+
+    static ValueType log(const ValueType& arg)
+    { return arg.apply([](Scalar x) { return std::log(x); }); }
+
+    static ValueType pow(const ValueType& base, const ValueType& exp)
+    { return base.apply(exp, [](Scalar x, Scalar y) { return std::pow(x, y); }); }
+
+    //! Return true iff all lanes are finite values
+    static bool isfinite(const ValueType& arg)
+    {
+        for (int i = 0; i < width; ++i)
+            if (!std::isfinite(arg[i]))
+                return false;
+
+        return true;
+    }
+
+    //! Return true iff all lanes are NaN values. Use !isfinite() to detect a NaN
+    //! value in any lane.
+    static bool isnan(const ValueType& arg)
+    {
+        for (int i = 0; i < width; ++i)
+            if (!std::isnan(arg[i]))
+                return false;
+
+        return true;
+    }
+};
+
+} // namespace Opm
+
+#endif // OPM_DENSEAD_SIMD_PACK_HPP
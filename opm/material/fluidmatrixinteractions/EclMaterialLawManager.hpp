@@ -42,8 +42,10 @@
 #include <opm/material/fluidmatrixinteractions/DirectionalMaterialLawParams.hpp>
 
 #include <cassert>
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <tuple>
 #include <vector>
 
@@ -157,6 +159,10 @@ private:
         void copyIntArray_(std::vector<int>& dest, const std::string keyword,
                            const std::function<std::vector<int>(const FieldPropsManager&, const std::string&,
                            const unsigned int, bool)>& fieldPropIntOnLeafAssigner);
+        // \brief Calls 'fn(elemIdx)' for all cells, using multiple threads if OpenMP
+        //        is available. Cells must not depend on each other.
+        template <class Function>
+        void forEachElement_(std::size_t numElems, Function&& fn);
         unsigned imbRegion_(std::vector<int>& array, unsigned elemIdx);
         void initArrays_(
                          std::vector<std::vector<int>*>& satnumArray,
@@ -179,6 +185,10 @@ private:
         void readUnscaledEpsPoints_(Container& dest, std::shared_ptr<EclEpsConfig> config, EclTwoPhaseSystemType system_type);
         unsigned satRegion_(std::vector<int>& array, unsigned elemIdx);
         unsigned satOrImbRegion_(std::vector<int>& array, std::vector<int>& default_vec, unsigned elemIdx);
+        // \brief Returns the end-point region of a cell if none of its scaled end points
+        //        deviate from the unscaled ones of that region, std::nullopt otherwise.
+        std::optional<unsigned> unscaledEpsRegion_(unsigned elemIdx,
+                                                   const std::function<unsigned(unsigned)>& lookupIdxOnLevelZeroAssigner);
 
         // This class' implementation is defined in "EclMaterialLawManagerHystParams.cpp"
         class HystParams {
@@ -277,6 +287,8 @@ public:
     //        field properties of cells on the leaf grid view for CpGrid with local grid refinement.
     //        Function argument 'lookupIdxOnLevelZeroAssigner' is added to lookup, for each
     //        leaf gridview cell with index 'elemIdx', its 'lookupIdx' (index of the parent/equivalent cell on level zero).
+    //        Both functions are only called from the calling thread, also when the
+    //        cells are initialized in parallel.
     void initParamsForElements(const EclipseState& eclState, size_t numCompressedElems,
                                const std::function<std::vector<int>(const FieldPropsManager&, const std::string&,
                                const unsigned int,bool)>& fieldPropIntOnLeafAssigner,
@@ -314,6 +326,33 @@ public:
     bool enableHysteresis() const
     { return hysteresisConfig_->enableHysteresis(); }
 
+    /*!
+     * \brief Let cells without end-point scaling share the two-phase parameter objects
+     *        of their saturation region.
+     *
+     * This must be called before initParamsForElements() and only has an effect if
+     * hysteresis is disabled. Cells whose scaled end points are identical to the
+     * unscaled ones of their region then refer to a single set of gas-oil, oil-water
+     * and gas-water parameters per region instead of owning a copy each. Cells which
+     * are modified by applySwatinit() or applyRestartSwatInit() receive their own
+     * oil-water parameters, and cells passed to connectionMaterialLawParams() their
+     * own two-phase parameters.
+     */
+    void setRegionSharedParams(bool value)
+    { regionSharedParams_ = value; }
+
+    bool regionSharedParams() const
+    { return regionSharedParams_; }
+
+    /*!
+     * \brief The three-phase approach used by the material law parameters of all cells.
+     *
+     * This can be passed to MaterialLaw::visit() to evaluate the material law without
+     * dispatching on the approach for every cell.
+     */
+    EclMultiplexerApproach threePhaseApproach() const
+    { return threePhaseApproach_; }
+
     MaterialLawParams& materialLawParams(unsigned elemIdx)
     {
         assert(elemIdx <  materialLawParams_.size());
@@ -421,6 +460,9 @@ public:
 private:
     const MaterialLawParams& materialLawParamsFunc_(unsigned elemIdx, FaceDir::DirEnum facedir) const;
 
+    void detachOilWaterParams_(unsigned elemIdx);
+    static void detachTwoPhaseParams_(MaterialLawParams& materialParams);
+
     void readGlobalEpsOptions_(const EclipseState& eclState);
 
     void readGlobalHysteresisOptions_(const EclipseState& state);
@@ -428,6 +470,10 @@ private:
     void readGlobalThreePhaseOptions_(const Runspec& runspec);
 
     bool enableEndPointScaling_;
+    bool regionSharedParams_ = false;
+    // Cells which still share the two-phase parameters of their region.  Empty
+    // unless region shared parameters are enabled.
+    mutable std::vector<bool> sharedTwoPhaseParams_;
     std::shared_ptr<EclHysteresisConfig> hysteresisConfig_;
     std::vector<std::shared_ptr<WagHysteresisConfig::WagHysteresisConfigRecord>> wagHystersisConfig_;
 
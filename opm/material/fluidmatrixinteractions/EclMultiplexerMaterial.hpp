@@ -37,6 +37,7 @@
 
 #include <algorithm>
 #include <stdexcept>
+#include <type_traits>
 
 namespace Opm {
 
@@ -601,6 +602,90 @@ public:
         }
         return false;
     }
+
+    /*!
+     * \brief The three-phase law of a fixed approach.
+     *
+     * The methods take the parameters of the multiplexer, but call the law of the
+     * approach directly instead of switching on the approach stored in the
+     * parameters.
+     */
+    template <EclMultiplexerApproach approachV>
+    class ApproachMaterial
+    {
+        using Law = std::conditional_t<approachV == EclMultiplexerApproach::Stone1, Stone1Material,
+                    std::conditional_t<approachV == EclMultiplexerApproach::Stone2, Stone2Material,
+                    std::conditional_t<approachV == EclMultiplexerApproach::Default, DefaultMaterial,
+                                       TwoPhaseMaterial>>>;
+
+    public:
+        static constexpr EclMultiplexerApproach approach = approachV;
+
+        template <class ContainerT, class FluidState>
+        static void capillaryPressures(ContainerT& values,
+                                       const Params& params,
+                                       const FluidState& fluidState)
+        {
+            if constexpr (approachV == EclMultiplexerApproach::OnePhase)
+                values[0] = 0.0;
+            else
+                Law::capillaryPressures(values, params.template getRealParams<approachV>(), fluidState);
+        }
+
+        template <class ContainerT, class FluidState>
+        static void relativePermeabilities(ContainerT& values,
+                                           const Params& params,
+                                           const FluidState& fluidState)
+        {
+            if constexpr (approachV == EclMultiplexerApproach::OnePhase)
+                values[0] = 1.0;
+            else
+                Law::relativePermeabilities(values, params.template getRealParams<approachV>(), fluidState);
+        }
+
+        template <class FluidState>
+        static bool updateHysteresis(Params& params, const FluidState& fluidState)
+        {
+            if constexpr (approachV == EclMultiplexerApproach::OnePhase)
+                return false;
+            else
+                return Law::updateHysteresis(params.template getRealParams<approachV>(), fluidState);
+        }
+    };
+
+    /*!
+     * \brief Call a function with the three-phase law of an approach.
+     *
+     * The approach is dispatched once and fn is called with an ApproachMaterial
+     * object, so that a loop over cells which all use this approach can call the
+     * law without any runtime dispatch. The cells of an EclMaterialLawManager all
+     * use the approach returned by its threePhaseApproach() method.
+     */
+    template <class Function>
+    static void visit(EclMultiplexerApproach approach, Function&& fn)
+    {
+        switch (approach) {
+        case EclMultiplexerApproach::Stone1:
+            fn(ApproachMaterial<EclMultiplexerApproach::Stone1>{});
+            break;
+
+        case EclMultiplexerApproach::Stone2:
+            fn(ApproachMaterial<EclMultiplexerApproach::Stone2>{});
+            break;
+
+        case EclMultiplexerApproach::Default:
+            fn(ApproachMaterial<EclMultiplexerApproach::Default>{});
+            break;
+
+        case EclMultiplexerApproach::TwoPhase:
+            fn(ApproachMaterial<EclMultiplexerApproach::TwoPhase>{});
+            break;
+
+        case EclMultiplexerApproach::OnePhase:
+            fn(ApproachMaterial<EclMultiplexerApproach::OnePhase>{});
+            break;
+        }
+    }
 };
 
 } // namespace Opm
@@ -40,7 +40,9 @@
 #include <opm/material/components/TabulatedComponent.hpp>
 #include <opm/material/binarycoefficients/H2O_CO2.hpp>
 #include <opm/material/binarycoefficients/Brine_CO2.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineGasTables.hpp>
 
+#include <type_traits>
 #include <vector>
 
 namespace Opm {
@@ -168,6 +170,44 @@ public:
         activityModel_ = activityModel;
     }
 
+    /*!
+     * \brief Evaluate the CO2 solubility and the brine densities using bicubic tables.
+     *
+     * The tables are sampled from the correlations, so this must be called after the
+     * salinities, the activity model and the salt concentration option have been
+     * specified. States outside of the tabulated range are still evaluated by the
+     * correlations.
+     */
+    void setTabulation(const BrineGasTabulationParams<Scalar>& params)
+    {
+        tables_.build(params, salinity_, enableSaltConcentration_,
+                      [this](const auto& T, const auto& p, Scalar salinity)
+                      {
+                          using Eval = std::decay_t<decltype(T)>;
+                          Eval xgH2O;
+                          Eval xlCO2;
+                          BinaryCoeffBrineCO2::calculateMoleFractions(T, p, Eval(salinity),
+                                                                      /*knownPhaseIdx=*/-1,
+                                                                      xlCO2, xgH2O,
+                                                                      activityModel_,
+                                                                      extrapolate);
+                          return xlCO2;
+                      },
+                      [](const auto& T, const auto& p, Scalar salinity)
+                      {
+                          using Eval = std::decay_t<decltype(T)>;
+                          return Brine::liquidDensity(T, p, Eval(salinity), extrapolate);
+                      },
+                      [](const auto& T, const auto& p)
+                      { return H2O::liquidDensity(T, p, extrapolate); });
+    }
+
+    /*!
+     * \brief Returns the tables used for the solubility and the brine densities.
+     */
+    const BrineGasTables<Scalar>& tables() const
+    { return tables_; }
+
     /*!
      * \brief Return the number of PVT regions which are considered by this PVT-object.
      */
@@ -425,10 +465,11 @@ public:
     {
 	OPM_TIMEFUNCTION_LOCAL();        
 	Evaluation xlCO2 = convertXoGToxoG_(convertRsToXoG_(Rs,regionIdx), salinity);
-        Evaluation result = liquidDensity_(temperature,
-                                        pressure,
-                                        xlCO2,
-                                        salinity);
+        Evaluation result = liquidDensity_(regionIdx,
+                                           temperature,
+                                           pressure,
+                                           xlCO2,
+                                           salinity);
 
         Valgrind::CheckDefined(result);
         return result;
@@ -448,14 +489,19 @@ public:
         // temperature and pressure. 
         Evaluation xgH2O;
         Evaluation xlCO2;
-        BinaryCoeffBrineCO2::calculateMoleFractions(temperature,
-                                                    pressure,
-                                                    salinity,
-                                                    /*knownPhaseIdx=*/-1,
-                                                    xlCO2,
-                                                    xgH2O,
-                                                    activityModel_,
-                                                    extrapolate);
+        if (tables_.applies(temperature, pressure, salinity)) {
+            xlCO2 = tables_.moleFraction(regionIdx, temperature, pressure, salinity);
+        }
+        else {
+            BinaryCoeffBrineCO2::calculateMoleFractions(temperature,
+                                                        pressure,
+                                                        salinity,
+                                                        /*knownPhaseIdx=*/-1,
+                                                        xlCO2,
+                                                        xgH2O,
+                                                        activityModel_,
+                                                        extrapolate);
+        }
 
         // normalize the phase compositions
         xlCO2 = max(0.0, min(1.0, xlCO2));
@@ -470,9 +516,11 @@ private:
     bool enableDissolution_ = true;
     bool enableSaltConcentration_ = false;
     int activityModel_;
+    BrineGasTables<Scalar> tables_;
 
     template <class LhsEval>
-    LhsEval liquidDensity_(const LhsEval& T,
+    LhsEval liquidDensity_(unsigned regionIdx,
+                           const LhsEval& T,
                            const LhsEval& pl,
                            const LhsEval& xlCO2,
                            const LhsEval& salinity) const
@@ -497,9 +545,17 @@ private:
             throw NumericalProblem(msg);
         }
 
-        const LhsEval& rho_brine = Brine::liquidDensity(T, pl, salinity, extrapolate);
-        const LhsEval& rho_pure = H2O::liquidDensity(T, pl, extrapolate);
-        const LhsEval& rho_lCO2 = liquidDensityWaterCO2_(T, pl, xlCO2);
+        LhsEval rho_brine;
+        LhsEval rho_pure;
+        if (tables_.applies(T, pl, salinity)) {
+            rho_brine = tables_.brineDensity(regionIdx, T, pl, salinity);
+            rho_pure = tables_.waterDensity(T, pl);
+        }
+        else {
+            rho_brine = Brine::liquidDensity(T, pl, salinity, extrapolate);
+            rho_pure = H2O::liquidDensity(T, pl, extrapolate);
+        }
+        const LhsEval& rho_lCO2 = liquidDensityWaterCO2_(T, xlCO2, rho_pure);
         const LhsEval& contribCO2 = rho_lCO2 - rho_pure;
 
         return rho_brine + contribCO2;
@@ -507,15 +563,14 @@ private:
 
     template <class LhsEval>
     LhsEval liquidDensityWaterCO2_(const LhsEval& temperature,
-                                          const LhsEval& pl,
-                                          const LhsEval& xlCO2) const
+                                   const LhsEval& xlCO2,
+                                   const LhsEval& rho_pure) const
     {
         OPM_TIMEFUNCTION_LOCAL();
         Scalar M_CO2 = CO2::molarMass();
         Scalar M_H2O = H2O::molarMass();
 
         const LhsEval& tempC = temperature - 273.15;        /* tempC : temperature in °C */
-        const LhsEval& rho_pure = H2O::liquidDensity(temperature, pl, extrapolate);
         // calculate the mole fraction of CO2 in the liquid. note that xlH2O is available
         // as a function parameter, but in the case of a pure gas phase the value of M_T
         // for the virtual liquid phase can become very large
@@ -0,0 +1,332 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::BrineGasTables
+ */
+#ifndef OPM_BRINE_GAS_TABLES_HPP
+#define OPM_BRINE_GAS_TABLES_HPP
+
+#include <opm/material/common/HermiteTabulated2DFunction.hpp>
+#include <opm/material/common/MathToolbox.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace Opm {
+
+/*!
+ * \brief Resolution and accuracy of the tabulated brine-gas properties.
+ *
+ * The tables cover the given temperature and pressure ranges. If the salinity is
+ * taken from the salt concentration of the fluid state, the salinities between zero
+ * and maxSalinity are covered as well. Outside of these ranges the analytic
+ * correlations are used.
+ */
+template <class Scalar>
+struct BrineGasTabulationParams
+{
+    Scalar minTemperature = 273.15 + 5.0; // [K]
+    Scalar maxTemperature = 273.15 + 180.0; // [K]
+    unsigned numTemperatures = 71;
+
+    Scalar minPressure = 1.0e5; // [Pa]
+    Scalar maxPressure = 6.0e7; // [Pa]
+    unsigned numPressures = 121;
+
+    Scalar maxSalinity = 0.26; // mass fraction of NaCl [-]
+    unsigned numSalinities = 40;
+
+    //! Maximum interpolation error of the mole fraction of the gas in brine, relative
+    //! to the largest mole fraction within the tabulated ranges. Below the critical
+    //! temperature of CO2 the solubility changes abruptly across the vapour-liquid
+    //! boundary of the CO2, so refining the resolution only reduces this error slowly.
+    Scalar moleFractionTolerance = 1e-2;
+
+    //! Maximum interpolation error of the brine and water densities, relative to the
+    //! largest density within the tabulated ranges. This is about 0.01 kg/m^3 and is
+    //! dominated by the linear interpolation between the sampled salinities.
+    Scalar densityTolerance = 1e-5;
+
+    //! Number of times the resolution is doubled if a tolerance is not met, before
+    //! giving up.
+    unsigned maxRefinements = 1;
+};
+
+/*!
+ * \brief Tabulated solubility of a gas in brine and the densities of brine and pure
+ *        water as functions of temperature and pressure.
+ *
+ * This class is used by the brine-gas PVT classes to avoid the evaluation of the
+ * analytic activity, fugacity and density correlations for every cell. For each
+ * salinity a separate set of tables is kept; for a fixed salinity per PVT region
+ * these are the salinities of the regions, otherwise the interval of possible
+ * salinities is sampled uniformly and the tables are interpolated linearly in
+ * between.
+ */
+template <class Scalar>
+class BrineGasTables
+{
+public:
+    using Params = BrineGasTabulationParams<Scalar>;
+    using Table = HermiteTabulated2DFunction<Scalar>;
+
+    /*!
+     * \brief Build the tables.
+     *
+     * The functions are called as moleFraction(T, p, salinity), brineDensity(T, p,
+     * salinity) and waterDensity(T, p) with T and p being evaluations and the salinity
+     * a scalar. The resolution is increased until the interpolation errors at the
+     * centers of the table intervals are below the tolerances of the properties. If a
+     * tolerance is not met after the maximum number of refinements,
+     * std::runtime_error is thrown and the tables are left inactive.
+     */
+    template <class MoleFractionFn, class BrineDensityFn, class WaterDensityFn>
+    void build(const Params& params,
+               const std::vector<Scalar>& regionSalinities,
+               bool variableSalinity,
+               MoleFractionFn&& moleFraction,
+               BrineDensityFn&& brineDensity,
+               WaterDensityFn&& waterDensity)
+    {
+        variableSalinity_ = variableSalinity;
+        maxSalinity_ = params.maxSalinity;
+
+        std::vector<Scalar> salinities = regionSalinities;
+        unsigned numT = params.numTemperatures;
+        unsigned numP = params.numPressures;
+        unsigned numS = params.numSalinities;
+        for (unsigned refinement = 0; ; ++refinement) {
+            if (variableSalinity_) {
+                salinities.resize(numS);
+                for (unsigned k = 0; k < numS; ++k)
+                    salinities[k] = maxSalinity_*k/(numS - 1);
+            }
+
+            sample_(params, numT, numP, salinities, moleFraction, brineDensity, waterDensity);
+            estimateErrors_(moleFraction, brineDensity, waterDensity);
+            if (moleFractionError_ <= params.moleFractionTolerance &&
+                densityError_ <= params.densityTolerance)
+                break;
+
+            if (refinement >= params.maxRefinements) {
+                const Scalar moleFractionError = moleFractionError_;
+                const Scalar densityError = densityError_;
+                *this = BrineGasTables{};
+                throw std::runtime_error(fmt::format("The interpolation errors of the tabulated "
+                                                     "brine-gas mole fraction ({:.3e}) and "
+                                                     "densities ({:.3e}) exceed the tolerances "
+                                                     "{:.3e} and {:.3e} after {} refinements",
+                                                     moleFractionError, densityError,
+                                                     params.moleFractionTolerance,
+                                                     params.densityTolerance,
+                                                     params.maxRefinements));
+            }
+
+            numT = 2*numT - 1;
+            numP = 2*numP - 1;
+            numS = 2*numS - 1;
+        }
+    }
+
+    /*!
+     * \brief Returns true if the tables have been built.
+     */
+    bool active() const
+    { return waterDensity_.numX() > 0; }
+
+    /*!
+     * \brief The largest relative interpolation error of the mole fraction found when
+     *        building the tables.
+     */
+    Scalar moleFractionError() const
+    { return moleFractionError_; }
+
+    /*!
+     * \brief The largest relative interpolation error of the brine and water densities
+     *        found when building the tables.
+     */
+    Scalar densityError() const
+    { return densityError_; }
+
+    /*!
+     * \brief Returns true if a state is covered by the tables.
+     */
+    template <class Evaluation>
+    bool applies(const Evaluation& temperature,
+                 const Evaluation& pressure,
+                 const Evaluation& salinity) const
+    {
+        if (!active() || !waterDensity_.applies(temperature, pressure))
+            return false;
+
+        return !variableSalinity_ || (0.0 <= salinity && salinity <= maxSalinity_);
+    }
+
+    /*!
+     * \brief The mole fraction of the gas component in brine saturated with gas.
+     */
+    template <class Evaluation>
+    Evaluation moleFraction(unsigned regionIdx,
+                            const Evaluation& temperature,
+                            const Evaluation& pressure,
+                            const Evaluation& salinity) const
+    { return eval_(moleFraction_, regionIdx, temperature, pressure, salinity); }
+
+    /*!
+     * \brief The density of brine without any dissolved gas [kg/m^3].
+     */
+    template <class Evaluation>
+    Evaluation brineDensity(unsigned regionIdx,
+                            const Evaluation& temperature,
+                            const Evaluation& pressure,
+                            const Evaluation& salinity) const
+    { return eval_(brineDensity_, regionIdx, temperature, pressure, salinity); }
+
+    /*!
+     * \brief The density of pure water [kg/m^3].
+     */
+    template <class Evaluation>
+    Evaluation waterDensity(const Evaluation& temperature,
+                            const Evaluation& pressure) const
+    { return waterDensity_.eval(temperature, pressure); }
+
+private:
+    template <class MoleFractionFn, class BrineDensityFn, class WaterDensityFn>
+    void sample_(const Params& params,
+                 unsigned numT, unsigned numP,
+                 const std::vector<Scalar>& salinities,
+                 MoleFractionFn& moleFraction,
+                 BrineDensityFn& brineDensity,
+                 WaterDensityFn& waterDensity)
+    {
+        const auto resized = [&](Table& table) {
+            table.resize(params.minTemperature, params.maxTemperature, numT,
+                         params.minPressure, params.maxPressure, numP);
+        };
+
+        salinities_ = salinities;
+        moleFraction_.resize(salinities.size());
+        brineDensity_.resize(salinities.size());
+        for (std::size_t k = 0; k < salinities.size(); ++k) {
+            const Scalar salinity = salinities[k];
+            resized(moleFraction_[k]);
+            moleFraction_[k].sample([&](const auto& T, const auto& p)
+                                    { return moleFraction(T, p, salinity); });
+            resized(brineDensity_[k]);
+            brineDensity_[k].sample([&](const auto& T, const auto& p)
+                                    { return brineDensity(T, p, salinity); });
+        }
+        resized(waterDensity_);
+        waterDensity_.sample([&](const auto& T, const auto& p)
+                             { return waterDensity(T, p); });
+    }
+
+    template <class MoleFractionFn, class BrineDensityFn, class WaterDensityFn>
+    void estimateErrors_(MoleFractionFn& moleFraction,
+                         BrineDensityFn& brineDensity,
+                         WaterDensityFn& waterDensity)
+    {
+        const auto relativeError = [](const std::vector<Scalar>& approx,
+                                      const std::vector<Scalar>& exact)
+        {
+            Scalar scale = 0.0;
+            for (const auto& value : exact)
+                scale = std::max(scale, std::abs(value));
+            Scalar maxError = 0.0;
+            if (scale <= 0.0)
+                return maxError;
+            for (std::size_t idx = 0; idx < exact.size(); ++idx)
+                maxError = std::max(maxError, std::abs(approx[idx] - exact[idx])/scale);
+            return maxError;
+        };
+
+        // check the centers of the temperature-pressure intervals and, for variable
+        // salinities, the midpoints between the sampled salinities
+        std::vector<Scalar> salinities = salinities_;
+        if (variableSalinity_) {
+            for (std::size_t k = 0; k + 1 < salinities_.size(); ++k)
+                salinities.push_back(0.5*(salinities_[k] + salinities_[k + 1]));
+        }
+
+        const auto& grid = waterDensity_;
+        std::vector<Scalar> approxXl, exactXl, approxRho, exactRho, approxRhoW, exactRhoW;
+        for (unsigned j = 0; j + 1 < grid.numY(); ++j) {
+            const Scalar p = 0.5*(grid.jToY(j) + grid.jToY(j + 1));
+            for (unsigned i = 0; i + 1 < grid.numX(); ++i) {
+                const Scalar T = 0.5*(grid.iToX(i) + grid.iToX(i + 1));
+                for (std::size_t k = 0; k < salinities.size(); ++k) {
+                    const Scalar S = salinities[k];
+                    const unsigned regionIdx = static_cast<unsigned>(std::min(k, salinities_.size() - 1));
+                    approxXl.push_back(eval_(moleFraction_, regionIdx, T, p, S));
+                    exactXl.push_back(moleFraction(T, p, S));
+                    approxRho.push_back(eval_(brineDensity_, regionIdx, T, p, S));
+                    exactRho.push_back(brineDensity(T, p, S));
+                }
+                approxRhoW.push_back(waterDensity_.eval(T, p));
+                exactRhoW.push_back(waterDensity(T, p));
+            }
+        }
+        moleFractionError_ = relativeError(approxXl, exactXl);
+        densityError_ = std::max(relativeError(approxRho, exactRho),
+                                 relativeError(approxRhoW, exactRhoW));
+    }
+
+    template <class Evaluation>
+    Evaluation eval_(const std::vector<Table>& tables,
+                     unsigned regionIdx,
+                     const Evaluation& temperature,
+                     const Evaluation& pressure,
+                     const Evaluation& salinity) const
+    {
+        if (!variableSalinity_)
+            return tables[regionIdx].eval(temperature, pressure);
+
+        const Scalar h = maxSalinity_/(tables.size() - 1);
+        const Evaluation alpha = salinity/h;
+        const unsigned k =
+            static_cast<unsigned>(std::max(0, std::min(static_cast<int>(tables.size()) - 2,
+                                                       static_cast<int>(scalarValue(alpha)))));
+        const Evaluation t = alpha - k;
+        return tables[k].eval(temperature, pressure)*(1.0 - t)
+            + tables[k + 1].eval(temperature, pressure)*t;
+    }
+
+    std::vector<Table> moleFraction_;
+    std::vector<Table> brineDensity_;
+    Table waterDensity_;
+
+    std::vector<Scalar> salinities_;
+    bool variableSalinity_ = false;
+    Scalar maxSalinity_ = 0.0;
+    Scalar moleFractionError_ = 0.0;
+    Scalar densityError_ = 0.0;
+};
+
+} // namespace Opm
+
+#endif
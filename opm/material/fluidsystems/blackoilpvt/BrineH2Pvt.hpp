@@ -35,7 +35,9 @@ copyright holders.
 #include <opm/material/components/H2.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 #include <opm/material/common/Valgrind.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineGasTables.hpp>
 
+#include <type_traits>
 #include <vector>
 
 namespace Opm {
@@ -132,6 +134,37 @@ public:
     void setEnableSaltConcentration(bool yesno)
     { enableSaltConcentration_ = yesno; }
 
+    /*!
+    * \brief Evaluate the H2 solubility and the brine densities using bicubic tables.
+    *
+    * The tables are sampled from the correlations, so this must be called after the
+    * salinities and the salt concentration option have been specified. States outside
+    * of the tabulated range are still evaluated by the correlations.
+    */
+    void setTabulation(const BrineGasTabulationParams<Scalar>& params)
+    {
+        tables_.build(params, salinity_, enableSaltConcentration_,
+                      [](const auto& T, const auto& p, Scalar salinity)
+                      {
+                          using Eval = std::decay_t<decltype(T)>;
+                          return BinaryCoeffBrineH2::calculateMoleFractions(T, p, Eval(salinity),
+                                                                            extrapolate);
+                      },
+                      [](const auto& T, const auto& p, Scalar salinity)
+                      {
+                          using Eval = std::decay_t<decltype(T)>;
+                          return Brine::liquidDensity(T, p, Eval(salinity), extrapolate);
+                      },
+                      [](const auto& T, const auto& p)
+                      { return H2O::liquidDensity(T, p, extrapolate); });
+    }
+
+    /*!
+    * \brief Returns the tables used for the solubility and the brine densities.
+    */
+    const BrineGasTables<Scalar>& tables() const
+    { return tables_; }
+
     /*!
     * \brief Return the number of PVT regions which are considered by this PVT-object.
     */
@@ -395,6 +428,7 @@ private:
     std::vector<Scalar> salinity_;
     bool enableDissolution_ = true;
     bool enableSaltConcentration_ = false;
+    BrineGasTables<Scalar> tables_;
 
     /*!
     * \brief Calculate density of aqueous solution (H2O-NaCl/brine and H2).
@@ -414,7 +448,8 @@ private:
         LhsEval xlH2 = convertXoGToxoG_(convertRsToXoG_(Rs,regionIdx), salinity);
 
         // calculate the density of solution
-        LhsEval result = liquidDensity_(temperature,
+        LhsEval result = liquidDensity_(regionIdx,
+                                        temperature,
                                         pressure,
                                         xlH2,
                                         salinity);
@@ -427,12 +462,14 @@ private:
     * \brief Calculated the density of the aqueous solution where contributions of salinity and dissolved H2 is taken
     * into account.
     * 
+    * \param regionIdx region index
     * \param T temperature [K]
     * \param pl liquid pressure [Pa]
     * \param xlH2 mole fraction H2 [-]
     */
     template <class LhsEval>
-    LhsEval liquidDensity_(const LhsEval& T,
+    LhsEval liquidDensity_(unsigned regionIdx,
+                           const LhsEval& T,
                            const LhsEval& pl,
                            const LhsEval& xlH2,
                            const LhsEval& salinity) const
@@ -459,9 +496,17 @@ private:
         }
 
         // calculate individual contribution to density
-        const LhsEval& rho_brine = Brine::liquidDensity(T, pl, salinity, extrapolate);
-        const LhsEval& rho_pure = H2O::liquidDensity(T, pl, extrapolate);
-        const LhsEval& rho_lH2 = liquidDensityWaterH2_(T, pl, xlH2);
+        LhsEval rho_brine;
+        LhsEval rho_pure;
+        if (tables_.applies(T, pl, salinity)) {
+            rho_brine = tables_.brineDensity(regionIdx, T, pl, salinity);
+            rho_pure = tables_.waterDensity(T, pl);
+        }
+        else {
+            rho_brine = Brine::liquidDensity(T, pl, salinity, extrapolate);
+            rho_pure = H2O::liquidDensity(T, pl, extrapolate);
+        }
+        const LhsEval& rho_lH2 = liquidDensityWaterH2_(T, pl, xlH2, rho_pure);
         const LhsEval& contribH2 = rho_lH2 - rho_pure;
 
         return rho_brine + contribH2;
@@ -474,19 +519,18 @@ private:
     * \param temperature [K]
     * \param pl liquid pressure [Pa]
     * \param xlH2 mole fraction [-]
+    * \param rho_pure density of pure water [kg/m^3]
     */
     template <class LhsEval>
     LhsEval liquidDensityWaterH2_(const LhsEval& temperature,
-                                          const LhsEval& pl,
-                                          const LhsEval& xlH2) const
+                                  const LhsEval& pl,
+                                  const LhsEval& xlH2,
+                                  const LhsEval& rho_pure) const
     {
         // molar masses
         Scalar M_H2 = H2::molarMass();
         Scalar M_H2O = H2O::molarMass();
 
-        // density of pure water
-        const LhsEval& rho_pure = H2O::liquidDensity(temperature, pl, extrapolate);
-
         // (apparent) molar volume of H2, Eq. (14) in Li et al. (2018)
         const LhsEval& A1 = 51.1904 - 0.208062*temperature + 3.4427e-4*(temperature*temperature);
         const LhsEval& A2 = -0.022;
@@ -578,7 +622,9 @@ private:
             return 0.0;
 
         // calulate the equilibrium composition for the given temperature and pressure
-        LhsEval xlH2 = BinaryCoeffBrineH2::calculateMoleFractions(temperature, pressure, salinity, extrapolate);
+        LhsEval xlH2 = tables_.applies(temperature, pressure, salinity)
+            ? tables_.moleFraction(regionIdx, temperature, pressure, salinity)
+            : BinaryCoeffBrineH2::calculateMoleFractions(temperature, pressure, salinity, extrapolate);
         
         // normalize the phase compositions
         xlH2 = max(0.0, min(1.0, xlH2));
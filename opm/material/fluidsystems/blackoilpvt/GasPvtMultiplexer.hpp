@@ -34,6 +34,7 @@
 #include "GasPvtThermal.hpp"
 #include "Co2GasPvt.hpp"
 #include "H2GasPvt.hpp"
+#include "PvtBatch.hpp"
 
 namespace Opm {
 
@@ -329,6 +330,32 @@ public:
                                   const Evaluation& Rv) const
     { OPM_GAS_PVT_MULTIPLEXER_CALL(return pvtImpl.saturationPressure(regionIdx, temperature, Rv)); return 0; }
 
+    /*!
+     * \brief Evaluate the PVT properties of gas for a batch of cells.
+     *
+     * The PVT approach is dispatched once for the whole batch and the cells are
+     * evaluated grouped by PVT region.  The mixing ratio of the input is the
+     * oil vaporization factor \f$R_v\f$ and the secondary input is the water
+     * vaporization factor \f$R_{vw}\f$.
+     */
+    template <class Evaluation>
+    void evaluateBatch(const PvtBatchInput<Evaluation>& input,
+                       const PvtBatchOutput<Evaluation>& output) const
+    { OPM_GAS_PVT_MULTIPLEXER_CALL(evaluateBatch_(pvtImpl, input, output)); }
+
+    /*!
+     * \brief Call a function with the PVT implementation selected for the deck.
+     *
+     * The PVT approach is dispatched once and fn is called with a reference to
+     * the object which implements the gas PVT, so that the calls made by fn are
+     * resolved at compile time and can be inlined into the caller's loop over the
+     * cells.  fn must accept all PVT implementations, i.e., it usually is a
+     * generic lambda.
+     */
+    template <class Function>
+    void visit(Function&& fn) const
+    { OPM_GAS_PVT_MULTIPLEXER_CALL(fn(pvtImpl)); }
+
     /*!
      * \copydoc BaseFluidSystem::diffusionCoefficient
      */
@@ -487,6 +514,46 @@ public:
 private:
     GasPvtApproach gasPvtApproach_;
     void* realGasPvt_;
+
+    template <class PvtImpl, class Evaluation>
+    void evaluateBatch_(const PvtImpl& pvtImpl,
+                        const PvtBatchInput<Evaluation>& input,
+                        const PvtBatchOutput<Evaluation>& output) const
+    {
+        const Evaluation zero = 0.0;
+
+        forEachCellByRegion(input.size, input.regionIdx,
+                            [&pvtImpl, &input, &output, &zero](const unsigned regionIdx,
+                                                               const std::size_t cellIdx)
+        {
+            const auto& T = input.temperature[cellIdx];
+            const auto& p = input.pressure[cellIdx];
+            const auto& Rv = (input.mixingRatio != nullptr) ? input.mixingRatio[cellIdx] : zero;
+            const auto& Rvw = (input.secondary != nullptr) ? input.secondary[cellIdx] : zero;
+
+            bool fused = false;
+            if constexpr (std::is_same_v<PvtImpl, WetGasPvt<Scalar>>) {
+                if (output.inverseFormationVolumeFactor != nullptr && output.viscosity != nullptr) {
+                    pvtImpl.inverseFormationVolumeFactorAndViscosity(regionIdx, T, p, Rv, Rvw,
+                                                                     output.inverseFormationVolumeFactor[cellIdx],
+                                                                     output.viscosity[cellIdx]);
+                    fused = true;
+                }
+            }
+
+            if (!fused) {
+                if (output.inverseFormationVolumeFactor != nullptr)
+                    output.inverseFormationVolumeFactor[cellIdx] = pvtImpl.inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+
+                if (output.viscosity != nullptr)
+                    output.viscosity[cellIdx] = pvtImpl.viscosity(regionIdx, T, p, Rv, Rvw);
+            }
+
+            if (output.saturatedMixingRatio != nullptr)
+                output.saturatedMixingRatio[cellIdx] = pvtImpl.saturatedOilVaporizationFactor(regionIdx, T, p);
+        });
+    }
+
 };
 
 } // namespace Opm
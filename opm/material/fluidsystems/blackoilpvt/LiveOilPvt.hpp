@@ -166,15 +166,43 @@ public:
      */
     template <class Evaluation>
     Evaluation viscosity(unsigned regionIdx,
-                         const Evaluation& /*temperature*/,
+                         const Evaluation& temperature,
                          const Evaluation& pressure,
                          const Evaluation& Rs) const
+    {
+        Evaluation invBo;
+        Evaluation muo;
+        inverseFormationVolumeFactorAndViscosity(regionIdx, temperature, pressure, Rs, invBo, muo);
+        return muo;
+    }
+
+    /*!
+     * \brief Returns the inverse formation volume factor [-] and the dynamic
+     *        viscosity [Pa s] of the fluid phase.
+     *
+     * Equivalent to inverseFormationVolumeFactor() and viscosity(), but shares
+     * the table lookup between the two.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactorAndViscosity(unsigned regionIdx,
+                                                  const Evaluation& /*temperature*/,
+                                                  const Evaluation& pressure,
+                                                  const Evaluation& Rs,
+                                                  Evaluation& invB,
+                                                  Evaluation& mu) const
     {
         // ATTENTION: Rs is the first axis!
-        const Evaluation& invBo = inverseOilBTable_[regionIdx].eval(Rs, pressure, /*extrapolate=*/true);
-        const Evaluation& invMuoBo = inverseOilBMuTable_[regionIdx].eval(Rs, pressure, /*extrapolate=*/true);
+        if (regionIdx < sharedInvBSampling_.size() && sharedInvBSampling_[regionIdx]) {
+            const auto [invBo, invMuoBo] = inverseOilBTable_[regionIdx]
+                .evalWith(inverseOilBMuTable_[regionIdx], Rs, pressure, /*extrapolate=*/true);
 
-        return invBo/invMuoBo;
+            invB = invBo;
+            mu = invBo/invMuoBo;
+            return;
+        }
+
+        invB = inverseOilBTable_[regionIdx].eval(Rs, pressure, /*extrapolate=*/true);
+        mu = invB/inverseOilBMuTable_[regionIdx].eval(Rs, pressure, /*extrapolate=*/true);
     }
 
     /*!
@@ -355,6 +383,13 @@ public:
     Scalar vapPar2() const
     { return vapPar2_; }
 
+    /*!
+     * \brief Returns true if the tables of 1/B and 1/(B*mu) of a region have the same
+     *        sampling points, so that both are evaluated with a single table lookup.
+     */
+    bool sharedInvBSampling(unsigned regionIdx) const
+    { return regionIdx < sharedInvBSampling_.size() && sharedInvBSampling_[regionIdx]; }
+
 private:
     void updateSaturationPressure_(unsigned regionIdx);
 
@@ -369,6 +404,11 @@ private:
     std::vector<TabulatedOneDFunction> saturatedGasDissolutionFactorTable_;
     std::vector<TabulatedOneDFunction> saturationPressure_;
 
+    // whether 1/B and 1/(B*mu) share sampling points in a region, allowing
+    // inverseFormationVolumeFactorAndViscosity() to evaluate both with a single
+    // table lookup.
+    std::vector<bool> sharedInvBSampling_;
+
     Scalar vapPar2_ = 0.0;
 };
 
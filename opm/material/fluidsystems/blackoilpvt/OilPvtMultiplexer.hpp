@@ -33,6 +33,7 @@
 #include "OilPvtThermal.hpp"
 #include "BrineCo2Pvt.hpp"
 #include "BrineH2Pvt.hpp"
+#include "PvtBatch.hpp"
 
 namespace Opm {
 
@@ -262,6 +263,31 @@ public:
                                   const Evaluation& Rs) const
     { OPM_OIL_PVT_MULTIPLEXER_CALL(return pvtImpl.saturationPressure(regionIdx, temperature, Rs)); return 0; }
 
+    /*!
+     * \brief Evaluate the PVT properties of oil for a batch of cells.
+     *
+     * The PVT approach is dispatched once for the whole batch and the cells are
+     * evaluated grouped by PVT region.  The mixing ratio of the input is the
+     * gas dissolution factor \f$R_s\f$.
+     */
+    template <class Evaluation>
+    void evaluateBatch(const PvtBatchInput<Evaluation>& input,
+                       const PvtBatchOutput<Evaluation>& output) const
+    { OPM_OIL_PVT_MULTIPLEXER_CALL(evaluateBatch_(pvtImpl, input, output)); }
+
+    /*!
+     * \brief Call a function with the PVT implementation selected for the deck.
+     *
+     * The PVT approach is dispatched once and fn is called with a reference to
+     * the object which implements the oil PVT, so that the calls made by fn are
+     * resolved at compile time and can be inlined into the caller's loop over the
+     * cells.  fn must accept all PVT implementations, i.e., it usually is a
+     * generic lambda.
+     */
+    template <class Function>
+    void visit(Function&& fn) const
+    { OPM_OIL_PVT_MULTIPLEXER_CALL(fn(pvtImpl)); }
+
     /*!
      * \copydoc BaseFluidSystem::diffusionCoefficient
      */
@@ -434,6 +460,45 @@ public:
 private:
     OilPvtApproach approach_;
     void* realOilPvt_;
+
+    template <class PvtImpl, class Evaluation>
+    void evaluateBatch_(const PvtImpl& pvtImpl,
+                        const PvtBatchInput<Evaluation>& input,
+                        const PvtBatchOutput<Evaluation>& output) const
+    {
+        const Evaluation zero = 0.0;
+
+        forEachCellByRegion(input.size, input.regionIdx,
+                            [&pvtImpl, &input, &output, &zero](const unsigned regionIdx,
+                                                               const std::size_t cellIdx)
+        {
+            const auto& T = input.temperature[cellIdx];
+            const auto& p = input.pressure[cellIdx];
+            const auto& Rs = (input.mixingRatio != nullptr) ? input.mixingRatio[cellIdx] : zero;
+
+            bool fused = false;
+            if constexpr (std::is_same_v<PvtImpl, LiveOilPvt<Scalar>>) {
+                if (output.inverseFormationVolumeFactor != nullptr && output.viscosity != nullptr) {
+                    pvtImpl.inverseFormationVolumeFactorAndViscosity(regionIdx, T, p, Rs,
+                                                                     output.inverseFormationVolumeFactor[cellIdx],
+                                                                     output.viscosity[cellIdx]);
+                    fused = true;
+                }
+            }
+
+            if (!fused) {
+                if (output.inverseFormationVolumeFactor != nullptr)
+                    output.inverseFormationVolumeFactor[cellIdx] = pvtImpl.inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+
+                if (output.viscosity != nullptr)
+                    output.viscosity[cellIdx] = pvtImpl.viscosity(regionIdx, T, p, Rs);
+            }
+
+            if (output.saturatedMixingRatio != nullptr)
+                output.saturatedMixingRatio[cellIdx] = pvtImpl.saturatedGasDissolutionFactor(regionIdx, T, p);
+        });
+    }
+
 };
 
 } // namespace Opm
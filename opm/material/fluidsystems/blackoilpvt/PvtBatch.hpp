@@ -0,0 +1,128 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::PvtBatchInput
+ */
+#ifndef OPM_PVT_BATCH_HPP
+#define OPM_PVT_BATCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Structure-of-arrays input for the batched evaluation methods of the
+ *        black-oil PVT multiplexers.
+ *
+ * All arrays are indexed by cell and must hold at least \c size elements.
+ * The meaning of the mixing ratios depends on the phase:
+ *
+ * - oil: \c mixingRatio is \f$R_s\f$, \c secondary is unused
+ * - gas: \c mixingRatio is \f$R_v\f$, \c secondary is \f$R_{vw}\f$
+ * - water: \c mixingRatio is \f$R_{sw}\f$, \c secondary is the salt concentration
+ *
+ * A null \c regionIdx means that all cells are in region zero and a null
+ * \c mixingRatio or \c secondary means that the quantity is zero.
+ */
+template <class Evaluation>
+struct PvtBatchInput
+{
+    std::size_t size{0};
+    const unsigned* regionIdx{nullptr};
+    const Evaluation* temperature{nullptr};
+    const Evaluation* pressure{nullptr};
+    const Evaluation* mixingRatio{nullptr};
+    const Evaluation* secondary{nullptr};
+};
+
+/*!
+ * \brief Structure-of-arrays output for the batched evaluation methods of the
+ *        black-oil PVT multiplexers.
+ *
+ * Outputs which are null pointers are not computed.  The saturated mixing
+ * ratio is \f$R_s\f$ of saturated oil, \f$R_v\f$ of saturated gas, or
+ * \f$R_{sw}\f$ of saturated water.
+ */
+template <class Evaluation>
+struct PvtBatchOutput
+{
+    Evaluation* inverseFormationVolumeFactor{nullptr};
+    Evaluation* viscosity{nullptr};
+    Evaluation* saturatedMixingRatio{nullptr};
+};
+
+/*!
+ * \brief Visit the cells of a batch grouped by PVT region.
+ *
+ * Calls fn(regionIdx, cellIdx) once for each cell.  Within a region the
+ * cells are visited in increasing order, so batches from a single region --
+ * the common case -- are traversed contiguously without any reordering.
+ */
+template <class Fn>
+void forEachCellByRegion(const std::size_t numCells,
+                         const unsigned* regionIdx,
+                         Fn&& fn)
+{
+    if (numCells == 0)
+        return;
+
+    const bool singleRegion = (regionIdx == nullptr) ||
+        std::all_of(regionIdx + 1, regionIdx + numCells,
+                    [first = regionIdx[0]](const unsigned r) { return r == first; });
+
+    if (singleRegion) {
+        const unsigned r = (regionIdx == nullptr) ? 0 : regionIdx[0];
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx)
+            fn(r, cellIdx);
+
+        return;
+    }
+
+    // Stable counting sort of the cells by region.
+    const unsigned numRegions = *std::max_element(regionIdx, regionIdx + numCells) + 1;
+    std::vector<std::size_t> regionStart(numRegions + 1, 0);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx)
+        ++regionStart[regionIdx[cellIdx] + 1];
+
+    for (unsigned r = 0; r < numRegions; ++r)
+        regionStart[r + 1] += regionStart[r];
+
+    std::vector<std::size_t> order(numCells);
+    {
+        auto pos = regionStart;
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx)
+            order[pos[regionIdx[cellIdx]]++] = cellIdx;
+    }
+
+    for (unsigned r = 0; r < numRegions; ++r) {
+        for (std::size_t i = regionStart[r]; i < regionStart[r + 1]; ++i)
+            fn(r, order[i]);
+    }
+}
+
+} // namespace Opm
+
+#endif
@@ -32,6 +32,7 @@
 #include "WaterPvtThermal.hpp"
 #include "BrineCo2Pvt.hpp"
 #include "BrineH2Pvt.hpp"
+#include "PvtBatch.hpp"
 
 #define OPM_WATER_PVT_MULTIPLEXER_CALL(codeToCall)                      \
     switch (approach_) {                                                \
@@ -253,6 +254,32 @@ public:
                                   const Evaluation& saltconcentration) const
     { OPM_WATER_PVT_MULTIPLEXER_CALL(return pvtImpl.saturationPressure(regionIdx, temperature, Rs, saltconcentration)); return 0; }
 
+    /*!
+     * \brief Evaluate the PVT properties of water for a batch of cells.
+     *
+     * The PVT approach is dispatched once for the whole batch and the cells are
+     * evaluated grouped by PVT region.  The mixing ratio of the input is the
+     * gas dissolution factor \f$R_{sw}\f$ and the secondary input is the salt
+     * concentration.
+     */
+    template <class Evaluation>
+    void evaluateBatch(const PvtBatchInput<Evaluation>& input,
+                       const PvtBatchOutput<Evaluation>& output) const
+    { OPM_WATER_PVT_MULTIPLEXER_CALL(evaluateBatch_(pvtImpl, input, output)); }
+
+    /*!
+     * \brief Call a function with the PVT implementation selected for the deck.
+     *
+     * The PVT approach is dispatched once and fn is called with a reference to
+     * the object which implements the water PVT, so that the calls made by fn are
+     * resolved at compile time and can be inlined into the caller's loop over the
+     * cells.  fn must accept all PVT implementations, i.e., it usually is a
+     * generic lambda.
+     */
+    template <class Function>
+    void visit(Function&& fn) const
+    { OPM_WATER_PVT_MULTIPLEXER_CALL(fn(pvtImpl)); }
+
 
     /*!
      * \copydoc BaseFluidSystem::diffusionCoefficient
@@ -406,6 +433,34 @@ public:
 private:
     WaterPvtApproach approach_;
     void* realWaterPvt_;
+
+    template <class PvtImpl, class Evaluation>
+    void evaluateBatch_(const PvtImpl& pvtImpl,
+                        const PvtBatchInput<Evaluation>& input,
+                        const PvtBatchOutput<Evaluation>& output) const
+    {
+        const Evaluation zero = 0.0;
+
+        forEachCellByRegion(input.size, input.regionIdx,
+                            [&pvtImpl, &input, &output, &zero](const unsigned regionIdx,
+                                                               const std::size_t cellIdx)
+        {
+            const auto& T = input.temperature[cellIdx];
+            const auto& p = input.pressure[cellIdx];
+            const auto& Rsw = (input.mixingRatio != nullptr) ? input.mixingRatio[cellIdx] : zero;
+            const auto& salt = (input.secondary != nullptr) ? input.secondary[cellIdx] : zero;
+
+            if (output.inverseFormationVolumeFactor != nullptr)
+                output.inverseFormationVolumeFactor[cellIdx] = pvtImpl.inverseFormationVolumeFactor(regionIdx, T, p, Rsw, salt);
+
+            if (output.viscosity != nullptr)
+                output.viscosity[cellIdx] = pvtImpl.viscosity(regionIdx, T, p, Rsw, salt);
+
+            if (output.saturatedMixingRatio != nullptr)
+                output.saturatedMixingRatio[cellIdx] = pvtImpl.saturatedGasDissolutionFactor(regionIdx, T, p, salt);
+        });
+    }
+
 };
 
 } // namespace Opm
@@ -169,15 +169,44 @@ public:
      */
     template <class Evaluation>
     Evaluation viscosity(unsigned regionIdx,
-                         const Evaluation& /*temperature*/,
+                         const Evaluation& temperature,
                          const Evaluation& pressure,
                          const Evaluation& Rv,
-                         const Evaluation& /*Rvw*/) const
+                         const Evaluation& Rvw) const
     {
-        const Evaluation& invBg = inverseGasB_[regionIdx].eval(pressure, Rv, /*extrapolate=*/true);
-        const Evaluation& invMugBg = inverseGasBMu_[regionIdx].eval(pressure, Rv, /*extrapolate=*/true);
+        Evaluation invBg;
+        Evaluation mug;
+        inverseFormationVolumeFactorAndViscosity(regionIdx, temperature, pressure, Rv, Rvw, invBg, mug);
+        return mug;
+    }
 
-        return invBg/invMugBg;
+    /*!
+     * \brief Returns the inverse formation volume factor [-] and the dynamic
+     *        viscosity [Pa s] of the fluid phase.
+     *
+     * Equivalent to inverseFormationVolumeFactor() and viscosity(), but shares
+     * the table lookup between the two.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactorAndViscosity(unsigned regionIdx,
+                                                  const Evaluation& /*temperature*/,
+                                                  const Evaluation& pressure,
+                                                  const Evaluation& Rv,
+                                                  const Evaluation& /*Rvw*/,
+                                                  Evaluation& invB,
+                                                  Evaluation& mu) const
+    {
+        if (regionIdx < sharedInvBSampling_.size() && sharedInvBSampling_[regionIdx]) {
+            const auto [invBg, invMugBg] = inverseGasB_[regionIdx]
+                .evalWith(inverseGasBMu_[regionIdx], pressure, Rv, /*extrapolate=*/true);
+
+            invB = invBg;
+            mu = invBg/invMugBg;
+            return;
+        }
+
+        invB = inverseGasB_[regionIdx].eval(pressure, Rv, /*extrapolate=*/true);
+        mu = invB/inverseGasBMu_[regionIdx].eval(pressure, Rv, /*extrapolate=*/true);
     }
 
     /*!
@@ -382,6 +411,14 @@ public:
         return vapPar1_;
     }
 
+    /*!
+     * \brief Returns true if the tables of 1/B and 1/(B*mu) of a region have the same
+     *        sampling points, so that both are evaluated with a single table lookup.
+     */
+    bool sharedInvBSampling(unsigned regionIdx) const {
+        return regionIdx < sharedInvBSampling_.size() && sharedInvBSampling_[regionIdx];
+    }
+
 private:
     void updateSaturationPressure_(unsigned regionIdx);
 
@@ -395,6 +432,11 @@ private:
     std::vector<TabulatedOneDFunction> saturatedOilVaporizationFactorTable_;
     std::vector<TabulatedOneDFunction> saturationPressure_;
 
+    // whether 1/B and 1/(B*mu) share sampling points in a region, allowing
+    // inverseFormationVolumeFactorAndViscosity() to evaluate both with a single
+    // table lookup.
+    std::vector<bool> sharedInvBSampling_;
+
     Scalar vapPar1_ = 0.0;
 };
 
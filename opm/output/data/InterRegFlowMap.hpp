@@ -85,9 +85,51 @@ namespace Opm { namespace data {
         /// If both region IDs are the same then this function does nothing.
         void addConnection(const int r1, const int r2, const FlowRates& rates);
 
+        /// Prepare for concurrent calls to addConnection() from multiple
+        /// threads.
+        ///
+        /// Each thread accumulates its contributions in a separate,
+        /// partial buffer.  The partial buffers are merged, in order of
+        /// increasing thread index, in compress().  Must not be called
+        /// while other threads are adding connections.
+        ///
+        /// \param[in] numThreads Number of threads that will contribute
+        ///    connections.  Thread indices passed to addConnection() must
+        ///    be in the range [0, numThreads).
+        void prepareConcurrentAccumulation(const std::size_t numThreads);
+
+        /// Add flow rate connection between regions on behalf of a single
+        /// thread.
+        ///
+        /// May be called concurrently provided each thread uses its own,
+        /// distinct, \p threadID.  The single threaded addConnection()
+        /// overload uses thread index zero.
+        ///
+        /// \param[in] r1 Primary (source) zero-based region index.  Used as
+        ///    row index.
+        ///
+        /// \param[in] r2 Secondary (sink) zero-based region index.  Used as
+        ///   column index.
+        ///
+        /// \param[in] rates Flow rates associated to single connection.
+        ///
+        /// \param[in] threadID Index of calling thread.  Must be less than
+        ///    number of threads passed to prepareConcurrentAccumulation().
+        void addConnection(const int         r1,
+                           const int         r2,
+                           const FlowRates&  rates,
+                           const std::size_t threadID);
+
         /// Form CSR adjacency matrix representation of input graph from
         /// connections established in previous calls to addConnection().
         ///
+        /// If every connection added since the last call to clear() is a
+        /// connection of the structure formed in the previous compress(),
+        /// and every connection of that structure is added at least once,
+        /// then the previous structure is reused and only the flow rates
+        /// are accumulated.  This is typically the case in subsequent
+        /// report steps of a simulation run.
+        ///
         /// \param[in] numRegions Number of rows in resulting CSR matrix.
         ///     If prior calls to addConnection() supply source entity IDs
         ///     (row indices) greater than or equal to \p numRows, then
@@ -135,15 +177,56 @@ namespace Opm { namespace data {
         }
 
         /// Clear all internal buffers, but preserve allocated capacity.
+        ///
+        /// Retains the current compressed structure for reuse in the next
+        /// call to compress().
         void clear();
 
     private:
         // VertexID = int, TrackCompressedIdx = true.
         using Graph = utility::CSRGraphFromCoordinates<int, true>;
 
+        /// Uncompressed contributions from a single thread.  Aligned to
+        /// keep the buffers of different threads on separate cache lines.
+        struct alignas(64) Contributions
+        {
+            /// Low region index (row) of each connection.
+            Neighbours low{};
+
+            /// High region index (column) of each connection.
+            Neighbours high{};
+
+            /// Flow rates of each connection.
+            RateBuffer rates{};
+
+            /// Clear all buffers, but preserve allocated capacity.
+            void clear();
+        };
+
         Graph connections_{};
         RateBuffer rates_{};
 
+        /// Connection structure of previous compress() call.  Candidate
+        /// for reuse in next compress() call.
+        Graph previous_{};
+
+        /// Contributions added since last call to compress(), one element
+        /// per thread.
+        std::vector<Contributions> partials_ = std::vector<Contributions>(1);
+
+        /// Accumulate contributions into connection structure of previous
+        /// compress() call.
+        ///
+        /// \param[in] numRegions Number of rows in resulting CSR matrix.
+        ///
+        /// \return Whether or not previous structure could be reused.
+        ///    Leaves the object unchanged if not.
+        bool reusePreviousStructure(const std::size_t numRegions);
+
+        /// Move contributions from partial buffers into uncompressed
+        /// coordinate representation of connections_.
+        void mergePartials();
+
         template <typename T, class A, class MessageBufferType>
         void writeVector(const std::vector<T,A>& vec,
                          MessageBufferType&      buffer) const
@@ -43,6 +43,10 @@ namespace Opm { namespace RestartIO { namespace Helpers {
     public:
         explicit AggregateConnectionData(const std::vector<int>& inteHead);
 
+        /// Reinitialise all arrays for a new set of dimensions, reusing
+        /// existing storage where possible.
+        void reset(const std::vector<int>& inteHead);
+
         void captureDeclaredConnData(const Opm::Schedule&        sched,
                                      const Opm::EclipseGrid&     grid,
                                      const Opm::UnitSystem&      units,
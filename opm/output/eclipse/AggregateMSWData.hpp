@@ -40,6 +40,10 @@ namespace Opm { namespace RestartIO { namespace Helpers {
     public:
         explicit AggregateMSWData(const std::vector<int>& inteHead);
 
+        /// Reinitialise all arrays for a new set of dimensions, reusing
+        /// existing storage where possible.
+        void reset(const std::vector<int>& inteHead);
+
         void captureDeclaredMSWData(const Opm::Schedule&     sched,
                                     const std::size_t        rptStep,
                                     const Opm::UnitSystem&   units,
@@ -49,6 +49,10 @@ namespace Opm { namespace RestartIO { namespace Helpers {
     public:
         explicit AggregateWellData(const std::vector<int>& inteHead);
 
+        /// Reinitialise all arrays for a new set of dimensions, reusing
+        /// existing storage where possible.
+        void reset(const std::vector<int>& inteHead);
+
         void captureDeclaredWellData(const Schedule&   	       sched,
                                      const TracerConfig&       tracer,
                                      const std::size_t 		     sim_step,
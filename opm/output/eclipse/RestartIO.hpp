@@ -25,7 +25,11 @@
 #define RESTART_IO_HPP
 
 #include <opm/output/eclipse/AggregateAquiferData.hpp>
+#include <opm/output/eclipse/AggregateConnectionData.hpp>
+#include <opm/output/eclipse/AggregateMSWData.hpp>
+#include <opm/output/eclipse/AggregateWellData.hpp>
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <vector>
@@ -78,6 +82,16 @@ namespace Opm { namespace Action {
 */
 namespace Opm { namespace RestartIO {
 
+    /// Well, connection and segment arrays which may be kept alive between
+    /// calls to save() in order to reuse their backing store at
+    /// subsequent report steps.
+    struct AggregateBuffers
+    {
+        std::optional<Helpers::AggregateWellData>       wellData{};
+        std::optional<Helpers::AggregateConnectionData> connectionData{};
+        std::optional<Helpers::AggregateMSWData>        mswData{};
+    };
+
     void save(EclIO::OutputStream::Restart&                 rstFile,
               int                                           report_step,
               double                                        seconds_elapsed,
@@ -90,7 +104,8 @@ namespace Opm { namespace RestartIO {
               const SummaryState&                           sumState,
               const UDQState&                               udqState,
               std::optional<Helpers::AggregateAquiferData>& aquiferData,
-              bool                                          write_double = false);
+              bool                                          write_double = false,
+              AggregateBuffers*                             buffers = nullptr);
 
 
     RestartValue load(const std::string&             filename,
@@ -103,6 +118,25 @@ namespace Opm { namespace RestartIO {
                       const Schedule&                schedule,
                       const std::vector<RestartKey>& extra_keys = {});
 
+    /// Load restart data for a subset of the active cells, e.g., the local
+    /// partition of a distributed run.
+    ///
+    /// Like load(), but the solution vectors hold only the values of the
+    /// cells in \p active_cells, in that order.  For binary restart files
+    /// only the parts of the solution arrays holding these cells are read.
+    ///
+    /// \param[in] active_cells Active cell indices.  Must be sorted.
+    RestartValue loadPartition(const std::string&              filename,
+                               int                             report_step,
+                               Action::State&                  action_state,
+                               SummaryState&                   summary_state,
+                               const std::vector<RestartKey>&  solution_keys,
+                               const EclipseState&             es,
+                               const EclipseGrid&              grid,
+                               const Schedule&                 schedule,
+                               const std::vector<std::size_t>& active_cells,
+                               const std::vector<RestartKey>&  extra_keys = {});
+
 }} // namespace Opm::RestartIO
 
 #endif  // RESTART_IO_HPP
@@ -126,6 +126,23 @@ namespace Opm { namespace RestartIO { namespace Helpers {
             return { b, e };
         }
 
+        /// Change number and size of windows and reset all data items
+        /// to their default value.
+        ///
+        /// Reuses the existing backing store if it is large enough,
+        /// e.g., when the array is reinitialised at a new report step.
+        ///
+        /// \param[in] n Number of windows.
+        /// \param[in] sz Number of data items per window.
+        void reset(const NumWindows n, const WindowSize sz)
+        {
+            if (sz.value == 0)
+                throw std::invalid_argument("Window array with windowsize==0 is not permitted");
+
+            this->x_.assign(n.value * sz.value, T{});
+            this->windowSize_ = sz.value;
+        }
+
         /// Get read-only access to full, linearised data items for
         /// all windows.
         const std::vector<T>& data() const
@@ -240,6 +257,24 @@ namespace Opm { namespace RestartIO { namespace Helpers {
             return this->data_[ this->i(row, col) ];
         }
 
+        /// Change matrix dimensions and reset all data items to their
+        /// default value.  Reuses the existing backing store if it is
+        /// large enough.
+        ///
+        /// \param[in] nRows Number of rows.
+        /// \param[in] nCols Number of columns.
+        /// \param[in] sz Number of data items per (row,column) window.
+        void reset(const NumRows& nRows,
+                   const NumCols& nCols,
+                   const WindowSize& sz)
+        {
+            if (nCols.value == 0)
+                throw std::invalid_argument("Window matrix with columns==0 is not permitted");
+
+            this->data_.reset(NumWindows{ nRows.value * nCols.value }, sz);
+            this->numCols_ = nCols.value;
+        }
+
         /// Get read-only access to full, linearised data items for
         /// all windows.
         auto data() const
@@ -20,6 +20,8 @@
 #include <opm/common/OpmLog/LogBackend.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
 
+#include <utility>
+
 namespace Opm {
 
     LogBackend::LogBackend( int64_t mask ) :
@@ -53,12 +55,43 @@ namespace Opm {
         }
     }
 
+    std::vector<std::string> LogBackend::filterTaggedMessage(int64_t messageFlag,
+                                                             const std::string& messageTag,
+                                                             const std::string& message)
+    {
+        std::vector<std::string> messages;
+        std::string notice;
+        const bool included = applyLimits(messageFlag, messageTag, notice);
+        if (!notice.empty()) {
+            messages.push_back(std::move(notice));
+        }
+        if (included) {
+            messages.push_back(message);
+        }
+        return messages;
+    }
+
+    void LogBackend::addFilteredMessage(int64_t messageFlag, const std::string& message)
+    {
+        addMessageUnconditionally(messageFlag, message);
+    }
+
     int64_t LogBackend::getMask() const
     {
         return m_mask;
     }
 
     bool LogBackend::includeMessage(int64_t messageFlag, const std::string& messageTag)
+    {
+        std::string notice;
+        const bool included = applyLimits(messageFlag, messageTag, notice);
+        if (!notice.empty()) {
+            addMessageUnconditionally(messageFlag, notice);
+        }
+        return included;
+    }
+
+    bool LogBackend::applyLimits(int64_t messageFlag, const std::string& messageTag, std::string& notice)
     {
         // Check mask.
         const bool included = ((messageFlag & m_mask) == messageFlag) && (messageFlag > 0);
@@ -72,14 +105,12 @@ namespace Opm {
             : MessageLimiter::Response::PrintMessage;
         if (res == MessageLimiter::Response::JustOverTagLimit) {
             // Special case: add a message to this backend about limit being reached.
-            std::string msg = "Message limit reached for message tag: " + messageTag;
-            addMessageUnconditionally(messageFlag, msg);
+            notice = "Message limit reached for message tag: " + messageTag;
         }
         if (res == MessageLimiter::Response::JustOverCategoryLimit) {
             // Special case: add a message to this backend about limit being reached.
             std::string prefix = Log::prefixMessage(messageFlag, "");
-            std::string msg = "Message limit reached for message category: " + prefix.substr(0, prefix.size()-2);
-            addMessageUnconditionally(messageFlag, msg);
+            notice = "Message limit reached for message category: " + prefix.substr(0, prefix.size()-2);
         }
 
         return res == MessageLimiter::Response::PrintMessage;
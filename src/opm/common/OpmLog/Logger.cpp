@@ -20,13 +20,164 @@
 #include <config.h>
 #include <opm/common/OpmLog/Logger.hpp>
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <opm/common/OpmLog/LogBackend.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
 
 namespace Opm {
 
+    /*
+      Multi-producer, single-consumer queue of messages which are passed
+      to the backends by a dedicated thread. The queue is an intrusive
+      linked list where the producers atomically exchange the head, so
+      adding a message never blocks. The consumer owns the tail, which is
+      always a dummy node whose successor is the next message.
+
+      The consumer only sleeps after announcing it in m_sleeping and
+      finding the queue still empty, and the producers only notify it if
+      they see the announcement after linking their message. With
+      sequentially consistent atomics at least one of the two sees the
+      other's store, so a wakeup is never lost. Flushing threads are
+      woken the same way through m_flushWaiters and m_processed.
+    */
+    class Logger::AsyncQueue {
+    public:
+        using Messages = std::vector<std::pair<std::shared_ptr<LogBackend>, std::string>>;
+
+        AsyncQueue()
+            : m_head(new Node{})
+        {
+            this->m_tail = this->m_head.load();
+            this->m_thread = std::thread([this]() { this->run(); });
+        }
+
+        ~AsyncQueue()
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->m_mutex);
+                this->m_stop = true;
+            }
+            this->m_wakeup.notify_one();
+            this->m_thread.join();
+
+            delete this->m_tail;
+        }
+
+        void push(int64_t messageType, Messages&& messages)
+        {
+            auto* node = new Node{};
+            node->messageType = messageType;
+            node->messages = std::move(messages);
+
+            this->m_pushed.fetch_add(1);
+            Node* prev = this->m_head.exchange(node);
+            prev->next.store(node);
+
+            if (this->m_sleeping.load()) {
+                std::lock_guard<std::mutex> lock(this->m_mutex);
+                this->m_wakeup.notify_one();
+            }
+        }
+
+        void flush()
+        {
+            // A backend logging from the logging thread must not wait for itself.
+            if (std::this_thread::get_id() == this->m_thread.get_id())
+                return;
+
+            const auto target = this->m_pushed.load();
+            std::unique_lock<std::mutex> lock(this->m_mutex);
+            this->m_flushWaiters.fetch_add(1);
+            this->m_drained.wait(lock, [this, target]()
+            {
+                return this->m_processed.load() >= target;
+            });
+            this->m_flushWaiters.fetch_sub(1);
+
+            if (this->m_failure)
+                std::rethrow_exception(std::exchange(this->m_failure, nullptr));
+        }
+
+    private:
+        struct Node {
+            std::atomic<Node*> next{nullptr};
+            int64_t messageType{0};
+            Messages messages;
+        };
+
+        void run()
+        {
+            while (true) {
+                Node* next = this->m_tail->next.load();
+                if (next != nullptr) {
+                    this->process(*next);
+                    delete this->m_tail;
+                    this->m_tail = next;
+                    this->m_processed.fetch_add(1);
+
+                    if (this->m_flushWaiters.load() > 0) {
+                        std::lock_guard<std::mutex> lock(this->m_mutex);
+                        this->m_drained.notify_all();
+                    }
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(this->m_mutex);
+                if (this->m_stop && (this->m_tail->next.load() == nullptr))
+                    break;
+
+                this->m_sleeping.store(true);
+                this->m_wakeup.wait(lock, [this]()
+                {
+                    return this->m_stop || (this->m_tail->next.load() != nullptr);
+                });
+                this->m_sleeping.store(false);
+            }
+        }
+
+        void process(Node& node)
+        {
+            try {
+                for (const auto& [backend, message] : node.messages)
+                    backend->addFilteredMessage(node.messageType, message);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(this->m_mutex);
+                if (!this->m_failure)
+                    this->m_failure = std::current_exception();
+            }
+
+            // The node stays alive as the new dummy tail, release the messages now.
+            Messages{}.swap(node.messages);
+        }
+
+        std::atomic<Node*> m_head;
+        Node* m_tail{nullptr};
+
+        std::atomic<std::uint64_t> m_pushed{0};
+        std::atomic<std::uint64_t> m_processed{0};
+        std::atomic<bool> m_sleeping{false};
+        std::atomic<int> m_flushWaiters{0};
+
+        std::mutex m_mutex;
+        std::condition_variable m_wakeup;
+        std::condition_variable m_drained;
+        bool m_stop{false};
+        std::exception_ptr m_failure;
+
+        std::thread m_thread;
+    };
+
     Logger::Logger()
         : m_globalMask(0),
           m_enabledTypes(0)
@@ -40,16 +191,63 @@ namespace Opm {
         addMessageType( Log::MessageType::Note , "note");
     }
 
+    Logger::~Logger() = default;
+
     void Logger::addTaggedMessage(int64_t messageType, const std::string& tag, const std::string& message) const {
         if ((m_enabledTypes & messageType) == 0)
             throw std::invalid_argument("Tried to issue message with unrecognized message ID");
 
-        if (m_globalMask & messageType) {
-            for (auto iter : m_backends) {
-                LogBackend& backend = *(iter.second);
-                backend.addTaggedMessage( messageType, tag, message );
+        if ((m_globalMask & messageType) == 0)
+            return;
+
+        if (m_async) {
+            // The masks and message limits are applied here, so messages
+            // which are not written are neither copied nor queued.
+            AsyncQueue::Messages messages;
+            {
+                std::lock_guard<std::mutex> lock(m_backendMutex);
+                for (const auto& iter : m_backends) {
+                    for (auto& filtered : iter.second->filterTaggedMessage( messageType, tag, message ))
+                        messages.emplace_back( iter.second, std::move(filtered) );
+                }
             }
+
+            if (!messages.empty())
+                m_async->push( messageType, std::move(messages) );
+
+            if (messageType & (Log::MessageType::Error | Log::MessageType::Bug))
+                m_async->flush();
         }
+        else
+            dispatch( messageType, tag, message );
+    }
+
+    void Logger::dispatch(int64_t messageType, const std::string& tag, const std::string& message) const {
+        for (const auto& iter : m_backends) {
+            LogBackend& backend = *(iter.second);
+            backend.addTaggedMessage( messageType, tag, message );
+        }
+    }
+
+    void Logger::setAsynchronous(bool async) {
+        if (async == isAsynchronous())
+            return;
+
+        if (async)
+            m_async = std::make_unique<AsyncQueue>();
+        else {
+            m_async->flush();
+            m_async.reset();
+        }
+    }
+
+    bool Logger::isAsynchronous() const {
+        return m_async != nullptr;
+    }
+
+    void Logger::flush() const {
+        if (m_async)
+            m_async->flush();
     }
 
     void Logger::addMessage(int64_t messageType , const std::string& message) const {
@@ -70,11 +268,15 @@ namespace Opm {
     }
 
     void Logger::removeAllBackends() {
+        flush();
+        std::lock_guard<std::mutex> lock(m_backendMutex);
         m_backends.clear();
         m_globalMask = 0;
     }
 
     bool Logger::removeBackend(const std::string& name) {
+        flush();
+        std::lock_guard<std::mutex> lock(m_backendMutex);
         size_t eraseCount = m_backends.erase( name );
         if (eraseCount == 1)
             return true;
@@ -84,6 +286,7 @@ namespace Opm {
 
 
     void Logger::addBackend(const std::string& name , std::shared_ptr<LogBackend> backend) {
+        std::lock_guard<std::mutex> lock(m_backendMutex);
         updateGlobalMask( backend->getMask() );
         m_backends[ name ] = backend;
     }
@@ -204,6 +204,26 @@ namespace Opm {
     }
 
 
+    void OpmLog::setAsynchronous(bool async) {
+        auto logger = OpmLog::getLogger();
+        logger->setAsynchronous( async );
+    }
+
+
+    bool OpmLog::isAsynchronous() {
+        if (m_logger)
+            return m_logger->isAsynchronous();
+        else
+            return false;
+    }
+
+
+    void OpmLog::flush() {
+        if (m_logger)
+            m_logger->flush();
+    }
+
+
 
     void OpmLog::setupSimpleDefaultLogging(const bool use_prefix,
                                            const bool use_color_coding,
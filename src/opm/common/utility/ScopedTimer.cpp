@@ -0,0 +1,323 @@
+/*
+  Copyright 2024 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/common/utility/ScopedTimer.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+constexpr auto numCounters = static_cast<std::size_t>(Opm::Timing::Counter::NumCounters);
+using Counters = std::array<std::uint64_t, numCounters>;
+
+const std::array<const char*, numCounters> counterNames = {
+    "bytes_read",
+    "bytes_written",
+    "allocations",
+};
+
+struct Event
+{
+    const char* name;
+    std::int64_t start;         // nanoseconds since the time origin
+    std::int64_t duration;      // negative while the scope is open
+    int parent;                 // index of the enclosing event, or -1
+    Counters counters;
+};
+
+// Events recorded by one thread.  The events are stored in the order the
+// scopes were opened, so the parent of an event always precedes it.  The
+// mutex only serialises the owning thread against report writers and
+// reset(), so it is practically never contended.
+struct ThreadEvents
+{
+    int tid = 0;
+    std::mutex mutex;
+    std::vector<Event> events;
+    unsigned generation = 0;
+};
+
+// Scopes currently open on this thread.  Kept outside of ThreadEvents and
+// free of locks such that addCount() may be called from allocation hooks.
+struct OpenScope
+{
+    int event;
+    unsigned generation;
+    Counters counters;
+};
+
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadEvents>> threads;
+};
+
+Registry& registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+std::atomic<std::int64_t> timeOrigin{0};
+
+std::int64_t now()
+{
+    const auto time = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time).count()
+        - timeOrigin.load(std::memory_order_relaxed);
+}
+
+thread_local std::vector<OpenScope> openScopes;
+thread_local std::shared_ptr<ThreadEvents> localEvents;
+
+ThreadEvents& threadEvents()
+{
+    if (!localEvents) {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        localEvents = std::make_shared<ThreadEvents>();
+        localEvents->tid = static_cast<int>(reg.threads.size());
+        reg.threads.push_back(localEvents);
+    }
+
+    return *localEvents;
+}
+
+std::string jsonString(const std::string& text)
+{
+    std::string quoted = "\"";
+    for (const char c : text) {
+        if (c == '"' || c == '\\')
+            quoted += '\\';
+
+        quoted += c;
+    }
+
+    return quoted + '"';
+}
+
+void writeCounters(std::ostream& os, const Counters& counters)
+{
+    for (std::size_t i = 0; i < numCounters; ++i)
+        os << fmt::format(", \"{}\": {}", counterNames[i], counters[i]);
+}
+
+// Scopes aggregated by call path.
+struct PathNode
+{
+    std::string name;
+    std::size_t calls = 0;
+    std::int64_t duration = 0;
+    Counters counters{};
+    std::vector<std::unique_ptr<PathNode>> children;
+
+    PathNode& child(const std::string& childName)
+    {
+        for (auto& node : this->children) {
+            if (node->name == childName)
+                return *node;
+        }
+
+        this->children.push_back(std::make_unique<PathNode>());
+        this->children.back()->name = childName;
+        return *this->children.back();
+    }
+};
+
+void writePath(std::ostream& os, const PathNode& node, const std::string& indent)
+{
+    os << indent << fmt::format("{{\"name\": {}, \"calls\": {}, \"seconds\": {:.6f}",
+                                jsonString(node.name), node.calls, node.duration * 1.0e-9);
+    writeCounters(os, node.counters);
+
+    if (!node.children.empty()) {
+        os << ", \"children\": [\n";
+        for (std::size_t i = 0; i < node.children.size(); ++i) {
+            writePath(os, *node.children[i], indent + "  ");
+            os << ((i + 1 < node.children.size()) ? ",\n" : "\n");
+        }
+        os << indent << ']';
+    }
+
+    os << '}';
+}
+
+} // Anonymous namespace
+
+namespace Opm { namespace Timing {
+
+namespace detail {
+
+std::atomic<bool> isEnabled{false};
+
+void begin(const char* name)
+{
+    auto& thread = threadEvents();
+    const auto start = now();
+
+    int event = 0;
+    unsigned generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(thread.mutex);
+        event = static_cast<int>(thread.events.size());
+        generation = thread.generation;
+
+        // An enclosing scope opened before the last reset() has no event.
+        const int parent = (!openScopes.empty() && (openScopes.back().generation == generation))
+            ? openScopes.back().event : -1;
+        thread.events.push_back({name, start, -1, parent, Counters{}});
+    }
+
+    openScopes.push_back({event, generation, Counters{}});
+}
+
+void end()
+{
+    if (openScopes.empty())
+        return;
+
+    const auto stop = now();
+    const auto scope = openScopes.back();
+    openScopes.pop_back();
+
+    if (!openScopes.empty()) {
+        auto& parent = openScopes.back().counters;
+        for (std::size_t i = 0; i < numCounters; ++i)
+            parent[i] += scope.counters[i];
+    }
+
+    auto& thread = threadEvents();
+    std::lock_guard<std::mutex> lock(thread.mutex);
+    if (scope.generation != thread.generation)
+        return;
+
+    auto& event = thread.events[scope.event];
+    event.duration = stop - event.start;
+    event.counters = scope.counters;
+}
+
+} // namespace detail
+
+void enable(bool on)
+{
+    if (on && !enabled()) {
+        const auto time = std::chrono::steady_clock::now().time_since_epoch();
+        timeOrigin.store(std::chrono::duration_cast<std::chrono::nanoseconds>(time).count(),
+                         std::memory_order_relaxed);
+    }
+
+    detail::isEnabled.store(on, std::memory_order_relaxed);
+}
+
+void reset()
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (auto& thread : reg.threads) {
+        std::lock_guard<std::mutex> threadLock(thread->mutex);
+        thread->events.clear();
+        ++thread->generation;
+    }
+}
+
+void addCount(Counter counter, std::uint64_t count)
+{
+    if (openScopes.empty())
+        return;
+
+    openScopes.back().counters[static_cast<std::size_t>(counter)] += count;
+}
+
+void writeChromeTrace(std::ostream& os)
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    os << "{\"traceEvents\": [";
+    bool first = true;
+    for (const auto& thread : reg.threads) {
+        std::lock_guard<std::mutex> threadLock(thread->mutex);
+        for (const auto& event : thread->events) {
+            if (event.duration < 0)
+                continue;
+
+            os << (first ? "\n" : ",\n")
+               << fmt::format("  {{\"name\": {}, \"ph\": \"X\", \"pid\": 0, \"tid\": {}, "
+                              "\"ts\": {:.3f}, \"dur\": {:.3f}, \"args\": {{",
+                              jsonString(event.name), thread->tid,
+                              event.start * 1.0e-3, event.duration * 1.0e-3);
+            for (std::size_t i = 0; i < numCounters; ++i)
+                os << fmt::format("{}\"{}\": {}", (i == 0) ? "" : ", ",
+                                  counterNames[i], event.counters[i]);
+            os << "}}";
+            first = false;
+        }
+    }
+    os << "\n]}\n";
+}
+
+void writeReport(std::ostream& os)
+{
+    PathNode root;
+    root.name = "total";
+
+    {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        for (const auto& thread : reg.threads) {
+            std::lock_guard<std::mutex> threadLock(thread->mutex);
+
+            std::vector<PathNode*> nodes(thread->events.size(), nullptr);
+            for (std::size_t i = 0; i < thread->events.size(); ++i) {
+                const auto& event = thread->events[i];
+                auto& parent = (event.parent < 0) ? root : *nodes[event.parent];
+                auto& node = parent.child(event.name);
+                nodes[i] = &node;
+
+                if (event.duration < 0)
+                    continue;
+
+                node.calls += 1;
+                node.duration += event.duration;
+                for (std::size_t c = 0; c < numCounters; ++c)
+                    node.counters[c] += event.counters[c];
+
+                if (event.parent < 0) {
+                    root.duration += event.duration;
+                    for (std::size_t c = 0; c < numCounters; ++c)
+                        root.counters[c] += event.counters[c];
+                }
+            }
+        }
+    }
+
+    writePath(os, root, "");
+    os << '\n';
+}
+
+}} // namespace Opm::Timing
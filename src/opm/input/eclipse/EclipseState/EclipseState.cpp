@@ -22,6 +22,7 @@
 #include <opm/common/OpmLog/InfoLogger.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/common/utility/ScopedTimer.hpp>
 
 #include <opm/io/eclipse/rst/aquifer.hpp>
 #include <opm/io/eclipse/rst/network.hpp>
@@ -118,6 +119,10 @@ namespace Opm {
 // subsequently after the processing of numerical aquifers.
 
     EclipseState::EclipseState(const Deck& deck)
+        : EclipseState(Timing::Scope{"EclipseState"}, deck)
+    {}
+
+    EclipseState::EclipseState(Timing::Scope&&, const Deck& deck)
     try
         : m_tables(            deck )
         , m_runspec(           deck )
@@ -39,6 +39,7 @@
 #include <opm/input/eclipse/Deck/DeckRecord.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/NNC.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/common/utility/ScopedTimer.hpp>
 
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
@@ -59,7 +60,9 @@
 #include <cstring>
 #include <functional>
 #include <initializer_list>
+#include <limits>
 #include <numeric>
+#include <stdexcept>
 #include <tuple>
 #include <unordered_map>
 
@@ -90,6 +93,73 @@ void apply_GRIDUNIT(const UnitSystem& deck_units, const UnitSystem& grid_units,
         v *= scale_factor;
 }
 
+// The geometry of a cell from its corners. These are shared by the per-cell
+// getters and EclipseGrid::cacheGeometry() so that cached and computed values
+// are identical.
+
+std::array<double, 3> cell_center(const std::array<double,8>& X,
+                                  const std::array<double,8>& Y,
+                                  const std::array<double,8>& Z)
+{
+    return std::array<double,3> { { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
+                                    std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
+                                    std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 } };
+}
+
+double cell_thickness(const std::array<double,8>& Z)
+{
+    double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+    double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+    return z2 - z1;
+}
+
+double cell_depth(const std::array<double,8>& Z)
+{
+    double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+    double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+    return (z1 + z2)/2.0;
+}
+
+std::array<double, 3> cell_dims(const std::array<double,8>& X,
+                                const std::array<double,8>& Y,
+                                const std::array<double,8>& Z)
+{
+    // calculate dx
+    double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
+    double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
+    double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
+    double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
+    double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
+
+    // calculate dy
+    x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
+    y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
+    x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
+    y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
+    double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
+
+    return std::array<double,3> {{dx, dy, cell_thickness(Z)}};
+}
+
+/*
+  The ZCORN values are ordered with i running fastest, each cell
+  contributing two values in each direction, and each value sits on the
+  pillar given by the cell index plus the corner offset in that
+  direction.
+*/
+template <typename Fn>
+void for_each_zcorn_pillar(const std::array<int, 3>& dims, Fn&& fn) {
+    const std::size_t nx = dims[0];
+    const std::size_t ny = dims[1];
+    const std::size_t nz = dims[2];
+
+    std::size_t index = 0;
+    for (std::size_t k = 0; k < 2*nz; k++)
+        for (std::size_t j = 0; j < 2*ny; j++)
+            for (std::size_t i = 0; i < 2*nx; i++, index++)
+                fn(index, (i + 1)/2 + (j + 1)/2*(nx + 1));
+}
+
 }
 EclipseGrid::EclipseGrid()
     : GridDims(),
@@ -220,6 +290,7 @@ EclipseGrid::EclipseGrid(const EclipseGrid& src, const double* zcorn, const std:
 {
 
     if (zcorn != nullptr) {
+        this->expandStorage();
         size_t sizeZcorn = this->getCartesianSize()*8;
 
         for (size_t n=0; n < sizeZcorn; n++) {
@@ -266,6 +337,10 @@ EclipseGrid::EclipseGrid(const EclipseGrid& src, const std::vector<int>& actnum)
 
 
 EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
+    : EclipseGrid(Timing::Scope{"EclipseGrid"}, deck, actnum)
+{}
+
+EclipseGrid::EclipseGrid(Timing::Scope&&, const Deck& deck, const int * actnum)
     : GridDims(deck),
       m_minpvMode(MinpvMode::Inactive),
       m_pinchoutMode(PinchMode::TOPBOT),
@@ -710,18 +785,38 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
             zind[n+4] = zind[n] + dims[0]*dims[1]*4;
 
 
-        for (int n = 0; n< 8; n++)
-           Z[n] = m_zcorn[zind[n]];
+        // top and bottom point of the four pillars
+        std::array<std::array<double,6>, 4> pillars;
+
+        if (this->m_compact.has_value()) {
+            const auto& compact = this->m_compact.value();
+            for (int n = 0; n < 4; n++) {
+                const auto pillar = pind[n] / 6;
 
+                Z[n] = compact.zcorn_origin[pillar] + compact.zcorn_offset[zind[n]];
+                Z[n + 4] = compact.zcorn_origin[pillar] + compact.zcorn_offset[zind[n + 4]];
+
+                for (int d = 0; d < 3; d++) {
+                    pillars[n][d] = compact.pillar_top[3*pillar + d];
+                    pillars[n][d + 3] = pillars[n][d] + compact.pillar_bottom[3*pillar + d];
+                }
+            }
+        } else {
+            for (int n = 0; n< 8; n++)
+               Z[n] = m_zcorn[zind[n]];
+
+            for (int n = 0; n < 4; n++)
+                std::copy_n(m_coord.begin() + pind[n], 6, pillars[n].begin());
+        }
 
         for (int  n=0; n<4; n++) {
-            double xt = m_coord[pind[n]];
-            double yt = m_coord[pind[n] + 1];
-            double zt = m_coord[pind[n] + 2];
+            double xt = pillars[n][0];
+            double yt = pillars[n][1];
+            double zt = pillars[n][2];
 
-            double xb = m_coord[pind[n] + 3];
-            double yb = m_coord[pind[n] + 4];
-            double zb = m_coord[pind[n]+5];
+            double xb = pillars[n][3];
+            double yb = pillars[n][4];
+            double zb = pillars[n][5];
 
             if (zt == zb) {
                 X[n] = xt;
@@ -1476,23 +1571,30 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
         //double reltol = 1.0e-6;
 
-        if (m_coord.size() != other.m_coord.size())
-            return false;
-
-        if (m_zcorn.size() != other.m_zcorn.size())
-            return false;
-
         if (!(m_mapaxes == other.m_mapaxes))
             return false;
 
         if (m_actnum != other.m_actnum)
             return false;
 
-        if (m_coord != other.m_coord)
-            return false;
+        if (this->m_compact.has_value() || other.m_compact.has_value()) {
+            auto coord = [](const EclipseGrid& grid) {
+                return grid.m_compact.has_value() ? grid.m_compact->coord() : grid.m_coord;
+            };
+            auto zcorn = [](const EclipseGrid& grid) {
+                return grid.m_compact.has_value() ? grid.m_compact->zcorn(grid.getNXYZ()) : grid.m_zcorn;
+            };
 
-        if (m_zcorn != other.m_zcorn)
-            return false;
+            if ((coord(*this) != coord(other)) || (zcorn(*this) != zcorn(other)))
+                return false;
+        }
+        else {
+            if (m_coord != other.m_coord)
+                return false;
+
+            if (m_zcorn != other.m_zcorn)
+                return false;
+        }
 
         bool status = ((m_pinch == other.m_pinch)  && (m_minpvMode == other.getMinpvMode()));
 
@@ -1538,13 +1640,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
                 std::array<double,8> Z;
                 auto global_index = this->m_active_to_global[active_index];
                 this->getCellCorners(global_index, X, Y, Z );
-                if (m_rv && m_thetav) {
-                    const auto[i,j,k] = this->getIJK(global_index);
-                    auto& r = *m_rv;
-                    auto& t = *m_thetav;
-                    volume[active_index] = calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
-                } else
-                    volume[active_index] = calculateCellVol(X, Y, Z);
+                volume[active_index] = this->computeCellVolume(global_index, X, Y, Z);
             }
 
             this->active_volume = std::move(volume);
@@ -1554,10 +1650,28 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
     }
 
 
+    double EclipseGrid::computeCellVolume(size_t globalIndex,
+                                          const std::array<double,8>& X,
+                                          const std::array<double,8>& Y,
+                                          const std::array<double,8>& Z) const {
+        if (m_rv && m_thetav) {
+            const auto[i,j,k] = this->getIJK(globalIndex);
+            auto& r = *m_rv;
+            auto& t = *m_thetav;
+            return calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
+        } else {
+            return calculateCellVol(X, Y, Z);
+        }
+    }
+
     double EclipseGrid::getCellVolume(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        size_t active_index;
+        if (const auto* cache = this->cachedGeometry(globalIndex, active_index))
+            return cache->get(active_index, GeometryCache::Volume);
+
         if (this->cellActive(globalIndex) && this->active_volume.has_value()) {
-            auto active_index = this->activeIndex(globalIndex);
+            active_index = this->activeIndex(globalIndex);
             return this->active_volume.value()[active_index];
         }
 
@@ -1565,14 +1679,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-        if (m_rv && m_thetav) {
-            const auto[i,j,k] = this->getIJK(globalIndex);
-            auto& r = *m_rv;
-            auto& t = *m_thetav;
-           return calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
-        } else {
-            return calculateCellVol(X, Y, Z);
-        }
+        return this->computeCellVolume(globalIndex, X, Y, Z);
     }
 
     double EclipseGrid::getCellVolume(size_t i , size_t j , size_t k) const {
@@ -1592,47 +1699,31 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
     double EclipseGrid::getCellThickness(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        size_t active_index;
+        if (const auto* cache = this->cachedGeometry(globalIndex, active_index))
+            return cache->get(active_index, GeometryCache::DimZ);
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        double dz = z2-z1;
-        return dz;
+        return cell_thickness(Z);
     }
 
 
     std::array<double, 3> EclipseGrid::getCellDims(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        size_t active_index;
+        if (const auto* cache = this->cachedGeometry(globalIndex, active_index))
+            return std::array<double,3> {{cache->get(active_index, GeometryCache::DimX),
+                                          cache->get(active_index, GeometryCache::DimY),
+                                          cache->get(active_index, GeometryCache::DimZ)}};
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        // calculate dx
-        double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
-        double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
-        double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
-        double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
-        double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
-
-        // calculate dy
-        x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
-        y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
-        x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
-        y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
-        double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
-
-        // calculate dz
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        double dz = z2-z1;
-
-
-        return std::array<double,3> {{dx, dy, dz}};
+        return cell_dims(X, Y, Z);
     }
 
     std::array<double, 3> EclipseGrid::getCellDims(size_t i , size_t j , size_t k) const {
@@ -1646,13 +1737,17 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
     std::array<double, 3> EclipseGrid::getCellCenter(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        size_t active_index;
+        if (const auto* cache = this->cachedGeometry(globalIndex, active_index))
+            return std::array<double,3> {{cache->get(active_index, GeometryCache::CenterX),
+                                          cache->get(active_index, GeometryCache::CenterY),
+                                          cache->get(active_index, GeometryCache::CenterZ)}};
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-        return std::array<double,3> { { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
-                                        std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
-                                        std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 } };
+        return cell_center(X, Y, Z);
     }
 
 
@@ -1747,14 +1842,15 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
     }
 
     double EclipseGrid::computeCellGeometricDepth(size_t globalIndex) const {
+        size_t active_index;
+        if (const auto* cache = this->cachedGeometry(globalIndex, active_index))
+            return cache->get(active_index, GeometryCache::Depth);
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        return (z1 + z2)/2.0;
+        return cell_depth(Z);
     }
 
     double EclipseGrid::getCellDepth(size_t i, size_t j, size_t k) const {
@@ -1763,12 +1859,72 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         return this->getCellDepth(globalIndex);
     }
 
+    void EclipseGrid::cacheGeometry(bool single_precision) const {
+        Timing::Scope timer{"EclipseGrid::cacheGeometry"};
+
+        constexpr std::size_t num_fields = GeometryCache::NumFields;
+        const std::size_t num_active = this->m_active_to_global.size();
+
+        GeometryCache cache;
+        std::vector<double> volume(num_active);
+        if (single_precision)
+            cache.single_values.resize(num_active * num_fields);
+        else
+            cache.values.resize(num_active * num_fields);
+
+        #pragma omp parallel for schedule(static)
+        for (std::size_t active_index = 0; active_index < num_active; active_index++) {
+            std::array<double,8> X;
+            std::array<double,8> Y;
+            std::array<double,8> Z;
+            const auto global_index = this->m_active_to_global[active_index];
+            this->getCellCorners(global_index, X, Y, Z );
+
+            const auto center = cell_center(X, Y, Z);
+            const auto dims = cell_dims(X, Y, Z);
+            volume[active_index] = this->computeCellVolume(global_index, X, Y, Z);
+
+            const std::array<double, num_fields> values {{
+                center[0], center[1], center[2],
+                dims[0], dims[1], dims[2],
+                cell_depth(Z), volume[active_index]
+            }};
+
+            if (single_precision)
+                std::copy(values.begin(), values.end(), cache.single_values.begin() + active_index*num_fields);
+            else
+                std::copy(values.begin(), values.end(), cache.values.begin() + active_index*num_fields);
+        }
+
+        this->m_geometry = std::move(cache);
+        this->active_volume = std::move(volume);
+    }
+
+    bool EclipseGrid::hasGeometryCache() const {
+        return this->m_geometry.has_value();
+    }
+
+    void EclipseGrid::clearGeometryCache() const {
+        this->m_geometry = std::nullopt;
+    }
+
+    const EclipseGrid::GeometryCache*
+    EclipseGrid::cachedGeometry(size_t globalIndex, size_t& active_index) const {
+        if (!this->m_geometry.has_value() || !this->cellActive(globalIndex))
+            return nullptr;
+
+        active_index = this->activeIndex(globalIndex);
+        return &this->m_geometry.value();
+    }
+
     const std::vector<int>& EclipseGrid::getACTNUM( ) const {
 
         return m_actnum;
     }
 
     const std::vector<double>& EclipseGrid::getCOORD() const {
+        if (this->m_compact.has_value())
+            throw std::logic_error("EclipseGrid::getCOORD() called on a grid with compact storage - call expandStorage() first");
 
         return m_coord;
     }
@@ -1777,14 +1933,137 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
         ZcornMapper mapper( getNX(), getNY(), getNZ());
 
+        this->expandStorage();
+        this->active_volume = std::nullopt;
+        this->m_geometry = std::nullopt;
         return mapper.fixupZCORN( m_zcorn );
     }
 
     const std::vector<double>& EclipseGrid::getZCORN( ) const {
+        if (this->m_compact.has_value())
+            throw std::logic_error("EclipseGrid::getZCORN() called on a grid with compact storage - call expandStorage() first");
 
         return m_zcorn;
     }
 
+    bool EclipseGrid::compactStorage(double tolerance) {
+        if (this->m_compact.has_value())
+            return true;
+
+        if (this->m_coord.empty() || this->m_zcorn.empty())
+            return false;
+
+        const auto dims = this->getNXYZ();
+        auto within_tolerance = [tolerance](const std::vector<double>& expanded,
+                                            const std::vector<double>& original)
+        {
+            for (std::size_t i = 0; i < original.size(); ++i) {
+                // Written such that NaN values fail the test
+                if (!(std::abs(expanded[i] - original[i]) <= tolerance))
+                    return false;
+            }
+            return true;
+        };
+
+        auto compact = CompactCornerData::compress(dims, this->m_coord, this->m_zcorn);
+        if (!within_tolerance(compact.coord(), this->m_coord) ||
+            !within_tolerance(compact.zcorn(dims), this->m_zcorn))
+            return false;
+
+        // The input arrays are only kept for output if they differ from the
+        // processed arrays, i.e. if fixupZCORN() has changed anything.
+        std::optional<CompactCornerData> compact_input;
+        if (this->m_input_coord.has_value() &&
+            ((this->m_input_coord.value() != this->m_coord) || (this->m_input_zcorn.value() != this->m_zcorn)))
+        {
+            compact_input = CompactCornerData::compress(dims, this->m_input_coord.value(), this->m_input_zcorn.value());
+            if (!within_tolerance(compact_input->coord(), this->m_input_coord.value()) ||
+                !within_tolerance(compact_input->zcorn(dims), this->m_input_zcorn.value()))
+                return false;
+        }
+
+        this->m_compact = std::move(compact);
+        this->m_compact_input = std::move(compact_input);
+        this->m_input_coord.reset();
+        this->m_input_zcorn.reset();
+        this->m_coord = std::vector<double>{};
+        this->m_zcorn = std::vector<double>{};
+
+        // The cell geometry has changed by the rounding.
+        this->active_volume = std::nullopt;
+        this->m_geometry = std::nullopt;
+
+        return true;
+    }
+
+    bool EclipseGrid::hasCompactStorage() const {
+        return this->m_compact.has_value();
+    }
+
+    void EclipseGrid::expandStorage() {
+        if (!this->m_compact.has_value())
+            return;
+
+        const auto dims = this->getNXYZ();
+        this->m_coord = this->m_compact->coord();
+        this->m_zcorn = this->m_compact->zcorn(dims);
+        if (this->m_compact_input.has_value()) {
+            this->m_input_coord = this->m_compact_input->coord();
+            this->m_input_zcorn = this->m_compact_input->zcorn(dims);
+        }
+
+        this->m_compact.reset();
+        this->m_compact_input.reset();
+    }
+
+    EclipseGrid::CompactCornerData
+    EclipseGrid::CompactCornerData::compress(const std::array<int, 3>& dims,
+                                             const std::vector<double>& coord,
+                                             const std::vector<double>& zcorn) {
+        CompactCornerData compact;
+
+        const std::size_t num_pillars = coord.size() / 6;
+        compact.pillar_top.resize(3*num_pillars);
+        compact.pillar_bottom.resize(3*num_pillars);
+        for (std::size_t pillar = 0; pillar < num_pillars; pillar++) {
+            for (std::size_t d = 0; d < 3; d++) {
+                compact.pillar_top[3*pillar + d] = coord[6*pillar + d];
+                compact.pillar_bottom[3*pillar + d] = static_cast<float>(coord[6*pillar + d + 3] - coord[6*pillar + d]);
+            }
+        }
+
+        compact.zcorn_origin.assign(num_pillars, std::numeric_limits<double>::max());
+        for_each_zcorn_pillar(dims, [&compact, &zcorn](std::size_t index, std::size_t pillar) {
+            compact.zcorn_origin[pillar] = std::min(compact.zcorn_origin[pillar], zcorn[index]);
+        });
+
+        compact.zcorn_offset.resize(zcorn.size());
+        for_each_zcorn_pillar(dims, [&compact, &zcorn](std::size_t index, std::size_t pillar) {
+            compact.zcorn_offset[index] = static_cast<float>(zcorn[index] - compact.zcorn_origin[pillar]);
+        });
+
+        return compact;
+    }
+
+    std::vector<double> EclipseGrid::CompactCornerData::coord() const {
+        std::vector<double> coord(2*this->pillar_top.size());
+        for (std::size_t pillar = 0; pillar < this->pillar_top.size() / 3; pillar++) {
+            for (std::size_t d = 0; d < 3; d++) {
+                coord[6*pillar + d] = this->pillar_top[3*pillar + d];
+                coord[6*pillar + d + 3] = this->pillar_top[3*pillar + d] + this->pillar_bottom[3*pillar + d];
+            }
+        }
+        return coord;
+    }
+
+    std::vector<double> EclipseGrid::CompactCornerData::zcorn(const std::array<int, 3>& dims) const {
+        std::vector<double> zcorn(this->zcorn_offset.size());
+        for_each_zcorn_pillar(dims, [this, &zcorn](std::size_t index, std::size_t pillar) {
+            zcorn[index] = this->zcorn_origin[pillar] + this->zcorn_offset[index];
+        });
+        return zcorn;
+    }
+
     void EclipseGrid::save(const std::string& filename, bool formatted, const std::vector<Opm::NNCdata>& nnc, const Opm::UnitSystem& units) const {
 
         Opm::UnitSystem::UnitType unitSystemType = units.getType();
@@ -1794,30 +2073,44 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
         // Preparing vectors to be saved
 
+        // In compact storage mode the arrays are reconstructed for output.
+        std::vector<double> expanded_coord;
+        std::vector<double> expanded_zcorn;
+        const auto* compact = m_compact_input.has_value() ? &m_compact_input.value()
+                            : (m_compact.has_value() ? &m_compact.value() : nullptr);
+        if (compact != nullptr) {
+            expanded_coord = compact->coord();
+            expanded_zcorn = compact->zcorn(dims);
+        }
+
+        const auto& coord = (compact != nullptr) ? expanded_coord : m_coord;
+        const auto& zcorn = (compact != nullptr) ? expanded_zcorn : m_zcorn;
+
         // create coord vector of floats with input units, converted from SI
         std::vector<float> coord_f;
-        coord_f.resize(m_coord.size());
+        coord_f.resize(coord.size());
 
         auto convert_length = [&units](const double x) { return static_cast<float>(units.from_si(length, x)); };
 
         if (m_input_coord.has_value()) {
             std::transform(m_input_coord.value().begin(), m_input_coord.value().end(), coord_f.begin(), convert_length);
         } else {
-            std::transform(m_coord.begin(), m_coord.end(), coord_f.begin(), convert_length);
+            std::transform(coord.begin(), coord.end(), coord_f.begin(), convert_length);
         }
 
         // create zcorn vector of floats with input units, converted from SI
         std::vector<float> zcorn_f;
-        zcorn_f.resize(m_zcorn.size());
+        zcorn_f.resize(zcorn.size());
 
         if (m_input_coord.has_value()) {
             std::transform(m_input_zcorn.value().begin(), m_input_zcorn.value().end(), zcorn_f.begin(), convert_length);
         } else {
-            std::transform(m_zcorn.begin(), m_zcorn.end(), zcorn_f.begin(), convert_length);
+            std::transform(zcorn.begin(), zcorn.end(), zcorn_f.begin(), convert_length);
         }
 
         m_input_coord.reset();
         m_input_zcorn.reset();
+        m_compact_input.reset();
 
         std::vector<int> filehead(100,0);
         filehead[0] = 3;                     // version number
@@ -1905,6 +2198,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         std::iota(this->m_global_to_active.begin(), this->m_global_to_active.end(), 0);
         this->m_active_to_global = this->m_global_to_active;
         this->active_volume = std::nullopt;
+        this->m_geometry = std::nullopt;
     }
 
     void EclipseGrid::resetACTNUM(const int* actnum) {
@@ -1933,6 +2227,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
                 }
             }
             this->active_volume = std::nullopt;
+            this->m_geometry = std::nullopt;
         }
     }
 
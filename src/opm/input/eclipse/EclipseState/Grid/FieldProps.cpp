@@ -22,6 +22,7 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/common/utility/ScopedTimer.hpp>
 
 #include <opm/input/eclipse/EclipseState/Aquifer/NumericalAquifer/NumericalAquifers.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/Box.hpp>
@@ -368,10 +369,12 @@ void handle_box_keyword(const DeckKeyword& deckKeyword,  Box& box) {
 
 
 std::vector<double> extract_cell_volume(const EclipseGrid& grid) {
+    Timing::Scope timer{"FieldProps::cell_volume"};
     return grid.activeVolume();
 }
 
 std::vector<double> extract_cell_depth(const EclipseGrid& grid) {
+    Timing::Scope timer{"FieldProps::cell_depth"};
     std::vector<double> cell_depth(grid.getNumActive());
     for (std::size_t active_index = 0; active_index < grid.getNumActive(); active_index++)
         cell_depth[active_index] = grid.getCellDepth( grid.getGlobalIndex(active_index));
@@ -478,6 +481,10 @@ bool FieldProps::rst_cmp(const FieldProps& full_arg, const FieldProps& rst_arg)
 
 
 FieldProps::FieldProps(const Deck& deck, const Phases& phases, const EclipseGrid& grid, const TableManager& tables_arg) :
+    FieldProps(Timing::Scope{"FieldProps"}, deck, phases, grid, tables_arg)
+{}
+
+FieldProps::FieldProps(Timing::Scope&&, const Deck& deck, const Phases& phases, const EclipseGrid& grid, const TableManager& tables_arg) :
     active_size(grid.getNumActive()),
     global_size(grid.getCartesianSize()),
     unit_system(deck.getActiveUnitSystem()),
@@ -34,6 +34,7 @@
 #include <opm/common/OpmLog/StreamLog.hpp>
 
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/common/utility/ScopedTimer.hpp>
 
 #include <opm/input/eclipse/Parser/ParserKeywords/A.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/D.hpp>
@@ -132,6 +133,10 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
 
 
     TableManager::TableManager( const Deck& deck )
+        : TableManager(Timing::Scope{"TableManager"}, deck)
+    {}
+
+    TableManager::TableManager( Timing::Scope&&, const Deck& deck )
         :
         m_tabdims( Tabdims(deck)),
         m_aqudims( Aqudims(deck)),
@@ -36,6 +36,10 @@ namespace Opm {
 
 
     void ErrorGuard::dump() const {
+        this->dump(std::cerr);
+    }
+
+    void ErrorGuard::dump(std::ostream& os) const {
         std::size_t width = 0;
         for (const auto& pair : this->warning_list)
             width = std::max(width, pair.first.size());
@@ -44,17 +48,17 @@ namespace Opm {
             width = std::max(width, pair.first.size());
 
         if (!this->warning_list.empty()) {
-            std::cerr << "Warnings:" << std::endl;
+            os << "Warnings:" << std::endl;
             for (const auto& pair : this->warning_list)
-                std::cerr << "  " << std::setw(width) << pair.first << ": " << pair.second << std::endl;
-            std::cerr << std::endl;
+                os << "  " << std::setw(width) << pair.first << ": " << pair.second << std::endl;
+            os << std::endl;
         }
 
         if (!this->error_list.empty()) {
-            std::cerr << std::endl << std::endl << "Errors:" << std::endl;
+            os << std::endl << std::endl << "Errors:" << std::endl;
             for (const auto& pair : this->error_list)
-                std::cerr << std::left << "  " << std::setw(width) << pair.first << ": " << pair.second << std::endl;
-            std::cerr << std::endl;
+                os << std::left << "  " << std::setw(width) << pair.first << ": " << pair.second << std::endl;
+            os << std::endl;
         }
     }
 
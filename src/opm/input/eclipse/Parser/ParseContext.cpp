@@ -150,6 +150,14 @@ namespace Opm {
         this->ignore_keywords.insert(keyword);
     }
 
+    void ParseContext::setLazyScheduleLoading(const bool lazy) {
+        this->lazy_schedule_loading = lazy;
+    }
+
+    bool ParseContext::lazyScheduleLoading() const {
+        return this->lazy_schedule_loading;
+    }
+
 
     void ParseContext::handleError(
             const std::string& errorKey,
@@ -22,6 +22,7 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/common/utility/ScopedTimer.hpp>
 
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
@@ -605,6 +606,7 @@ void ParserState::loadString(const std::string& input) {
 }
 
 void ParserState::loadFile(const std::filesystem::path& inputFile) {
+    Timing::Scope timer{"ParserState::loadFile"};
 
     const auto closer = []( std::FILE* f ) { std::fclose( f ); };
     std::unique_ptr< std::FILE, decltype( closer ) > ufp(
@@ -636,6 +638,8 @@ void ParserState::loadFile(const std::filesystem::path& inputFile) {
         throw std::runtime_error( "Error when reading input file '"
                                   + inputFile.string() + "'" );
 
+    Timing::addCount(Timing::Counter::BytesRead, readc);
+
     this->input_stack.push( str::clean( this->code_keywords, buffer ), inputFile );
 }
 
@@ -1310,6 +1314,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
 
     Deck Parser::parseFile(const std::string &dataFileName, const ParseContext& parseContext,
                            ErrorGuard& errors, const std::vector<Opm::Ecl::SectionType>& sections) const {
+        Timing::Scope timer{"Parser::parseFile"};
 
         std::set<Opm::Ecl::SectionType> ignore_sections;
 
@@ -1369,6 +1374,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
 
 
     Deck Parser::parseString(const std::string &data, const ParseContext& parseContext, ErrorGuard& errors) const {
+        Timing::Scope timer{"Parser::parseString"};
         ParserState parserState( this->codeKeywords(), parseContext, errors );
         parserState.loadString( data );
         parseState( parserState, *this );
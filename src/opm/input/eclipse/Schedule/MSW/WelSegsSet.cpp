@@ -32,6 +32,11 @@ void WelSegsSet::insert(const std::string& well_name,
     entries_.emplace(well_name, location);
 }
 
+std::vector<WelSegsSet::Entry> WelSegsSet::entries() const
+{
+    return { entries_.begin(), entries_.end() };
+}
+
 std::vector<WelSegsSet::Entry>
 WelSegsSet::difference(const std::set<std::string>& compsegs,
                        const std::vector<Well>& wells) const
@@ -38,6 +38,8 @@ public:
     void insert(const std::string& well_name,
                 const KeywordLocation& location);
 
+    std::vector<Entry> entries() const;
+
     std::vector<Entry> difference(const std::set<std::string>& compsegs,
                                   const std::vector<Well>& wells) const;
 
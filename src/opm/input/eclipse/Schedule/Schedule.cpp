@@ -23,7 +23,9 @@
 
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/ActiveGridCells.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/common/utility/ScopedTimer.hpp>
 #include <opm/common/utility/String.hpp>
 #include <opm/common/utility/numeric/cmp.hpp>
 #include <opm/common/utility/shmatch.hpp>
@@ -94,13 +96,18 @@
 #include "Well/injection.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <ctime>
 #include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <mutex>
 #include <optional>
+#include <set>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -114,11 +121,628 @@ namespace {
         return Opm::shmatch(pattern, name);
     }
 
+    // COMPDAT with defaulted I/J connects the well at its head I/J.
+    bool compdat_defaulted_ij(const Opm::DeckRecord& record) {
+        const auto& itemI = record.getItem("I");
+        const auto& itemJ = record.getItem("J");
+        bool defaulted_I = itemI.defaultApplied(0) || itemI.get<int>(0) == 0;
+        bool defaulted_J = itemJ.defaultApplied(0) || itemJ.get<int>(0) == 0;
+
+        return defaulted_I || defaulted_J;
+    }
+
 }
 
 namespace Opm {
 
+    /*
+      The LazyLoader holds the state needed to continue the iteration of the
+      SCHEDULE section past the report steps which have already been
+      materialized, and it owns the lazily loaded part of the Schedule it
+      is attached to: the snapshots past the loaded ones and the cells added
+      to completed_cells. Loading is serialized with a mutex, which is why
+      the const query functions of the Schedule may load report steps.
+      Storage for all the report steps is reserved when the loader is
+      attached, and the already loaded report steps are read through a
+      pointer to that storage instead of through the snapshots vector, so
+      that const queries may run concurrently with a load triggered from
+      another thread. A recursive mutex is used because the keyword handlers
+      invoke public Schedule methods for the report step currently being
+      loaded.
+
+      The cell properties needed by the remaining report steps are fetched
+      from the grid when the loader is created, and the report steps are
+      then loaded from completed_cells. Only if the remaining report steps
+      need the grid itself - for well trajectories, COMPDAT with defaulted
+      I/J or cells outside the grid - the loader keeps its own copy of the
+      grid and the field properties.
+    */
+    class Schedule::LazyLoader {
+    public:
+        LazyLoader(Schedule& schedule,
+                   const EclipseGrid& grid,
+                   const FieldPropsManager& fp,
+                   const ParseContext& parseContext,
+                   const std::size_t load_start)
+            : parse_context_(parseContext)
+            , complete_(schedule.snapshots.size())
+        {
+            ScheduleGrid schedule_grid(grid, fp, schedule.completed_cells);
+
+            auto needs_grid = false;
+            for (auto step = load_start; step < schedule.m_sched_deck.size(); ++step) {
+                for (const auto& keyword : schedule.m_sched_deck[step]) {
+                    if (! prefetchCells(grid, schedule_grid, keyword))
+                        needs_grid = true;
+                }
+            }
+
+            if (needs_grid) {
+                this->grid_ = std::make_shared<const EclipseGrid>(grid);
+                this->fp_ = std::make_shared<const FieldPropsManager>(fp);
+            }
+
+            this->attach(schedule);
+        }
+
+        // Continue loading a deserialized Schedule.
+        LazyLoader(Schedule& schedule, LazyTail&& tail)
+            : parse_context_(std::move(tail.parse_context))
+            , compsegs_wells_(std::move(tail.compsegs_wells))
+            , target_wellpi_(std::move(tail.target_wellpi))
+            , complete_(schedule.snapshots.size())
+        {
+            for (const auto& [well_name, location] : tail.welsegs_wells)
+                this->welsegs_wells_.insert(well_name, location);
+
+            this->attach(schedule);
+        }
+
+        // The copy must be attached to the snapshots of its Schedule.
+        LazyLoader(const LazyLoader& other)
+            : LazyLoader(other, std::lock_guard<std::recursive_mutex>(other.mutex_))
+        {}
+
+        LazyLoader& operator=(const LazyLoader&) = delete;
+
+        bool complete(const std::size_t report_step) const
+        {
+            return report_step < this->complete_.load(std::memory_order_acquire);
+        }
+
+        std::size_t numLoaded() const
+        {
+            return this->complete_.load(std::memory_order_acquire);
+        }
+
+        bool loading() const
+        {
+            std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+            return this->loading_;
+        }
+
+        const ScheduleState& state(const std::size_t report_step) const
+        {
+            return this->states_.load(std::memory_order_acquire)[report_step];
+        }
+
+        std::unique_lock<std::recursive_mutex> lock() const
+        {
+            return std::unique_lock<std::recursive_mutex>(this->mutex_);
+        }
+
+        // Reserve space for all the snapshots up front to keep references
+        // handed out for already loaded report steps valid.
+        void attach(Schedule& schedule)
+        {
+            std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+            this->schedule_ = &schedule;
+            schedule.snapshots.reserve(schedule.m_sched_deck.size());
+            this->states_.store(schedule.snapshots.data(), std::memory_order_release);
+        }
+
+        /*
+          On demand loading is suspended while applyAction() and
+          applyKeywords() modify the Schedule, so that queries from the
+          keyword handlers see the report step being modified as the last
+          one - just like when the complete Schedule is loaded.
+        */
+        class Suspend {
+        public:
+            explicit Suspend(LazyLoader* loader)
+                : loader_(loader)
+            {
+                if (this->loader_ != nullptr)
+                    this->loader_->setLoading(true);
+            }
+
+            ~Suspend()
+            {
+                if (this->loader_ != nullptr)
+                    this->loader_->setLoading(false);
+            }
+
+            Suspend(const Suspend&) = delete;
+            Suspend& operator=(const Suspend&) = delete;
+
+        private:
+            LazyLoader* loader_{nullptr};
+        };
+
+        /*
+          Rerun the already loaded report steps [load_start, load_end) after
+          an ACTIONX has modified the schedule deck. The later report steps
+          will be loaded on demand as continuation of this iteration, using
+          the same target well PI values.
+        */
+        void reload(const std::size_t load_start,
+                    const std::size_t load_end,
+                    const ParseContext& parseContext,
+                    ErrorGuard& errors,
+                    const ScheduleGrid& grid,
+                    const std::unordered_map<std::string, double>& target_wellpi,
+                    const std::string& prefix,
+                    const bool log_to_debug)
+        {
+            std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+            auto& schedule = *this->schedule_;
+            this->welsegs_wells_ = WelSegsSet{};
+            this->compsegs_wells_.clear();
+            this->target_wellpi_ = target_wellpi;
+
+            // The report steps after the modified one are recreated from the
+            // schedule deck, which discards earlier runtime updates of them.
+            this->pi_scalings_.clear();
+            this->last_step_updates_.clear();
+
+            if (load_start < load_end) {
+                schedule.iterateScheduleSection(load_start, load_end,
+                                                parseContext, errors, grid,
+                                                &*this->target_wellpi_,
+                                                prefix, log_to_debug,
+                                                &this->welsegs_wells_,
+                                                &this->compsegs_wells_);
+            }
+
+            this->complete_.store(schedule.snapshots.size(), std::memory_order_release);
+        }
+
+        /*
+          Load the report steps up to and including report_step. Used by the
+          Schedule constructor, where the diagnostics are collected in the
+          caller's ErrorGuard just like when the complete Schedule is
+          loaded.
+        */
+        void load(const std::size_t report_step, ErrorGuard& errors)
+        {
+            std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+            // Either loaded by another thread while we were waiting for the
+            // lock, or a nested call from the keyword handlers of the report
+            // step this thread is currently loading.
+            auto& schedule = *this->schedule_;
+            if (this->loading_ || (report_step < schedule.snapshots.size()))
+                return;
+
+            const auto load_start = schedule.snapshots.size();
+            const auto load_end = std::min(report_step + 1, schedule.m_sched_deck.size());
+
+            const auto grid = this->grid_
+                ? ScheduleGrid(*this->grid_, *this->fp_, schedule.completed_cells)
+                : ScheduleGrid(schedule.completed_cells);
+
+            this->loading_ = true;
+            try {
+                schedule.iterateScheduleSection(load_start, load_end,
+                                                this->parse_context_, errors, grid,
+                                                this->target_wellpi_.has_value() ? &*this->target_wellpi_ : nullptr,
+                                                "", false,
+                                                &this->welsegs_wells_,
+                                                &this->compsegs_wells_);
+            }
+            catch (...) {
+                this->loading_ = false;
+                throw;
+            }
+            this->loading_ = false;
+
+            this->applyDeferredUpdates(load_start);
+            this->complete_.store(schedule.snapshots.size(), std::memory_order_release);
+
+            if (schedule.snapshots.size() == schedule.m_sched_deck.size()) {
+                this->grid_.reset();
+                this->fp_.reset();
+            }
+        }
+
+        /*
+          Load the report steps up to and including report_step on demand.
+          The caller's ErrorGuard is long gone at this point, so the input
+          problems which the ParseContext has deferred are written to the
+          log and reported by throwing, instead of terminating the
+          application when the ErrorGuard goes out of scope.
+        */
+        void load(const std::size_t report_step)
+        {
+            std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+            const auto load_start = this->schedule_->snapshots.size();
+            ErrorGuard errors;
+            try {
+                this->load(report_step, errors);
+            }
+            catch (...) {
+                logDiagnostics(errors);
+                throw;
+            }
+
+            if (errors) {
+                logDiagnostics(errors);
+                throw std::runtime_error {
+                    fmt::format("Unrecoverable errors were encountered while "
+                                "loading report steps {}-{} of the SCHEDULE section",
+                                load_start, this->schedule_->snapshots.size() - 1)
+                };
+            }
+
+            // The warnings have already been logged, or ignored, as
+            // configured in the ParseContext.
+            errors.clear();
+        }
+
+        /*
+          The state needed to load the remaining report steps on the
+          receiving side of serialization, which has no grid. Returns an
+          empty optional if the remaining report steps need the grid itself,
+          or there are pending runtime updates for them.
+        */
+        std::optional<LazyTail> tail() const
+        {
+            std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+            if (this->grid_ ||
+                ! this->connection_filters_.empty() ||
+                ! this->pi_scalings_.empty() ||
+                ! this->last_step_updates_.empty())
+            {
+                return std::nullopt;
+            }
+
+            auto tail = LazyTail{};
+            tail.active = true;
+            tail.parse_context = this->parse_context_;
+            tail.welsegs_wells = this->welsegs_wells_.entries();
+            tail.compsegs_wells = this->compsegs_wells_;
+            tail.target_wellpi = this->target_wellpi_;
+
+            return tail;
+        }
+
+        /*
+          Record a filterConnections() request, to be applied to the report
+          steps which are loaded later.
+        */
+        void addConnectionFilter(const ActiveGridCells& active_cells)
+        {
+            std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+            this->connection_filters_.push_back(active_cells);
+        }
+
+        /*
+          Record an applyWellProdIndexScaling() request. The scaling is
+          applied to the report steps which have already been loaded by the
+          caller, and continued into the report steps loaded later - with
+          the same bookkeeping of scaled connections - just as if all the
+          report steps had been loaded when the scaling was requested.
+        */
+        void addPIScaling(const std::string& well_name,
+                          const double scalingFactor,
+                          std::vector<bool> scalingApplicable)
+        {
+            std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+            this->pi_scalings_.push_back({ well_name, scalingFactor, std::move(scalingApplicable) });
+        }
+
+        /*
+          Record an update of the last report step of the SCHEDULE section,
+          which is applied when that report step is loaded. Returns false if
+          the last report step is already loaded, in which case the caller
+          should update it directly.
+        */
+        bool deferLastStepUpdate(std::function<void(ScheduleState&)> update)
+        {
+            std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+            if (this->schedule_->snapshots.size() == this->schedule_->m_sched_deck.size())
+                return false;
+
+            this->last_step_updates_.push_back(std::move(update));
+            return true;
+        }
+
+    private:
+        struct PIScaling
+        {
+            std::string well_name;
+            double factor;
+            std::vector<bool> applicable;
+        };
+
+        LazyLoader(const LazyLoader& other, const std::lock_guard<std::recursive_mutex>&)
+            : grid_(other.grid_)
+            , fp_(other.fp_)
+            , parse_context_(other.parse_context_)
+            , welsegs_wells_(other.welsegs_wells_)
+            , compsegs_wells_(other.compsegs_wells_)
+            , target_wellpi_(other.target_wellpi_)
+            , connection_filters_(other.connection_filters_)
+            , pi_scalings_(other.pi_scalings_)
+            , last_step_updates_(other.last_step_updates_)
+            , complete_(other.complete_.load())
+        {}
+
+        // Fetch the properties of the cells referenced by the keyword into
+        // the completed cells. Returns false if loading the keyword needs
+        // the grid itself.
+        static bool prefetchCells(const EclipseGrid& ecl_grid,
+                                  const ScheduleGrid& grid,
+                                  const DeckKeyword& keyword)
+        {
+            if (keyword.is<ParserKeywords::COMPTRAJ>() || keyword.is<ParserKeywords::WELTRAJ>())
+                return false;
+
+            if (! keyword.is<ParserKeywords::COMPDAT>() && ! keyword.is<ParserKeywords::COMPSEGS>())
+                return true;
+
+            const auto inside = [&ecl_grid](const DeckRecord& record, const char* k_item)
+            {
+                const auto in_range = [](const DeckItem& item, const std::size_t n)
+                {
+                    const auto index = item.get<int>(0);
+                    return (index >= 1) && (static_cast<std::size_t>(index) <= n);
+                };
+
+                return in_range(record.getItem("I"), ecl_grid.getNX())
+                    && in_range(record.getItem("J"), ecl_grid.getNY())
+                    && in_range(record.getItem(k_item), ecl_grid.getNZ());
+            };
+
+            if (keyword.is<ParserKeywords::COMPDAT>()) {
+                for (const auto& record : keyword) {
+                    if (compdat_defaulted_ij(record) || ! inside(record, "K1") || ! inside(record, "K2"))
+                        return false;
+                }
+            }
+            else {
+                for (std::size_t index = 1; index < keyword.size(); ++index) {
+                    if (! inside(keyword.getRecord(index), "K"))
+                        return false;
+                }
+            }
+
+            Schedule::prefetch_cell_properties(grid, keyword);
+            return true;
+        }
+
+        // Empties the ErrorGuard, which would otherwise terminate the
+        // application when it goes out of scope.
+        static void logDiagnostics(ErrorGuard& errors)
+        {
+            std::ostringstream diagnostics;
+            errors.dump(diagnostics);
+            errors.clear();
+
+            if (! diagnostics.str().empty())
+                OpmLog::error(diagnostics.str());
+        }
+
+        void setLoading(const bool loading)
+        {
+            std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+            this->loading_ = loading;
+        }
+
+        void applyDeferredUpdates(const std::size_t load_start)
+        {
+            auto& snapshots = this->schedule_->snapshots;
+
+            for (const auto& active_cells : this->connection_filters_) {
+                for (auto step = load_start; step < snapshots.size(); ++step) {
+                    for (auto& well : snapshots[step].wells()) {
+                        well.get().filterConnections(active_cells);
+                    }
+                }
+            }
+
+            for (auto& scaling : this->pi_scalings_) {
+                for (auto step = std::max(load_start, std::size_t{1}); step < snapshots.size(); ++step) {
+                    if (! snapshots[step].wells.has(scaling.well_name))
+                        continue;
+
+                    auto& well = snapshots[step].wells.get(scaling.well_name);
+                    const auto& prev_state = snapshots[step - 1];
+                    if (prev_state.wells.has(scaling.well_name)) {
+                        const auto& prev_well = prev_state.wells.get(scaling.well_name);
+                        if ((well == prev_well) || well.hasSameConnectionsPointers(prev_well))
+                            continue;
+                    }
+
+                    well.applyWellProdIndexScaling(scaling.factor, scaling.applicable);
+                }
+            }
+
+            if (! this->last_step_updates_.empty() &&
+                (snapshots.size() == this->schedule_->m_sched_deck.size()))
+            {
+                for (const auto& update : this->last_step_updates_)
+                    update(snapshots.back());
+
+                this->last_step_updates_.clear();
+            }
+        }
+
+        Schedule* schedule_{nullptr};
+        std::shared_ptr<const EclipseGrid> grid_{};
+        std::shared_ptr<const FieldPropsManager> fp_{};
+        ParseContext parse_context_;
+        WelSegsSet welsegs_wells_{};
+        std::set<std::string> compsegs_wells_{};
+        std::optional<std::unordered_map<std::string, double>> target_wellpi_{};
+        std::vector<ActiveGridCells> connection_filters_{};
+        std::vector<PIScaling> pi_scalings_{};
+        std::vector<std::function<void(ScheduleState&)>> last_step_updates_{};
+        std::atomic<ScheduleState*> states_{nullptr};
+        std::atomic<std::size_t> complete_{0};
+        bool loading_{false};
+        mutable std::recursive_mutex mutex_{};
+    };
+
+    Schedule::Schedule() = default;
+    Schedule::~Schedule() = default;
+
+    Schedule::Schedule(const Schedule& other)
+    {
+        *this = other;
+    }
+
+    Schedule::Schedule(Schedule&& other)
+    {
+        *this = std::move(other);
+    }
+
+    Schedule& Schedule::operator=(const Schedule& other)
+    {
+        if (this == &other)
+            return *this;
+
+        // Report steps of other may be loaded concurrently.
+        const auto lock = other.m_lazy
+            ? other.m_lazy->lock()
+            : std::unique_lock<std::recursive_mutex>{};
+
+        this->m_static = other.m_static;
+        this->m_sched_deck = other.m_sched_deck;
+        this->action_wgnames = other.action_wgnames;
+        this->exit_status = other.exit_status;
+        this->snapshots = other.snapshots;
+        this->restart_output = other.restart_output;
+        this->completed_cells = other.completed_cells;
+        this->m_lazy = other.m_lazy ? std::make_unique<LazyLoader>(*other.m_lazy) : nullptr;
+        if (this->m_lazy)
+            this->m_lazy->attach(*this);
+
+        return *this;
+    }
+
+    Schedule& Schedule::operator=(Schedule&& other)
+    {
+        this->m_static = std::move(other.m_static);
+        this->m_sched_deck = std::move(other.m_sched_deck);
+        this->action_wgnames = std::move(other.action_wgnames);
+        this->exit_status = std::move(other.exit_status);
+        this->snapshots = std::move(other.snapshots);
+        this->restart_output = std::move(other.restart_output);
+        this->completed_cells = std::move(other.completed_cells);
+        this->m_lazy = std::move(other.m_lazy);
+        if (this->m_lazy)
+            this->m_lazy->attach(*this);
+
+        return *this;
+    }
+
+    std::size_t Schedule::numLoadedSteps() const
+    {
+        return this->m_lazy ? this->m_lazy->numLoaded() : this->snapshots.size();
+    }
+
+    /*
+      The report steps which are not yet loaded are lazy state owned by the
+      LazyLoader, which loads them into this Schedule under its mutex.
+      Loading does not change the observable state of the Schedule, hence
+      materialize() is const.
+    */
+    void Schedule::materialize(const std::size_t report_step) const
+    {
+        if (! this->m_lazy || this->m_lazy->complete(report_step))
+            return;
+
+        this->m_lazy->load(report_step);
+    }
+
+    void Schedule::materializeAll() const
+    {
+        if (this->m_sched_deck.size() > 0)
+            this->materialize(this->m_sched_deck.size() - 1);
+    }
+
+    Schedule::LazyTail Schedule::lazyTail() const
+    {
+        if (! this->m_lazy)
+            return {};
+
+        auto tail = this->m_lazy->tail();
+        if (tail.has_value())
+            return *std::move(tail);
+
+        this->materializeAll();
+        return {};
+    }
+
+    void Schedule::resumeLazyLoading(LazyTail&& tail)
+    {
+        this->m_lazy.reset();
+        if (tail.active && (this->snapshots.size() < this->m_sched_deck.size()))
+            this->m_lazy = std::make_unique<LazyLoader>(*this, std::move(tail));
+    }
+
+    const ScheduleState& Schedule::snapshot(const std::size_t report_step) const
+    {
+        if (! this->m_lazy)
+            return this->snapshots[report_step];
+
+        this->materialize(report_step);
+        return this->m_lazy->state(report_step);
+    }
+
+    ScheduleState& Schedule::snapshot(const std::size_t report_step)
+    {
+        this->materialize(report_step);
+        return this->snapshots[report_step];
+    }
+
+    /*
+      Update the last report step of the SCHEDULE section. This is the last
+      snapshot created while the SCHEDULE section is being loaded, but after
+      loading a lazy Schedule may not have created the last report step yet,
+      in which case the update is applied when it is loaded.
+    */
+    void Schedule::updateLastSnapshot(const std::function<void(ScheduleState&)>& update)
+    {
+        if (this->m_lazy && ! this->m_lazy->loading() &&
+            this->m_lazy->deferLastStepUpdate(update))
+        {
+            return;
+        }
+
+        update(this->snapshots.back());
+    }
+
     Schedule::Schedule( const Deck& deck,
+                        const EclipseGrid& ecl_grid,
+                        const FieldPropsManager& fp,
+                        const Runspec &runspec,
+                        const ParseContext& parseContext,
+                        ErrorGuard& errors,
+                        std::shared_ptr<const Python> python,
+                        const std::optional<int>& output_interval,
+                        const RestartIO::RstState * rst,
+                        const TracerConfig * tracer_config) :
+        Schedule(Timing::Scope{"Schedule"}, deck, ecl_grid, fp, runspec, parseContext, errors,
+                 std::move(python), output_interval, rst, tracer_config)
+    {}
+
+    Schedule::Schedule( Timing::Scope&&,
+                        const Deck& deck,
                         const EclipseGrid& ecl_grid,
                         const FieldPropsManager& fp,
                         const Runspec &runspec,
@@ -144,13 +768,26 @@ namespace Opm {
                 throw std::logic_error("Bug: when loading from restart a valid TracerConfig object must be supplied");
 
             auto restart_step = this->m_static.rst_info.report_step;
-            this->iterateScheduleSection( 0, restart_step, parseContext, errors, grid, nullptr, "");
+            if (parseContext.lazyScheduleLoading())
+                this->skipToRestart(restart_step, parseContext, errors, grid);
+            else
+                this->iterateScheduleSection( 0, restart_step, parseContext, errors, grid, nullptr, "");
             this->load_rst(*rst, *tracer_config, grid, fp);
             if (! this->restart_output.writeRestartFile(restart_step))
                 this->restart_output.addRestartOutput(restart_step);
-            this->iterateScheduleSection( restart_step, this->m_sched_deck.size(), parseContext, errors, grid, nullptr, "");
+            if (parseContext.lazyScheduleLoading()) {
+                this->m_lazy = std::make_unique<LazyLoader>(*this, ecl_grid, fp, parseContext, restart_step);
+                this->m_lazy->load(restart_step, errors);
+            }
+            else
+                this->iterateScheduleSection( restart_step, this->m_sched_deck.size(), parseContext, errors, grid, nullptr, "");
         } else {
-            this->iterateScheduleSection( 0, this->m_sched_deck.size(), parseContext, errors, grid, nullptr, "");
+            if (parseContext.lazyScheduleLoading()) {
+                this->m_lazy = std::make_unique<LazyLoader>(*this, ecl_grid, fp, parseContext, 0);
+                this->m_lazy->load(0, errors);
+            }
+            else
+                this->iterateScheduleSection( 0, this->m_sched_deck.size(), parseContext, errors, grid, nullptr, "");
         }
     }
     catch (const OpmInputError& opm_error) {
@@ -269,7 +906,7 @@ Schedule::Schedule(const Deck& deck, const EclipseState& es, const std::optional
     std::time_t Schedule::posixEndTime() const {
         // This should indeed access the start_time() property of the last
         // snapshot.
-        return std::chrono::system_clock::to_time_t(this->snapshots.back().start_time());
+        return this->simTime(this->size() - 1);
     }
 
 
@@ -464,7 +1101,9 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                       const ScheduleGrid& grid,
                                       const std::unordered_map<std::string, double> * target_wellpi,
                                       const std::string& prefix,
-                                      const bool log_to_debug) {
+                                      const bool log_to_debug,
+                                      WelSegsSet* welsegs_wells,
+                                      std::set<std::string>* compsegs_wells) {
 
         std::vector<std::pair< const DeckKeyword* , std::size_t> > rftProperties;
         std::string time_unit = this->m_static.m_unit_system.name(UnitSystem::measure::time);
@@ -514,8 +1153,14 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                location.lineno));
         }
 
-        std::set<std::string> compsegs_wells;
-        WelSegsSet welsegs_wells;
+        // The sets of multisegment wells must persist across calls when the
+        // Schedule section is loaded in several chunks.
+        std::set<std::string> local_compsegs_wells;
+        WelSegsSet local_welsegs_wells;
+        if (compsegs_wells == nullptr)
+            compsegs_wells = &local_compsegs_wells;
+        if (welsegs_wells == nullptr)
+            welsegs_wells = &local_welsegs_wells;
 
         for (auto report_step = load_start; report_step < load_end; report_step++) {
             std::size_t keyword_index = 0;
@@ -559,7 +1204,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                     auto [action, condition_errors] =
                         Action::parseActionX(keyword,
                                               this->m_static.m_runspec.actdims(),
-                                              std::chrono::system_clock::to_time_t(this->snapshots[report_step].start_time()));
+                                              std::chrono::system_clock::to_time_t(this->snapshot(report_step).start_time()));
 
                     for(const auto& [ marker, msg]: condition_errors) {
                         parseContext.handleError(marker, msg, keyword.location(), errors);
@@ -601,12 +1246,12 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                     nullptr,
                                     target_wellpi,
                                     wpimult_global_factor,
-                                    &welsegs_wells,
-                                    &compsegs_wells);
+                                    welsegs_wells,
+                                    compsegs_wells);
                 keyword_index++;
             }
 
-            check_compsegs_consistency(welsegs_wells, compsegs_wells, this->getWells(report_step));
+            check_compsegs_consistency(*welsegs_wells, *compsegs_wells, this->getWells(report_step));
             this->applyGlobalWPIMULT(wpimult_global_factor);
             this->end_report(report_step);
 
@@ -616,6 +1261,35 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
         } // for (auto report_step = load_start
     }
 
+    /*
+      The ScheduleDeck of a restarted run holds the keywords which are
+      loaded before the restart step in the first report step, and the
+      report steps up to the restart step are empty. Only the first report
+      step is iterated, the others are created as copies of it.
+    */
+    void Schedule::skipToRestart(const std::size_t restart_step,
+                                 const ParseContext& parseContext,
+                                 ErrorGuard& errors,
+                                 const ScheduleGrid& grid)
+    {
+        if (restart_step == 0)
+            return;
+
+        this->iterateScheduleSection(0, 1, parseContext, errors, grid, nullptr, "");
+        for (std::size_t report_step = 1; report_step < restart_step; ++report_step) {
+            const auto& block = this->m_sched_deck[report_step];
+            if (block.size() > 0) {
+                this->iterateScheduleSection(report_step, restart_step, parseContext, errors, grid, nullptr, "");
+                return;
+            }
+
+            this->create_next(block);
+            this->end_report(report_step);
+            if (this->must_write_rst_file(report_step))
+                this->restart_output.addRestartOutput(report_step);
+        }
+    }
+
     void Schedule::applyGlobalWPIMULT( const std::unordered_map<std::string, double>& wpimult_global_factor) {
         for (const auto& [well_name, factor] : wpimult_global_factor) {
             auto well = this->snapshots.back().wells(well_name);
@@ -647,16 +1321,11 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     void Schedule::prefetch_cell_properties(const ScheduleGrid& grid, const DeckKeyword& keyword){
         if(keyword.is<ParserKeywords::COMPDAT>()){
             for (auto record : keyword){
-                const auto& itemI = record.getItem("I");
-                const auto& itemJ = record.getItem("J");
-                bool defaulted_I = itemI.defaultApplied(0) || itemI.get<int>(0) == 0;
-                bool defaulted_J = itemJ.defaultApplied(0) || itemJ.get<int>(0) == 0;
-
-                if (defaulted_I || defaulted_J)
+                if (compdat_defaulted_ij(record))
                     throw std::logic_error(fmt::format("Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX"));
 
-                const int I = itemI.get<int>(0) - 1;
-                const int J = itemJ.get<int>(0) - 1;
+                const int I = record.getItem("I").get<int>(0) - 1;
+                const int J = record.getItem("J").get<int>(0) - 1;
                 int K1 = record.getItem("K1").get<int>(0) - 1;
                 int K2 = record.getItem("K2").get<int>(0) - 1;
 
@@ -707,7 +1376,10 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
       Well pointer that will go stale and needs to be refreshed.
     */
     bool Schedule::updateWellStatus( const std::string& well_name, std::size_t reportStep , Well::Status status, std::optional<KeywordLocation> location) {
-        auto well2 = this->snapshots[reportStep].wells.get(well_name);
+        // The report step following the updated one must be created from the
+        // unmodified well, as it is when the complete Schedule is loaded.
+        this->materialize(reportStep + 1);
+        auto well2 = this->snapshot(reportStep).wells.get(well_name);
         if (well2.getConnections().empty() && status == Well::Status::OPEN) {
             if (location) {
                 auto msg = fmt::format("Problem with {}\n"
@@ -723,9 +1395,12 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
         bool update = false;
         if (well2.updateStatus(status)) {
             if (status == Well::Status::OPEN) {
-                auto new_rft = this->snapshots.back().rft_config().well_open(well_name);
-                if (new_rft.has_value())
-                    this->snapshots.back().rft_config.update( std::move(*new_rft) );
+                this->updateLastSnapshot([well_name](ScheduleState& last)
+                {
+                    auto new_rft = last.rft_config().well_open(well_name);
+                    if (new_rft.has_value())
+                        last.rft_config.update( std::move(*new_rft) );
+                });
             }
 
             /*
@@ -736,10 +1411,13 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
               event.
             */
             if (old_status != status) {
-                this->snapshots.back().events().addEvent( ScheduleEvents::WELL_STATUS_CHANGE);
-                this->snapshots.back().wellgroup_events().addEvent( well2.name(), ScheduleEvents::WELL_STATUS_CHANGE);
+                this->updateLastSnapshot([well_name](ScheduleState& last)
+                {
+                    last.events().addEvent( ScheduleEvents::WELL_STATUS_CHANGE);
+                    last.wellgroup_events().addEvent( well_name, ScheduleEvents::WELL_STATUS_CHANGE);
+                });
             }
-            this->snapshots[reportStep].wells.update( std::move(well2) );
+            this->snapshot(reportStep).wells.update( std::move(well2) );
             update = true;
         }
         return update;
@@ -749,9 +1427,9 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     bool Schedule::updateWPAVE(const std::string& wname, std::size_t report_step, const PAvg& pavg) {
         const auto& well = this->getWell(wname, report_step);
         if (well.pavg() != pavg) {
-            auto new_well = this->snapshots[report_step].wells.get(wname);
+            auto new_well = this->snapshot(report_step).wells.get(wname);
             new_well.updateWPAVE( pavg );
-            this->snapshots[report_step].wells.update( std::move(new_well) );
+            this->snapshot(report_step).wells.update( std::move(new_well) );
             return true;
         }
         return false;
@@ -761,8 +1439,8 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
 
 
     std::optional<std::size_t> Schedule::first_RFT() const {
-        for (std::size_t report_step = 0; report_step < this->snapshots.size(); report_step++) {
-            if (this->snapshots[report_step].rft_config().active())
+        for (std::size_t report_step = 0; report_step < this->size(); report_step++) {
+            if (this->snapshot(report_step).rft_config().active())
                 return report_step;
         }
         return {};
@@ -907,7 +1585,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
 
 
     std::size_t Schedule::numWells() const {
-        return this->snapshots.back().wells.size();
+        return this->back().wells.size();
     }
 
     std::size_t Schedule::numWells(std::size_t timestep) const {
@@ -916,19 +1594,19 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     }
 
     bool Schedule::hasWell(const std::string& wellName) const {
-        return this->snapshots.back().wells.has(wellName);
+        return this->back().wells.has(wellName);
     }
 
     bool Schedule::hasWell(const std::string& wellName, std::size_t timeStep) const {
-        return this->snapshots[timeStep].wells.has(wellName);
+        return this->snapshot(timeStep).wells.has(wellName);
     }
 
     bool Schedule::hasGroup(const std::string& groupName, std::size_t timeStep) const {
-        return this->snapshots[timeStep].groups.has(groupName);
+        return this->snapshot(timeStep).groups.has(groupName);
     }
 
     std::vector< const Group* > Schedule::getChildGroups2(const std::string& group_name, std::size_t timeStep) const {
-        const auto& sched_state = this->snapshots[timeStep];
+        const auto& sched_state = this->snapshot(timeStep);
         const auto& group = sched_state.groups.get(group_name);
 
         std::vector<const Group*> child_groups;
@@ -939,7 +1617,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     }
 
     std::vector< Well > Schedule::getChildWells2(const std::string& group_name, std::size_t timeStep) const {
-        const auto& sched_state = this->snapshots[timeStep];
+        const auto& sched_state = this->snapshot(timeStep);
         const auto& group = sched_state.groups.get(group_name);
 
         std::vector<Well> wells;
@@ -964,13 +1642,13 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     */
     std::vector<std::string> Schedule::changed_wells(std::size_t report_step) const {
         std::vector<std::string> wells;
-        const auto& state = this->snapshots[report_step];
+        const auto& state = this->snapshot(report_step);
         const auto& all_wells = state.wells();
 
         if (report_step == 0)
             std::transform( all_wells.begin(), all_wells.end(), std::back_inserter(wells), [] (const auto& well_ref) { return well_ref.get().name(); });
         else {
-            const auto& prev_state = this->snapshots[report_step - 1];
+            const auto& prev_state = this->snapshot(report_step - 1);
             for (const auto& well_ref : all_wells) {
                 const auto& wname = well_ref.get().name();
                 if (prev_state.wells.has(wname)) {
@@ -988,25 +1666,26 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
 
     std::vector<Well> Schedule::getWells(std::size_t timeStep) const {
         std::vector<Well> wells;
-        if (timeStep >= this->snapshots.size())
+        if (timeStep >= this->size())
             throw std::invalid_argument("timeStep argument beyond the length of the simulation");
 
-        const auto& well_order = this->snapshots[timeStep].well_order();
-        for (const auto& wname : well_order)
-            wells.push_back( this->snapshots[timeStep].wells.get(wname) );
+        const auto& sched_state = this->snapshot(timeStep);
+        for (const auto& wname : sched_state.well_order())
+            wells.push_back( sched_state.wells.get(wname) );
 
         return wells;
     }
 
     std::vector<Well> Schedule::getWellsatEnd() const {
-        return this->getWells(this->snapshots.size() - 1);
+        return this->getWells(this->size() - 1);
     }
 
     const Well& Schedule::getWellatEnd(const std::string& well_name) const {
-        return this->getWell(well_name, this->snapshots.size() - 1);
+        return this->getWell(well_name, this->size() - 1);
     }
 
     std::unordered_set<int> Schedule::getAquiferFluxSchedule() const {
+        this->materializeAll();
         std::unordered_set<int> ids;
         for (const auto& snapshot : this->snapshots) {
             const auto& aquflux = snapshot.aqufluxs;
@@ -1018,7 +1697,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     }
 
     const Well& Schedule::getWell(const std::string& wellName, std::size_t timeStep) const {
-        return this->snapshots[timeStep].wells.get(wellName);
+        return this->snapshot(timeStep).wells.get(wellName);
     }
 
     const Well& Schedule::getWell(std::size_t well_index, std::size_t timeStep) const {
@@ -1027,7 +1706,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
             return well_pair.second->seqIndex() == well_index;
         };
 
-        auto well_ptr = this->snapshots[timeStep].wells.find( find_pred );
+        auto well_ptr = this->snapshot(timeStep).wells.find( find_pred );
         if (well_ptr == nullptr)
             throw std::invalid_argument(fmt::format("There is no well with well_index:{} at report_step:{}", well_index, timeStep));
 
@@ -1035,13 +1714,13 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     }
 
     const Group& Schedule::getGroup(const std::string& groupName, std::size_t timeStep) const {
-        return this->snapshots[timeStep].groups.get(groupName);
+        return this->snapshot(timeStep).groups.get(groupName);
     }
 
     void Schedule::updateGuideRateModel(const GuideRateModel& new_model, std::size_t report_step) {
-        auto new_config = this->snapshots[report_step].guide_rate();
+        auto new_config = this->snapshot(report_step).guide_rate();
         if (new_config.update_model(new_model))
-            this->snapshots[report_step].guide_rate.update( std::move(new_config) );
+            this->snapshot(report_step).guide_rate.update( std::move(new_config) );
     }
 
     /*
@@ -1091,14 +1770,11 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     }
 
     WellMatcher Schedule::wellMatcher(std::size_t report_step) const {
-        const ScheduleState * sched_state;
+        const auto& sched_state = (report_step < this->size())
+            ? this->snapshot(report_step)
+            : this->back();
 
-        if (report_step < this->snapshots.size())
-            sched_state = &this->snapshots[report_step];
-        else
-            sched_state = &this->snapshots.back();
-
-        return WellMatcher(sched_state->well_order.get(), sched_state->wlist_manager.get());
+        return WellMatcher(sched_state.well_order.get(), sched_state.wlist_manager.get());
     }
 
     std::function<std::unique_ptr<SegmentMatcher>()>
@@ -1117,12 +1793,12 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     }
 
     std::vector<std::string> Schedule::wellNames(std::size_t timeStep) const {
-        const auto& well_order = this->snapshots[timeStep].well_order();
+        const auto& well_order = this->snapshot(timeStep).well_order();
         return well_order.names();
     }
 
     std::vector<std::string> Schedule::wellNames() const {
-        const auto& well_order = this->snapshots.back().well_order();
+        const auto& well_order = this->back().well_order();
         return well_order.names();
     }
 
@@ -1130,7 +1806,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         if (pattern.size() == 0)
             return {};
 
-        const auto& group_order = this->snapshots[timeStep].group_order();
+        const auto& group_order = this->snapshot(timeStep).group_order();
 
         // Normal pattern matching
         auto star_pos = pattern.find('*');
@@ -1151,21 +1827,21 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     }
 
     std::vector<std::string> Schedule::groupNames(std::size_t timeStep) const {
-        const auto& group_order = this->snapshots[timeStep].group_order();
+        const auto& group_order = this->snapshot(timeStep).group_order();
         return group_order.names();
     }
 
     std::vector<std::string> Schedule::groupNames(const std::string& pattern) const {
-        return this->groupNames(pattern, this->snapshots.size() - 1);
+        return this->groupNames(pattern, this->size() - 1);
     }
 
     std::vector<std::string> Schedule::groupNames() const {
-        const auto& group_order = this->snapshots.back().group_order();
+        const auto& group_order = this->back().group_order();
         return group_order.names();
     }
 
     std::vector<const Group*> Schedule::restart_groups(std::size_t timeStep) const {
-        const auto& restart_groups = this->snapshots[timeStep].group_order().restart_groups();
+        const auto& restart_groups = this->snapshot(timeStep).group_order().restart_groups();
         std::vector<const Group*> rst_groups(restart_groups.size() , nullptr );
         for (std::size_t restart_index = 0; restart_index < restart_groups.size(); restart_index++) {
             const auto& group_name = restart_groups[restart_index];
@@ -1297,7 +1973,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
             const auto& well = this->getWell(wname, timeStep);
             const auto& connections = well.getConnections();
             if (connections.allConnectionsShut() && well.getStatus() != Well::Status::SHUT) {
-                auto elapsed = this->snapshots[timeStep].start_time() - this->snapshots[0].start_time();
+                auto elapsed = this->snapshot(timeStep).start_time() - this->snapshot(0).start_time();
                 auto days = std::chrono::duration_cast<std::chrono::hours>(elapsed).count() / 24.0;
                 auto msg = fmt::format("All completions in well {} is shut at {} days\n"
                                        "The well is therefore also shut", well.name(), days);
@@ -1313,6 +1989,9 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
 
     void Schedule::filterConnections(const ActiveGridCells& grid) {
+        if (this->m_lazy)
+            this->m_lazy->addConnectionFilter(grid);
+
         for (auto& sched_state : this->snapshots) {
             for (auto& well : sched_state.wells()) {
                 well.get().filterConnections(grid);
@@ -1322,7 +2001,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
 
     const UDQConfig& Schedule::getUDQConfig(std::size_t timeStep) const {
-        return this->snapshots[timeStep].udq.get();
+        return this->snapshot(timeStep).udq.get();
     }
 
     std::optional<int> Schedule::exitStatus() const {
@@ -1330,28 +2009,76 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     }
 
     std::size_t Schedule::size() const {
-        return this->snapshots.size();
+        return this->m_lazy ? this->m_sched_deck.size() : this->snapshots.size();
+    }
+
+    utility::PersistentMapMemoryUsage Schedule::MemoryUsage::total() const {
+        auto usage = this->wells;
+        usage += this->groups;
+        usage += this->vfpprod;
+        usage += this->vfpinj;
+        return usage;
+    }
+
+    Schedule::MemoryUsage Schedule::memory_usage() const {
+        // Only the report steps which have been loaded use memory.
+        MemoryUsage usage;
+        usage.snapshots = this->numLoadedSteps();
+
+        std::unordered_set<const void*> seen;
+        for (std::size_t step = 0; step < usage.snapshots; ++step) {
+            const auto& state = this->snapshot(step);
+            state.wells.memory_usage(seen, usage.wells);
+            state.groups.memory_usage(seen, usage.groups);
+            state.vfpprod.memory_usage(seen, usage.vfpprod);
+            state.vfpinj.memory_usage(seen, usage.vfpinj);
+        }
+
+        return usage;
     }
 
 
     double Schedule::seconds(std::size_t timeStep) const {
+        if (this->m_lazy) {
+            // The report step times are known from the schedule deck, also
+            // for the report steps which have not been loaded yet.
+            if (timeStep >= this->m_sched_deck.size())
+                throw std::logic_error(fmt::format("seconds({}) - invalid timeStep. Valid range [0,{}>", timeStep, this->m_sched_deck.size()));
+
+            return TimeService::to_time_t(this->m_sched_deck[timeStep].start_time())
+                - TimeService::to_time_t(this->m_sched_deck[0].start_time());
+        }
+
         if (this->snapshots.empty())
             return 0;
 
         if (timeStep >= this->snapshots.size())
             throw std::logic_error(fmt::format("seconds({}) - invalid timeStep. Valid range [0,{}>", timeStep, this->snapshots.size()));
 
-        auto elapsed = this->snapshots[timeStep].start_time() - this->snapshots[0].start_time();
+        auto elapsed = this->snapshot(timeStep).start_time() - this->snapshot(0).start_time();
         return std::chrono::duration_cast<std::chrono::seconds>(elapsed).count();
     }
 
     std::time_t Schedule::simTime(std::size_t timeStep) const {
-        return std::chrono::system_clock::to_time_t( this->snapshots[timeStep].start_time() );
+        if (this->m_lazy)
+            return TimeService::to_time_t(this->m_sched_deck[timeStep].start_time());
+
+        return std::chrono::system_clock::to_time_t( this->snapshot(timeStep).start_time() );
     }
 
     double Schedule::stepLength(std::size_t timeStep) const {
-        const auto start = this->snapshots[timeStep].start_time();
-        const auto end = this->snapshots[timeStep].end_time();
+        auto start = time_point{};
+        auto end = time_point{};
+        if (this->m_lazy) {
+            const auto& block = this->m_sched_deck[timeStep];
+            std::tie(start, end) = ScheduleState::step_times
+                (block.start_time(), block.end_time().value(), timeStep == 0);
+        }
+        else {
+            start = this->snapshot(timeStep).start_time();
+            end = this->snapshot(timeStep).end_time();
+        }
+
         if (start > end) {
             throw std::invalid_argument {
                     fmt::format(" Report step {} has start time after end time,\n"
@@ -1374,6 +2101,9 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         std::unordered_map<std::string, double> target_wellpi;
         std::vector<std::string> matching_wells;
         const std::string prefix = "| "; /* logger prefix string */
+        this->materialize(reportStep);
+        const auto num_loaded = this->snapshots.size();
+        const auto suspend = LazyLoader::Suspend { this->m_lazy.get() };
         this->snapshots.resize(reportStep + 1);
         auto& input_block = this->m_sched_deck[reportStep];
         std::unordered_map<std::string, double> wpimult_global_factor;
@@ -1393,7 +2123,12 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         }
         this->applyGlobalWPIMULT(wpimult_global_factor);
         this->end_report(reportStep);
-        if (reportStep < this->m_sched_deck.size() - 1) {
+        if (this->m_lazy) {
+            this->m_lazy->reload(reportStep + 1, num_loaded,
+                                 parseContext, errors, grid,
+                                 target_wellpi, prefix, false);
+        }
+        else if (reportStep < this->m_sched_deck.size() - 1) {
             iterateScheduleSection(
                 reportStep + 1,
                 this->m_sched_deck.size(),
@@ -1423,6 +2158,9 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                                   "keywords and\n{0}rerun Schedule section.\n{0}",
                                   prefix, action.name()));
 
+        this->materialize(reportStep);
+        const auto num_loaded = this->snapshots.size();
+        const auto suspend = LazyLoader::Suspend { this->m_lazy.get() };
         this->snapshots.resize(reportStep + 1);
         auto& input_block = this->m_sched_deck[reportStep];
 
@@ -1462,7 +2200,13 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
             }
         }
 
-        if (reportStep < this->m_sched_deck.size() - 1) {
+        if (this->m_lazy) {
+            const auto log_to_debug = true;
+            this->m_lazy->reload(reportStep + 1, num_loaded,
+                                 parseContext, errors, grid,
+                                 target_wellpi, prefix, log_to_debug);
+        }
+        else if (reportStep < this->m_sched_deck.size() - 1) {
             const auto log_to_debug = true;
             this->iterateScheduleSection(reportStep + 1, this->m_sched_deck.size(),
                                          parseContext, errors, grid, &target_wellpi,
@@ -1481,9 +2225,9 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
       supplied by the user in a script - can very well be wrong.
     */
     SimulatorUpdate Schedule::applyAction(std::size_t reportStep, const std::string& action_name, const std::vector<std::string>& matching_wells) {
-        const auto& actions = this->snapshots[reportStep].actions();
+        const auto& actions = this->snapshot(reportStep).actions();
         if (actions.has(action_name)) {
-            const auto& action = this->snapshots[reportStep].actions()[action_name];
+            const auto& action = this->snapshot(reportStep).actions()[action_name];
 
             std::vector<std::string> well_names;
             for (const auto& wname : matching_wells) {
@@ -1575,21 +2319,25 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     }
 
     void Schedule::applyWellProdIndexScaling(const std::string& well_name, const std::size_t reportStep, const double newWellPI) {
-        if (reportStep >= this->snapshots.size())
+        if (reportStep >= this->size())
             return;
 
-        if (!this->snapshots[reportStep].wells.has(well_name))
+        if (!this->snapshot(reportStep).wells.has(well_name))
             return;
 
+        // The report steps which have not been loaded yet are scaled when
+        // they are loaded.
+        const auto num_loaded = this->numLoadedSteps();
+
         std::vector<Well *> unique_wells;
-        for (std::size_t step = reportStep; step < this->snapshots.size(); step++) {
-            auto& well = this->snapshots[step].wells.get(well_name);
+        for (std::size_t step = reportStep; step < num_loaded; step++) {
+            auto& well = this->snapshot(step).wells.get(well_name);
             if (unique_wells.empty() || (!(*unique_wells.back() == well)))
                 unique_wells.push_back( &well );
         }
 
         std::vector<bool> scalingApplicable;
-        const auto targetPI = this->snapshots[reportStep].target_wellpi.at(well_name);
+        const auto targetPI = this->snapshot(reportStep).target_wellpi.at(well_name);
         auto prev_well = unique_wells[0];
         auto scalingFactor = prev_well->convertDeckPI(targetPI) / newWellPI;
         prev_well->applyWellProdIndexScaling(scalingFactor, scalingApplicable);
@@ -1601,6 +2349,9 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                 prev_well = wellPtr;
             }
         }
+
+        if (this->m_lazy && (num_loaded < this->size()))
+            this->m_lazy->addPIScaling(well_name, scalingFactor, std::move(scalingApplicable));
     }
 
     bool Schedule::write_rst_file(const std::size_t report_step) const
@@ -1622,34 +2373,33 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         // Previous output event time or start of simulation if no previous
         // event recorded
         const auto previous_output = previous_restart_output_step.has_value()
-            ? this->snapshots[previous_restart_output_step.value()].start_time()
-            : this->snapshots[0].start_time();
+            ? this->snapshot(previous_restart_output_step.value()).start_time()
+            : this->snapshot(0).start_time();
 
-        const auto& rst_config = this->snapshots[report_step - 1].rst_config();
-        return this->snapshots[report_step].rst_file(rst_config, previous_output);
+        const auto& rst_config = this->snapshot(report_step - 1).rst_config();
+        return this->snapshot(report_step).rst_file(rst_config, previous_output);
     }
 
     bool Schedule::isWList(std::size_t report_step, const std::string& pattern) const
     {
-        const ScheduleState * sched_state;
-
-        if (report_step < this->snapshots.size())
-            sched_state = &this->snapshots[report_step];
-        else
-            sched_state = &this->snapshots.back();
+        const auto& sched_state = (report_step < this->size())
+            ? this->snapshot(report_step)
+            : this->back();
 
-        return sched_state->wlist_manager.get().hasList(pattern);
+        return sched_state.wlist_manager.get().hasList(pattern);
     }
 
     const std::map< std::string, int >& Schedule::rst_keywords( size_t report_step ) const {
         if (report_step == 0)
             return this->m_static.rst_config.keywords;
 
-        const auto& keywords = this->snapshots[report_step - 1].rst_config().keywords;
+        const auto& keywords = this->snapshot(report_step - 1).rst_config().keywords;
         return keywords;
     }
 
     bool Schedule::operator==(const Schedule& data) const {
+        this->materializeAll();
+        data.materializeAll();
         return this->m_static == data.m_static &&
                this->m_sched_deck == data.m_sched_deck &&
                this->action_wgnames == data.action_wgnames &&
@@ -1929,7 +2679,7 @@ namespace {
 
 
     const GasLiftOpt& Schedule::glo(std::size_t report_step) const {
-        return this->snapshots[report_step].glo();
+        return this->snapshot(report_step).glo();
     }
 
 namespace {
@@ -2173,18 +2923,24 @@ bool Schedule::cmp(const Schedule& sched1, const Schedule& sched2, std::size_t r
 }
 
 const ScheduleState& Schedule::back() const {
+    this->materializeAll();
     return this->snapshots.back();
 }
 
 const ScheduleState& Schedule::operator[](std::size_t index) const {
-    return this->snapshots.at(index);
+    if (index >= this->size())
+        throw std::out_of_range(fmt::format("Report step {} out of range [0,{}>", index, this->size()));
+
+    return this->snapshot(index);
 }
 
 std::vector<ScheduleState>::const_iterator Schedule::begin() const {
+    this->materializeAll();
     return this->snapshots.begin();
 }
 
 std::vector<ScheduleState>::const_iterator Schedule::end() const {
+    this->materializeAll();
     return this->snapshots.end();
 }
 
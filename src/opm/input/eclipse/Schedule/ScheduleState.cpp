@@ -99,7 +99,7 @@ ScheduleState::ScheduleState(const time_point& t1)
 ScheduleState::ScheduleState(const time_point& start_time, const time_point& end_time)
     : ScheduleState(start_time)
 {
-    this->m_end_time = clamp_time(end_time);
+    this->m_end_time = step_times(start_time, end_time, true).second;
 }
 
 void ScheduleState::update_date(const time_point& prev_time)
@@ -167,7 +167,16 @@ ScheduleState::ScheduleState(const ScheduleState& src,
                              const time_point& end_time)
     : ScheduleState { src, start_time }
 {
-    this->m_end_time = end_time;
+    this->m_end_time = step_times(start_time, end_time, false).second;
+}
+
+std::pair<time_point, time_point>
+ScheduleState::step_times(const time_point& start_time,
+                          const time_point& end_time,
+                          const bool        first_step)
+{
+    return { clamp_time(start_time),
+             first_step ? clamp_time(end_time) : end_time };
 }
 
 time_point ScheduleState::start_time() const {
@@ -28,6 +28,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
@@ -639,6 +640,7 @@ void PAvgCalculator::pruneInactiveWBPCells(const std::vector<bool>& isActive)
         }
 
         this->contributingCells_.swap(newWBPCells);
+        this->cellsStamp_ = nextCellsStamp();
     }
 
     // Re-map/renumber original element indices to active cells only.
@@ -687,6 +689,13 @@ void PAvgCalculator::inferBlockAveragePressures(const Sources& sources,
     this->assignResults(controls);
 }
 
+std::size_t PAvgCalculator::nextCellsStamp()
+{
+    static auto stamp = std::atomic<std::size_t>{0};
+
+    return ++stamp;
+}
+
 std::vector<std::size_t> PAvgCalculator::allWellConnections() const
 {
     auto ix = std::vector<std::size_t>(this->connections_.size());
@@ -699,6 +708,34 @@ void PAvgCalculator::accumulateLocalContributions(const Sources& sources,
                                                   const PAvg&    controls,
                                                   const double   gravity,
                                                   const double   refDepth)
+{
+    this->gatherBlockSources(sources.wellBlocks());
+
+    this->accumulateGatheredContributions(sources, controls, gravity, refDepth);
+}
+
+void PAvgCalculator::gatherBlockSources(const PAvgDynamicSourceData& wellBlocks)
+{
+    using Item = PAvgDynamicSourceData::SourceDataSpan<const double>::Item;
+
+    this->blockSource_.resize(this->contributingCells_.size());
+
+    auto dest = this->blockSource_.begin();
+    for (const auto& cell : this->contributingCells_) {
+        const auto src = wellBlocks[cell];
+
+        dest->pressure = src[Item::Pressure];
+        dest->density  = src[Item::MixtureDensity];
+        dest->porevol  = src[Item::PoreVol];
+
+        ++dest;
+    }
+}
+
+void PAvgCalculator::accumulateGatheredContributions(const Sources& sources,
+                                                     const PAvg&    controls,
+                                                     const double   gravity,
+                                                     const double   refDepth)
 {
     this->accumCTF_.prepareAccumulation();
     this->accumPV_.prepareAccumulation();
@@ -707,10 +744,10 @@ void PAvgCalculator::accumulateLocalContributions(const Sources& sources,
         this->connectionPressureOffset(sources, controls, gravity, refDepth);
 
     if (controls.open_connections()) {
-        this->accumulateLocalContribOpen(sources, controls, connDP);
+        this->accumulateLocalContribOpen(controls, connDP);
     }
     else {
-        this->accumulateLocalContribAll(sources, controls, connDP);
+        this->accumulateLocalContribAll(controls, connDP);
     }
 }
 
@@ -829,8 +866,7 @@ void PAvgCalculator::addNeighbours_Z(const GridDims& cellIndexMap, SetupMap& set
 }
 
 template <typename ConnIndexMap, typename CTFPressureWeightFunction>
-void PAvgCalculator::accumulateLocalContributions(const Sources&             sources,
-                                                  const PAvg&                controls,
+void PAvgCalculator::accumulateLocalContributions(const PAvg&                controls,
                                                   const std::vector<double>& connDP,
                                                   ConnIndexMap               connIndex,
                                                   CTFPressureWeightFunction  ctfPressWeight)
@@ -848,17 +884,15 @@ void PAvgCalculator::accumulateLocalContributions(const Sources&             sou
     // Intermediate, per connection results pertaining to CTF-weighted sum.
     auto accumCTF_c = Accumulator{};
 
-    auto addContrib = [&sources, &ctfPressWeight, &accumCTF_c, this]
+    auto addContrib = [&ctfPressWeight, &accumCTF_c, this]
         (const ContrIndexType i, const double dp, PressureTermHandler handler)
     {
-        using Item = PAvgDynamicSourceData::SourceDataSpan<const double>::Item;
-
-        const auto src = sources.wellBlocks()[this->contributingCells_[i]];
-        const auto p   = src[Item::Pressure] + dp;
+        const auto& src = this->blockSource_[i];
+        const auto  p   = src.pressure + dp;
 
         // Use std::invoke() to simplify the calling syntax here.
         std::invoke(handler, accumCTF_c    , ctfPressWeight(src), p);
-        std::invoke(handler, this->accumPV_, src[Item::PoreVol] , p);
+        std::invoke(handler, this->accumPV_, src.porevol      , p);
     };
 
     const auto handlers = std::array {
@@ -895,8 +929,7 @@ void PAvgCalculator::accumulateLocalContributions(const Sources&             sou
 }
 
 template <typename ConnIndexMap>
-void PAvgCalculator::accumulateLocalContributions(const Sources&             sources,
-                                                  const PAvg&                controls,
+void PAvgCalculator::accumulateLocalContributions(const PAvg&                controls,
                                                   const std::vector<double>& connDP,
                                                   ConnIndexMap&&             connIndex)
 {
@@ -904,45 +937,39 @@ void PAvgCalculator::accumulateLocalContributions(const Sources&             sou
         // F1 < 0 => pore-volume weighting of individual cell contributions,
         // no weighting when commiting term.
 
-        this->accumulateLocalContributions(sources, controls, connDP,
+        this->accumulateLocalContributions(controls, connDP,
                                            std::forward<ConnIndexMap>(connIndex),
-                                           [](const auto& src)
+                                           [](const BlockSource& src)
                                            {
-                                               using Span = std::remove_cv_t<
-                                                   std::remove_reference_t<decltype(src)>>;
-                                               using Item = typename Span::Item;
-
-                                               return src[Item::PoreVol];
+                                               return src.porevol;
                                            });
     }
     else {
         // F1 >= 0 => unit weighting of individual cell contributions,
         // F1-weighting when committing term.
 
-        this->accumulateLocalContributions(sources, controls, connDP,
+        this->accumulateLocalContributions(controls, connDP,
                                            std::forward<ConnIndexMap>(connIndex),
-                                           [](const auto&) { return 1.0; });
+                                           [](const BlockSource&) { return 1.0; });
     }
 }
 
-void PAvgCalculator::accumulateLocalContribOpen(const Sources&             sources,
-                                                const PAvg&                controls,
+void PAvgCalculator::accumulateLocalContribOpen(const PAvg&                controls,
                                                 const std::vector<double>& connDP)
 {
     assert (connDP.size() == this->openConns_.size());
 
-    this->accumulateLocalContributions(sources, controls, connDP,
+    this->accumulateLocalContributions(controls, connDP,
                                        [this](const auto i)
                                        { return this->openConns_[i]; });
 }
 
-void PAvgCalculator::accumulateLocalContribAll(const Sources&             sources,
-                                               const PAvg&                controls,
+void PAvgCalculator::accumulateLocalContribAll(const PAvg&                controls,
                                                const std::vector<double>& connDP)
 {
     assert (connDP.size() == this->connections_.size());
 
-    this->accumulateLocalContributions(sources, controls, connDP,
+    this->accumulateLocalContributions(controls, connDP,
                                        [](const auto i) { return i; });
 }
 
@@ -976,7 +1003,6 @@ PAvgCalculator::connectionPressureOffsetWell(const std::size_t nconn,
 template <typename ConnIndexMap>
 std::vector<double>
 PAvgCalculator::connectionPressureOffsetRes(const std::size_t nconn,
-                                            const Sources&    sources,
                                             const double      gravity,
                                             const double      refDepth,
                                             ConnIndexMap      connIndex) const
@@ -990,13 +1016,11 @@ PAvgCalculator::connectionPressureOffsetRes(const std::size_t nconn,
 
     auto density = WeightedRunningAverage<double, double>{};
 
-    auto includeDensity = [this, &sources, &density](const ContrIndexType i)
+    auto includeDensity = [this, &density](const ContrIndexType i)
     {
-        using Item = PAvgDynamicSourceData::SourceDataSpan<const double>::Item;
-
-        const auto src = sources.wellBlocks()[this->contributingCells_[i]];
+        const auto& src = this->blockSource_[i];
 
-        density.add(src[Item::MixtureDensity], src[Item::PoreVol]);
+        density.add(src.density, src.porevol);
     };
 
     for (auto connID = 0*nconn; connID < nconn; ++connID) {
@@ -1042,11 +1066,11 @@ PAvgCalculator::connectionPressureOffset(const Sources& sources,
 
     if (controls.depth_correction() == PAvg::DepthCorrection::RES) {
         if (! controls.open_connections()) {
-            return this->connectionPressureOffsetRes(nconn, sources, gravity, refDepth,
+            return this->connectionPressureOffsetRes(nconn, gravity, refDepth,
                                                      [](const auto i) { return i; });
         }
 
-        return this->connectionPressureOffsetRes(nconn, sources, gravity, refDepth,
+        return this->connectionPressureOffsetRes(nconn, gravity, refDepth,
                                                  [this](const auto i)
                                                  {
                                                      return this->openConns_[i];
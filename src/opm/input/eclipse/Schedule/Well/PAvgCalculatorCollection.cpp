@@ -19,11 +19,16 @@
 
 #include <opm/input/eclipse/Schedule/Well/PAvgCalculatorCollection.hpp>
 
+#include <opm/input/eclipse/Schedule/Well/PAvg.hpp>
 #include <opm/input/eclipse/Schedule/Well/PAvgCalculator.hpp>
+#include <opm/input/eclipse/Schedule/Well/PAvgDynamicSourceData.hpp>
+
+#include <opm/common/utility/ParallelFor.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <initializer_list>
+#include <iterator>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -42,6 +47,8 @@ PAvgCalculatorCollection::setCalculator(const std::size_t wellID,
         indexPos != this->index_.end())
     {
         this->calculators_[indexPos->second] = std::move(calculator);
+        this->invalidateCellStructure();
+
         return indexPos->second;
     }
     else {
@@ -49,6 +56,7 @@ PAvgCalculatorCollection::setCalculator(const std::size_t wellID,
         this->index_.insert_or_assign(wellID, ix);
 
         this->calculators_.push_back(std::move(calculator));
+        this->invalidateCellStructure();
 
         return ix;
     }
@@ -77,6 +85,8 @@ void PAvgCalculatorCollection::pruneInactiveWBPCells(ActivePredicate isActive)
 
         calculatorPtr->pruneInactiveWBPCells({ begin, end });
     }
+
+    this->invalidateCellStructure();
 }
 
 PAvgCalculator&
@@ -115,4 +125,117 @@ std::vector<std::size_t> PAvgCalculatorCollection::allWBPCells() const
     return { wbpCells.begin(), std::unique(wbpCells.begin(), wbpCells.end()) };
 }
 
+void PAvgCalculatorCollection::
+inferBlockAveragePressures(const PAvgDynamicSourceData& wellBlocks,
+                           const std::vector<WellInputs>& inputs,
+                           const double                   gravity)
+{
+    if (inputs.size() != this->calculators_.size()) {
+        throw std::invalid_argument {
+            fmt::format("Number of well inputs ({}) does not match "
+                        "number of WBPn calculators ({})",
+                        inputs.size(), this->calculators_.size())
+        };
+    }
+
+    this->buildCellStructure();
+
+    using Item = PAvgDynamicSourceData::SourceDataSpan<const double>::Item;
+
+    // Look up each distinct source location only once, irrespective of
+    // how many wells it contributes to.
+    auto gathered = std::vector<PAvgCalculator::BlockSource>{};
+    gathered.reserve(this->uniqueCells_.size());
+    for (const auto& cell : this->uniqueCells_) {
+        const auto src = wellBlocks[cell];
+
+        gathered.push_back({ src[Item::Pressure],
+                             src[Item::MixtureDensity],
+                             src[Item::PoreVol] });
+    }
+
+    const auto numCalc = this->calculators_.size();
+
+    parallelFor(0, numCalc, 16, 1, [&](const std::size_t calcIx)
+    {
+        const auto& input = inputs[calcIx];
+        if ((input.wellConns == nullptr) || (input.controls == nullptr)) {
+            return;
+        }
+
+        auto& calc = *this->calculators_[calcIx];
+
+        calc.blockSource_.resize(this->cellStart_[calcIx + 1] -
+                                 this->cellStart_[calcIx]);
+
+        std::transform(this->cellIndex_.begin() + this->cellStart_[calcIx + 0],
+                       this->cellIndex_.begin() + this->cellStart_[calcIx + 1],
+                       calc.blockSource_.begin(),
+                       [&gathered](const auto ix) { return gathered[ix]; });
+
+        auto sources = PAvgCalculator::Sources{};
+        sources.wellBlocks(wellBlocks).wellConns(*input.wellConns);
+
+        calc.accumulateGatheredContributions(sources, *input.controls,
+                                             gravity, input.refDepth);
+    });
+
+    // Global contributions may involve collective communication, so must
+    // happen sequentially and in the same order on all ranks.
+    for (auto calcIx = 0*numCalc; calcIx < numCalc; ++calcIx) {
+        const auto& input = inputs[calcIx];
+        if ((input.wellConns == nullptr) || (input.controls == nullptr)) {
+            continue;
+        }
+
+        auto& calc = *this->calculators_[calcIx];
+
+        calc.collectGlobalContributions();
+        calc.assignResults(*input.controls);
+    }
+}
+
+void PAvgCalculatorCollection::buildCellStructure()
+{
+    const auto numCalc = this->calculators_.size();
+
+    // Calculators may have been pruned directly, through operator[], so
+    // verify that no calculator's cell list changed since the last build.
+    const auto isCurrent = (this->cellsStamp_.size() == numCalc)
+        && std::equal(this->cellsStamp_.begin(), this->cellsStamp_.end(),
+                      this->calculators_.begin(),
+                      [](const std::size_t stamp, const CalculatorPtr& calc)
+                      { return stamp == calc->cellsStamp_; });
+
+    if (isCurrent) {
+        return;
+    }
+
+    this->uniqueCells_ = this->allWBPCells();
+
+    this->cellStart_.assign(1, 0);
+    this->cellStart_.reserve(numCalc + 1);
+    this->cellIndex_.clear();
+    this->cellsStamp_.clear();
+    this->cellsStamp_.reserve(numCalc);
+
+    for (const auto& calculatorPtr : this->calculators_) {
+        this->cellsStamp_.push_back(calculatorPtr->cellsStamp_);
+
+        for (const auto& cell : calculatorPtr->allWBPCells()) {
+            const auto pos = std::lower_bound(this->uniqueCells_.begin(),
+                                              this->uniqueCells_.end(), cell);
+
+            this->cellIndex_.push_back(std::distance(this->uniqueCells_.begin(), pos));
+        }
+
+        this->cellStart_.push_back(this->cellIndex_.size());
+    }
+}
+
+void PAvgCalculatorCollection::invalidateCellStructure()
+{
+    this->cellsStamp_.clear();
+}
+
 } // namespace Opm
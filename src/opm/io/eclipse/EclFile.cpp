@@ -31,6 +31,7 @@
 #include <string>
 #include <numeric>
 #include <cmath>
+#include <type_traits>
 
 namespace Opm { namespace EclIO {
 
@@ -634,6 +635,120 @@ const std::vector<T>& EclFile::getImpl(int arrIndex, eclArrType type,
 }
 
 
+template<class T>
+std::vector<T> EclFile::getElementsImpl(int arrIndex, eclArrType type,
+                                        const std::unordered_map<int, std::vector<T>>& array,
+                                        const std::string& typeStr,
+                                        const std::vector<std::size_t>& elements)
+{
+    if (array_type[arrIndex] != type) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " is not of type " + typeStr;
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    if (!std::is_sorted(elements.begin(), elements.end())) {
+        OPM_THROW(std::invalid_argument, "Array elements must be requested in increasing order");
+    }
+
+    if (!elements.empty() && (elements.back() >= static_cast<std::size_t>(array_size[arrIndex]))) {
+        std::string message = "Element " + std::to_string(elements.back()) + " out of range for array "
+            + array_name[arrIndex] + " of size " + std::to_string(array_size[arrIndex]);
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    std::vector<T> result;
+    result.reserve(elements.size());
+
+    // Formatted arrays have no fixed layout on disk and must be parsed in
+    // full.  Use the full array also if it is already in memory.
+    if (formatted || arrayLoaded[arrIndex]) {
+        const auto& data = getImpl(arrIndex, type, array, typeStr);
+
+        for (const auto& element : elements) {
+            result.push_back(data[element]);
+        }
+
+        return result;
+    }
+
+    std::fstream fileH;
+    fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+
+    if (!fileH) {
+        std::string message="Could not open file: '" + inputFilename +"'";
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    // Binary arrays are stored in blocks of at most maxNumberOfElements
+    // elements, each enclosed by a head and a tail record marker.  Read the
+    // range of requested elements within each block touched by the request.
+    const auto [sizeOfElement, maxBlockSize] = block_size_data_binary(type);
+    const auto maxNumberOfElements = static_cast<std::size_t>(maxBlockSize / sizeOfElement);
+    const auto blockStride = static_cast<std::uint64_t>(maxBlockSize) + 2*sizeof(int);
+
+    std::vector<T> buf;
+
+    auto begin = elements.begin();
+    while (begin != elements.end()) {
+        const auto block = *begin / maxNumberOfElements;
+        const auto end = std::find_if(begin, elements.end(),
+                                      [block, maxNumberOfElements](const std::size_t element)
+                                      { return element / maxNumberOfElements != block; });
+
+        const auto first = *begin % maxNumberOfElements;
+        const auto last = *std::prev(end) % maxNumberOfElements;
+
+        fileH.seekg(ifStreamPos[arrIndex] + block*blockStride + sizeof(int) + first*sizeOfElement,
+                    fileH.beg);
+
+        buf.resize(last - first + 1);
+        fileH.read(reinterpret_cast<char*>(buf.data()), buf.size()*sizeof(T));
+
+        if (!fileH) {
+            std::string message = "Error reading binary data for array " + array_name[arrIndex];
+            OPM_THROW(std::runtime_error, message);
+        }
+
+        for (auto it = begin; it != end; ++it) {
+            const auto value = buf[*it % maxNumberOfElements - first];
+
+            if constexpr (std::is_same_v<T, int>) {
+                result.push_back(flipEndianInt(value));
+            } else if constexpr (std::is_same_v<T, float>) {
+                result.push_back(flipEndianFloat(value));
+            } else {
+                result.push_back(flipEndianDouble(value));
+            }
+        }
+
+        begin = end;
+    }
+
+    return result;
+}
+
+
+template<>
+std::vector<int> EclFile::getElements<int>(int arrIndex, const std::vector<std::size_t>& elements)
+{
+    return getElementsImpl(arrIndex, INTE, inte_array, "integer", elements);
+}
+
+
+template<>
+std::vector<float> EclFile::getElements<float>(int arrIndex, const std::vector<std::size_t>& elements)
+{
+    return getElementsImpl(arrIndex, REAL, real_array, "float", elements);
+}
+
+
+template<>
+std::vector<double> EclFile::getElements<double>(int arrIndex, const std::vector<std::size_t>& elements)
+{
+    return getElementsImpl(arrIndex, DOUB, doub_array, "double", elements);
+}
+
+
 std::size_t EclFile::size() const {
     return this->array_name.size();
 }
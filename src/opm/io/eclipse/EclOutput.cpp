@@ -20,6 +20,7 @@
 #include <opm/io/eclipse/EclUtil.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/ScopedTimer.hpp>
 
 #include <algorithm>
 #include <cmath>
@@ -173,6 +174,7 @@ void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclAr
         ofileH.write(reinterpret_cast<char*>(&flippedx231), sizeof(flippedx231));
         ofileH.write("X231", 4);
         ofileH.write(reinterpret_cast<char*>(&bhead), sizeof(bhead));
+        Timing::addCount(Timing::Counter::BytesWritten, 16 + 2*sizeof(bhead));
 
         size = size - (x231 * val231);
     }
@@ -217,6 +219,7 @@ void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclAr
     }
 
     ofileH.write(reinterpret_cast<char *>(&bhead), sizeof(bhead));
+    Timing::addCount(Timing::Counter::BytesWritten, 16 + 2*sizeof(bhead));
 }
 
 template <typename T>
@@ -319,6 +322,7 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
         offset += num;
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        Timing::addCount(Timing::Counter::BytesWritten, num*sizeOfElement + 2*sizeof(dhead));
     }
 }
 
@@ -374,6 +378,7 @@ void EclOutput::writeBinaryCharArray(const std::vector<std::string>& data, int e
         }
 
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        Timing::addCount(Timing::Counter::BytesWritten, num*sizeOfElement + 2*sizeof(dhead));
     }
 }
 
@@ -410,6 +415,7 @@ void EclOutput::writeBinaryCharArray(const std::vector<PaddedOutputString<8>>& d
         }
 
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        Timing::addCount(Timing::Counter::BytesWritten, numElm*sizeOfElement + 2*sizeof(dhead));
     }
 }
 
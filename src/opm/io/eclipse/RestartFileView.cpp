@@ -76,7 +76,8 @@ class Opm::EclIO::RestartFileView::Implementation
 {
 public:
     explicit Implementation(std::shared_ptr<ERst> restart_file,
-                            const int             report_step);
+                            const int             report_step,
+                            const bool            preload);
 
     ~Implementation() = default;
 
@@ -119,6 +120,29 @@ public:
             getRestartData<ElmType>(vector, this->report_step_, occurrence);
     }
 
+    std::size_t keywordSize(const std::string& vector) const
+    {
+        auto size_iter = this->sizes_.find(vector);
+        if (size_iter == this->sizes_.end()) {
+            throw std::invalid_argument {
+                "Vector '" + vector + "' does not exist in restart file"
+            };
+        }
+
+        return size_iter->second;
+    }
+
+    template <typename ElmType>
+    std::vector<ElmType>
+    getKeywordElements(const std::string&              vector,
+                       const std::vector<std::size_t>& elements,
+                       const int                       occurrence)
+    {
+        return this->rst_file_->
+            getRestartDataElements<ElmType>(vector, this->report_step_,
+                                            elements, occurrence);
+    }
+
     const std::vector<int>& intehead()
     {
         const auto ihkw = std::string { "INTEHEAD" };
@@ -165,11 +189,13 @@ private:
     using TypedColl  = std::unordered_map<
         eclArrType, VectorColl, std::hash<int>
         >;
+    using SizeColl   = std::unordered_map<std::string, std::size_t>;
 
     RstFile     rst_file_;
     int         report_step_;
     std::size_t sim_step_;
     TypedColl   vectors_;
+    SizeColl    sizes_;
 
     bool collectionContains(const VectorColl&  coll,
                             const std::string& vector) const
@@ -180,7 +206,8 @@ private:
 
 Opm::EclIO::RestartFileView::Implementation::
 Implementation(std::shared_ptr<ERst> restart_file,
-               const int             report_step)
+               const int             report_step,
+               const bool            preload)
     : rst_file_   { std::move(restart_file) }
     , report_step_(report_step)
     , sim_step_   (std::max(report_step - 1, 0))
@@ -190,7 +217,9 @@ Implementation(std::shared_ptr<ERst> restart_file,
         return;
     }
 
-    this->rst_file_->loadReportStepNumber(this->report_step_);
+    if (preload) {
+        this->rst_file_->loadReportStepNumber(this->report_step_);
+    }
 
     for (const auto& vector : this->rst_file_->listOfRstArrays(this->report_step_)) {
         const auto& type = std::get<1>(vector);
@@ -202,6 +231,9 @@ Implementation(std::shared_ptr<ERst> restart_file,
 
         default:
             this->vectors_[type].emplace(std::get<0>(vector));
+
+            // Size of first occurrence.
+            this->sizes_.emplace(std::get<0>(vector), std::get<2>(vector));
             break;
         }
     }
@@ -213,6 +245,7 @@ Implementation(Implementation&& rhs)
     , report_step_(rhs.report_step_)
     , sim_step_   (rhs.sim_step_)            // Scalar (size_t)
     , vectors_    (std::move(rhs.vectors_))
+    , sizes_      (std::move(rhs.sizes_))
 {}
 
 Opm::EclIO::RestartFileView::Implementation&
@@ -222,13 +255,15 @@ Opm::EclIO::RestartFileView::Implementation::operator=(Implementation&& rhs)
     this->report_step_ = rhs.report_step_;         // Scalar (int)
     this->sim_step_    = rhs.sim_step_;            // Scalar (size_t)
     this->vectors_     = std::move(rhs.vectors_);
+    this->sizes_       = std::move(rhs.sizes_);
 
     return *this;
 }
 
 Opm::EclIO::RestartFileView::RestartFileView(std::shared_ptr<ERst> restart_file,
-                                             const int             report_step)
-    : pImpl_{ new Implementation{ std::move(restart_file), report_step } }
+                                             const int             report_step,
+                                             const bool            preload)
+    : pImpl_{ new Implementation{ std::move(restart_file), report_step, preload } }
 {}
 
 Opm::EclIO::RestartFileView::~RestartFileView()
@@ -289,6 +324,21 @@ Opm::EclIO::RestartFileView::getKeyword(const std::string& vector,
     return this->pImpl_->template getKeyword<ElmType>(vector, occurrence);
 }
 
+std::size_t
+Opm::EclIO::RestartFileView::keywordSize(const std::string& vector) const
+{
+    return this->pImpl_->keywordSize(vector);
+}
+
+template <typename ElmType>
+std::vector<ElmType>
+Opm::EclIO::RestartFileView::getKeywordElements(const std::string&              vector,
+                                                const std::vector<std::size_t>& elements,
+                                                const int                       occurrence) const
+{
+    return this->pImpl_->template getKeywordElements<ElmType>(vector, elements, occurrence);
+}
+
 // =====================================================================
 
 namespace Opm { namespace EclIO {
@@ -314,4 +364,19 @@ RestartFileView::getKeyword<double>(const std::string&, const int) const;
 template const std::vector<std::string>&
 RestartFileView::getKeyword<std::string>(const std::string&, const int) const;
 
+template std::vector<int>
+RestartFileView::getKeywordElements<int>(const std::string&,
+                                         const std::vector<std::size_t>&,
+                                         const int) const;
+
+template std::vector<float>
+RestartFileView::getKeywordElements<float>(const std::string&,
+                                           const std::vector<std::size_t>&,
+                                           const int) const;
+
+template std::vector<double>
+RestartFileView::getKeywordElements<double>(const std::string&,
+                                            const std::vector<std::size_t>&,
+                                            const int) const;
+
 }} // Opm::EclIO
@@ -203,6 +203,8 @@ applySwatinit(unsigned elemIdx,
             // Max. cap. pressure adjusted from SWATINIT data
             else
                 elemScaledEpsInfo.maxPcow = newMaxPcow;
+            if (regionSharedParams_)
+                detachOilWaterParams_(elemIdx);
             auto& elemEclEpsScalingPoints = oilWaterScaledEpsPointsDrainage(elemIdx);
             elemEclEpsScalingPoints.init(elemScaledEpsInfo,
                                          *oilWaterEclEpsConfig_,
@@ -225,6 +227,9 @@ EclMaterialLawManager<TraitsT>::applyRestartSwatInit(const unsigned elemIdx,
 
     elemScaledEpsInfo.maxPcow = maxPcow;
 
+    if (this->regionSharedParams_)
+        this->detachOilWaterParams_(elemIdx);
+
     this->oilWaterScaledEpsPointsDrainage(elemIdx)
         .init(elemScaledEpsInfo,
               *this->oilWaterEclEpsConfig_,
@@ -238,6 +243,13 @@ connectionMaterialLawParams(unsigned satRegionIdx, unsigned elemIdx) const
 {
     MaterialLawParams& mlp = const_cast<MaterialLawParams&>(materialLawParams_[elemIdx]);
 
+    // the drainage parameters of the cell are modified below, which must not affect
+    // the other cells of its saturation region
+    if (!sharedTwoPhaseParams_.empty() && sharedTwoPhaseParams_[elemIdx]) {
+        detachTwoPhaseParams_(mlp);
+        sharedTwoPhaseParams_[elemIdx] = false;
+    }
+
     if (enableHysteresis())
         OpmLog::warning("Warning: Using non-default satnum regions for connection is not tested in combination with hysteresis");
     // Currently we don't support COMPIMP. I.e. use the same table lookup for the hysteresis curves.
@@ -431,6 +443,78 @@ oilWaterScaledEpsPointsDrainage(unsigned elemIdx)
     }
 }
 
+template<class TraitsT>
+void EclMaterialLawManager<TraitsT>::
+detachOilWaterParams_(unsigned elemIdx)
+{
+    // give the cell its own copy of the oil-water parameters which it might share
+    // with the other cells of its saturation region
+    auto& materialParams = materialLawParams_[elemIdx];
+    switch (materialParams.approach()) {
+    case EclMultiplexerApproach::Stone1: {
+        auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::Stone1>();
+        realParams.setOilWaterParams(std::make_shared<OilWaterTwoPhaseHystParams>(realParams.oilWaterParams()));
+        break;
+    }
+
+    case EclMultiplexerApproach::Stone2: {
+        auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::Stone2>();
+        realParams.setOilWaterParams(std::make_shared<OilWaterTwoPhaseHystParams>(realParams.oilWaterParams()));
+        break;
+    }
+
+    case EclMultiplexerApproach::Default: {
+        auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::Default>();
+        realParams.setOilWaterParams(std::make_shared<OilWaterTwoPhaseHystParams>(realParams.oilWaterParams()));
+        break;
+    }
+
+    case EclMultiplexerApproach::TwoPhase: {
+        auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::TwoPhase>();
+        realParams.setOilWaterParams(std::make_shared<OilWaterTwoPhaseHystParams>(realParams.oilWaterParams()));
+        break;
+    }
+    default:
+        throw std::logic_error("Enum value for material approach unknown!");
+    }
+}
+
+template<class TraitsT>
+void EclMaterialLawManager<TraitsT>::
+detachTwoPhaseParams_(MaterialLawParams& materialParams)
+{
+    // give the cell its own copies of all two-phase parameters which it shares with
+    // the other cells of its saturation region
+    const auto detach = [](auto& realParams)
+    {
+        realParams.setGasOilParams(std::make_shared<GasOilTwoPhaseHystParams>(realParams.gasOilParams()));
+        realParams.setOilWaterParams(std::make_shared<OilWaterTwoPhaseHystParams>(realParams.oilWaterParams()));
+    };
+
+    switch (materialParams.approach()) {
+    case EclMultiplexerApproach::Stone1:
+        detach(materialParams.template getRealParams<EclMultiplexerApproach::Stone1>());
+        break;
+
+    case EclMultiplexerApproach::Stone2:
+        detach(materialParams.template getRealParams<EclMultiplexerApproach::Stone2>());
+        break;
+
+    case EclMultiplexerApproach::Default:
+        detach(materialParams.template getRealParams<EclMultiplexerApproach::Default>());
+        break;
+
+    case EclMultiplexerApproach::TwoPhase: {
+        auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::TwoPhase>();
+        detach(realParams);
+        realParams.setGasWaterParams(std::make_shared<GasWaterTwoPhaseHystParams>(realParams.gasWaterParams()));
+        break;
+    }
+    default:
+        throw std::logic_error("Enum value for material approach unknown!");
+    }
+}
+
 template<class TraitsT>
 const typename EclMaterialLawManager<TraitsT>::MaterialLawParams& EclMaterialLawManager<TraitsT>::
 materialLawParamsFunc_(unsigned elemIdx, FaceDir::DirEnum facedir) const
@@ -20,11 +20,16 @@
 
 #include <config.h>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 
 #include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
 #include <opm/material/fluidmatrixinteractions/EclEpsGridProperties.hpp>
 
+#include <cstddef>
+#include <map>
+#include <utility>
 
 namespace Opm {
 
@@ -65,24 +70,81 @@ run(const std::function<std::vector<int>(const FieldPropsManager&, const std::st
     std::vector<std::vector<int>*> imbnumArray;
     std::vector<std::vector<MaterialLawParams>*> mlpArray;
     initArrays_(satnumArray, imbnumArray, mlpArray);
+    // Without hysteresis the two-phase parameters do not carry any per-cell state, so
+    // cells without end-point scaling may share them per (saturation, end-point) region.
+    const bool shareRegionParams = this->parent_.regionSharedParams() && !this->parent_.enableHysteresis();
+    const std::size_t numElems = this->numCompressedElems_;
+    // The lookup function supplied by the caller need not be thread safe, so the
+    // level zero indices are computed serially before the parallel loops below.
+    std::vector<unsigned> levelZeroIdx(numElems);
+    for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx)
+        levelZeroIdx[elemIdx] = lookupIdxOnLevelZeroAssigner(elemIdx);
+    const std::function<unsigned(unsigned)> lookupIdxOnLevelZero =
+        [&levelZeroIdx](unsigned elemIdx) { return levelZeroIdx[elemIdx]; };
+    // The end-point region of a cell without end-point scaling (-1 otherwise) does
+    // not depend on the directional array, so it is determined once per cell.
+    std::vector<int> cellEpsRegion;
+    if (shareRegionParams) {
+        cellEpsRegion.resize(numElems);
+        forEachElement_(numElems, [&](unsigned elemIdx) {
+            const auto epsRegionIdx = unscaledEpsRegion_(elemIdx, lookupIdxOnLevelZero);
+            cellEpsRegion[elemIdx] = epsRegionIdx.has_value() ? static_cast<int>(*epsRegionIdx) : -1;
+        });
+    }
     auto num_arrays = mlpArray.size();
     for (unsigned i=0; i<num_arrays; i++) {
-        for (unsigned elemIdx = 0; elemIdx < this->numCompressedElems_; ++elemIdx) {
+        // The shared parameters of a region are created from its first cell before the
+        // parallel loop, so the result does not depend on the order in which the
+        // threads process the cells.
+        std::map<std::pair<unsigned, unsigned>, HystParams> regionHystParams;
+        if (shareRegionParams) {
+            for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
+                if (cellEpsRegion[elemIdx] < 0)
+                    continue;
+                unsigned satRegionIdx = satRegion_(*satnumArray[i], elemIdx);
+                const auto key = std::make_pair(satRegionIdx, static_cast<unsigned>(cellEpsRegion[elemIdx]));
+                if (regionHystParams.count(key) > 0)
+                    continue;
+                HystParams hystParams {*this};
+                hystParams.setConfig(satRegionIdx);
+                hystParams.setDrainageParamsOilGas(elemIdx, satRegionIdx, lookupIdxOnLevelZero);
+                hystParams.setDrainageParamsOilWater(elemIdx, satRegionIdx, lookupIdxOnLevelZero);
+                hystParams.setDrainageParamsGasWater(elemIdx, satRegionIdx, lookupIdxOnLevelZero);
+                hystParams.finalize();
+                regionHystParams.emplace(key, hystParams);
+            }
+        }
+
+        forEachElement_(numElems, [&](unsigned elemIdx) {
             unsigned satRegionIdx = satRegion_(*satnumArray[i], elemIdx);
             //unsigned satNumCell = this->parent_.satnumRegionArray_[elemIdx];
+            if (shareRegionParams && cellEpsRegion[elemIdx] >= 0) {
+                const auto epsRegionIdx = static_cast<unsigned>(cellEpsRegion[elemIdx]);
+                this->parent_.oilWaterScaledEpsInfoDrainage_[elemIdx] = this->parent_.unscaledEpsInfo_[epsRegionIdx];
+                auto& hystParams = regionHystParams.at(std::make_pair(satRegionIdx, epsRegionIdx));
+                initThreePhaseParams_(hystParams, (*mlpArray[i])[elemIdx], satRegionIdx, elemIdx);
+                return;
+            }
             HystParams hystParams {*this};
             hystParams.setConfig(satRegionIdx);
-            hystParams.setDrainageParamsOilGas(elemIdx, satRegionIdx, lookupIdxOnLevelZeroAssigner);
-            hystParams.setDrainageParamsOilWater(elemIdx, satRegionIdx, lookupIdxOnLevelZeroAssigner);
-            hystParams.setDrainageParamsGasWater(elemIdx, satRegionIdx, lookupIdxOnLevelZeroAssigner);
+            hystParams.setDrainageParamsOilGas(elemIdx, satRegionIdx, lookupIdxOnLevelZero);
+            hystParams.setDrainageParamsOilWater(elemIdx, satRegionIdx, lookupIdxOnLevelZero);
+            hystParams.setDrainageParamsGasWater(elemIdx, satRegionIdx, lookupIdxOnLevelZero);
             if (this->parent_.enableHysteresis()) {
                 unsigned imbRegionIdx = imbRegion_(*imbnumArray[i], elemIdx);
-                hystParams.setImbibitionParamsOilGas(elemIdx, imbRegionIdx, lookupIdxOnLevelZeroAssigner);
-                hystParams.setImbibitionParamsOilWater(elemIdx, imbRegionIdx, lookupIdxOnLevelZeroAssigner);
-                hystParams.setImbibitionParamsGasWater(elemIdx, imbRegionIdx, lookupIdxOnLevelZeroAssigner);
+                hystParams.setImbibitionParamsOilGas(elemIdx, imbRegionIdx, lookupIdxOnLevelZero);
+                hystParams.setImbibitionParamsOilWater(elemIdx, imbRegionIdx, lookupIdxOnLevelZero);
+                hystParams.setImbibitionParamsGasWater(elemIdx, imbRegionIdx, lookupIdxOnLevelZero);
             }
             hystParams.finalize();
             initThreePhaseParams_(hystParams, (*mlpArray[i])[elemIdx], satRegionIdx, elemIdx);
+        });
+
+        if (shareRegionParams && (mlpArray[i] == &this->parent_.materialLawParams_)) {
+            auto& shared = this->parent_.sharedTwoPhaseParams_;
+            shared.assign(numElems, false);
+            for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx)
+                shared[elemIdx] = cellEpsRegion[elemIdx] >= 0;
         }
     }
 }
@@ -121,6 +183,19 @@ copyIntArray_(std::vector<int>& dest, const std::string keyword,
     }
 }
 
+template <class Traits>
+template <class Function>
+void
+EclMaterialLawManager<Traits>::InitParams::
+forEachElement_(std::size_t numElems, Function&& fn)
+{
+    // The cells are independent of each other.
+    parallelFor(0, numElems, 1024, 256, [&fn](const std::size_t elemIdx)
+    {
+        fn(static_cast<unsigned>(elemIdx));
+    });
+}
+
 template <class Traits>
 unsigned
 EclMaterialLawManager<Traits>::InitParams::
@@ -339,6 +414,24 @@ satOrImbRegion_(std::vector<int>& array, std::vector<int>& default_vec, unsigned
     return static_cast<unsigned>(value);
 }
 
+template <class Traits>
+std::optional<unsigned>
+EclMaterialLawManager<Traits>::InitParams::
+unscaledEpsRegion_(unsigned elemIdx, const std::function<unsigned(unsigned)>& lookupIdxOnLevelZeroAssigner)
+{
+    // The scaled end-point information is the same for all two-phase systems, see
+    // HystParams::readScaledEpsPoints_(), so comparing it once suffices.
+    const auto lookupIdx = lookupIdxOnLevelZeroAssigner(elemIdx);
+    const unsigned epsRegionIdx = this->epsGridProperties_->satRegion(lookupIdx);
+    const auto& unscaledInfo = this->parent_.unscaledEpsInfo_[epsRegionIdx];
+    EclEpsScalingPointsInfo<Scalar> scaledInfo(unscaledInfo);
+    scaledInfo.extractScaled(this->eclState_, *this->epsGridProperties_, lookupIdx);
+    if (!(scaledInfo == unscaledInfo))
+        return std::nullopt;
+
+    return epsRegionIdx;
+}
+
 // Make some actual code, by realizing the previously defined templated class
 template class EclMaterialLawManager<ThreePhaseMaterialTraits<double,0,1,2>>::InitParams;
 template class EclMaterialLawManager<ThreePhaseMaterialTraits<float,0,1,2>>::InitParams;
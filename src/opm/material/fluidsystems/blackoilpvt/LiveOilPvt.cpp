@@ -301,6 +301,7 @@ void LiveOilPvt<Scalar>::initEnd()
 {
     // calculate the final 2D functions which are used for interpolation.
     size_t numRegions = oilMuTable_.size();
+    sharedInvBSampling_.assign(numRegions, false);
     for (unsigned regionIdx = 0; regionIdx < numRegions; ++ regionIdx) {
         // calculate the table which stores the inverse of the product of the oil
         // formation volume factor and the oil viscosity
@@ -339,6 +340,8 @@ void LiveOilPvt<Scalar>::initEnd()
         invSatOilB.setXYContainers(satPressuresArray, invSatOilBArray);
         invSatOilBMu.setXYContainers(satPressuresArray, invSatOilBMuArray);
 
+        sharedInvBSampling_[regionIdx] = invOilB.hasSameSampling(invOilBMu);
+
         updateSaturationPressure_(regionIdx);
     }
 }
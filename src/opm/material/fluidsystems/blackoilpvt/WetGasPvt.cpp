@@ -332,6 +332,7 @@ void WetGasPvt<Scalar>::initEnd()
 {
     // calculate the final 2D functions which are used for interpolation.
     size_t numRegions = gasMu_.size();
+    sharedInvBSampling_.assign(numRegions, false);
     for (unsigned regionIdx = 0; regionIdx < numRegions; ++ regionIdx) {
         // calculate the table which stores the inverse of the product of the gas
         // formation volume factor and the gas viscosity
@@ -369,6 +370,8 @@ void WetGasPvt<Scalar>::initEnd()
         invSatGasB.setXYContainers(satPressuresArray, invSatGasBArray);
         invSatGasBMu.setXYContainers(satPressuresArray, invSatGasBMuArray);
 
+        sharedInvBSampling_[regionIdx] = invGasB.hasSameSampling(invGasBMu);
+
         updateSaturationPressure_(regionIdx);
     }
 }
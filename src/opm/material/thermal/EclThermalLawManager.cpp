@@ -33,6 +33,7 @@
 #include <opm/material/fluidsystems/BlackOilFluidSystem.hpp>
 
 #include <cassert>
+#include <cstddef>
 #include <stdexcept>
 
 namespace Opm {
@@ -132,7 +133,8 @@ initHeatcr_(const EclipseState& eclState, size_t numElems,
     const std::vector<double>& heatcrData = assignFieldPropsDoubleOnLeaf(eclState.fieldProps(), "HEATCR", numElems);
     const std::vector<double>& heatcrtData = assignFieldPropsDoubleOnLeaf(eclState.fieldProps(), "HEATCRT", numElems);
     solidEnergyLawParams_.resize(numElems);
-    for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
+    #pragma omp parallel for if (numElems > 1024)
+    for (std::size_t elemIdx = 0; elemIdx < numElems; ++elemIdx) {
         auto& elemParam = solidEnergyLawParams_[elemIdx];
         elemParam.setSolidEnergyApproach(EclSolidEnergyApproach::Heatcr);
         auto& heatcrElemParams = elemParam.template getRealParams<EclSolidEnergyApproach::Heatcr>();
@@ -205,7 +207,8 @@ initThconr_(const EclipseState& eclState, size_t numElems,
         thconsfData =  assignFieldPropsDoubleOnLeaf(fp, "THCONSF", numElems);
 
     thermalConductionLawParams_.resize(numElems);
-    for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
+    #pragma omp parallel for if (numElems > 1024)
+    for (std::size_t elemIdx = 0; elemIdx < numElems; ++elemIdx) {
         auto& elemParams = thermalConductionLawParams_[elemIdx];
         elemParams.setThermalConductionApproach(EclThermalConductionApproach::Thconr);
         auto& thconrElemParams = elemParams.template getRealParams<EclThermalConductionApproach::Thconr>();
@@ -249,7 +252,8 @@ initThc_(const EclipseState& eclState, size_t numElems,
     const std::vector<double>& poroData = assignFieldPropsDoubleOnLeaf(fp, "PORO", numElems);
 
     thermalConductionLawParams_.resize(numElems);
-    for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
+    #pragma omp parallel for if (numElems > 1024)
+    for (std::size_t elemIdx = 0; elemIdx < numElems; ++elemIdx) {
         auto& elemParams = thermalConductionLawParams_[elemIdx];
         elemParams.setThermalConductionApproach(EclThermalConductionApproach::Thc);
         auto& thcElemParams = elemParams.template getRealParams<EclThermalConductionApproach::Thc>();
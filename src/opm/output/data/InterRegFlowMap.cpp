@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <exception>
 #include <iterator>
 #include <optional>
@@ -45,6 +46,40 @@ addConnection(const int        r1,
               const int        r2,
               const FlowRates& rates)
 {
+    this->addConnection(r1, r2, rates, 0);
+}
+
+void
+Opm::data::InterRegFlowMap::
+prepareConcurrentAccumulation(const std::size_t numThreads)
+{
+    if (numThreads == 0) {
+        throw std::invalid_argument {
+            "Number of contributing threads must be positive"
+        };
+    }
+
+    // Never shrink.  Would lose pending contributions.
+    if (numThreads > this->partials_.size()) {
+        this->partials_.resize(numThreads);
+    }
+}
+
+void
+Opm::data::InterRegFlowMap::
+addConnection(const int         r1,
+              const int         r2,
+              const FlowRates&  rates,
+              const std::size_t threadID)
+{
+    if (threadID >= this->partials_.size()) {
+        throw std::invalid_argument {
+            "Thread index " + std::to_string(threadID) +
+            " outside prepared range [0, " +
+            std::to_string(this->partials_.size()) + ')'
+        };
+    }
+
     if ((r1 < 0) || (r2 < 0)) {
         throw std::invalid_argument {
             "Region indices must be non-negative.  Got (r1,r2) = ("
@@ -58,23 +93,32 @@ addConnection(const int        r1,
         return;
     }
 
+    auto& partial = this->partials_[threadID];
+
     const auto one   = Window::ElmT{1};
     const auto sign  = (r1 < r2) ? one : -one;
-    const auto start = this->rates_.size();
+    const auto start = partial.rates.size();
 
     auto low = r1, high = r2;
     if (std::signbit(sign)) {
         std::swap(low, high);
     }
 
-    this->connections_.addConnection(low, high);
+    partial.low.push_back(low);
+    partial.high.push_back(high);
 
-    this->rates_.insert(this->rates_.end(), Window::bufferSize(), Window::ElmT{0});
-    Window { this->rates_.begin() + start, this->rates_.end() }.addFlow(sign, rates);
+    partial.rates.insert(partial.rates.end(), Window::bufferSize(), Window::ElmT{0});
+    Window { partial.rates.begin() + start, partial.rates.end() }.addFlow(sign, rates);
 }
 
 void Opm::data::InterRegFlowMap::compress(const std::size_t numRegions)
 {
+    if (this->reusePreviousStructure(numRegions)) {
+        return;
+    }
+
+    this->mergePartials();
+
     this->connections_.compress(numRegions);
 
     const auto v = this->rates_;
@@ -169,6 +213,115 @@ Opm::data::InterRegFlowMap::getInterRegFlows(const int r1, const int r2) const
 
 void Opm::data::InterRegFlowMap::clear()
 {
+    // Keep compressed structure as candidate for reuse, unless there are
+    // pending contributions from read().
+    if ((this->connections_.numVertices() > 0) &&
+        (this->rates_.size() == this->connections_.numEdges() * Window::bufferSize()))
+    {
+        std::swap(this->previous_, this->connections_);
+    }
+
     this->connections_.clear();
     this->rates_.clear();
+
+    for (auto& partial : this->partials_) {
+        partial.clear();
+    }
+}
+
+bool Opm::data::InterRegFlowMap::reusePreviousStructure(const std::size_t numRegions)
+{
+    // Applicable only to contributions from addConnection() since last
+    // call to clear().
+    if (! this->rates_.empty() ||
+        (this->connections_.numVertices() > 0) ||
+        (this->previous_.numVertices() != numRegions))
+    {
+        return false;
+    }
+
+    const auto& ia = this->previous_.startPointers();
+    const auto& ja = this->previous_.columnIndices();
+
+    constexpr auto sz = Window::bufferSize();
+
+    auto rates = RateBuffer(ja.size() * sz, Window::ElmT{0});
+    auto isAdded = std::vector<char>(ja.size(), 0);
+    auto edgeID = std::vector<Offset>{};
+
+    for (const auto& partial : this->partials_) {
+        const auto numConn = partial.low.size();
+
+        edgeID.resize(numConn);
+
+        // Locate connections in previous structure.
+        auto missing = false;
+#pragma omp parallel for reduction(||:missing) if (numConn > 4096)
+        for (auto conn = 0*numConn; conn < numConn; ++conn) {
+            const auto low = partial.low[conn];
+            if (static_cast<Offset>(low) >= numRegions) {
+                missing = true;
+                continue;
+            }
+
+            const auto begin = ja.begin() + ia[low + 0];
+            const auto end   = ja.begin() + ia[low + 1];
+            const auto pos   = std::lower_bound(begin, end, partial.high[conn]);
+            if ((pos == end) || (*pos != partial.high[conn])) {
+                missing = true;
+                continue;
+            }
+
+            edgeID[conn] = pos - ja.begin();
+        }
+
+        if (missing) {
+            return false;
+        }
+
+        // Accumulate in order of contribution, as in compress().
+        for (auto conn = 0*numConn; conn < numConn; ++conn) {
+            auto dst = rates.begin() + edgeID[conn]*sz;
+            auto src = partial.rates.begin() + conn*sz;
+
+            Window { dst, dst + sz } += ReadOnlyWindow { src, src + sz };
+
+            isAdded[edgeID[conn]] = 1;
+        }
+    }
+
+    if (std::find(isAdded.begin(), isAdded.end(), 0) != isAdded.end()) {
+        // Some connection of previous structure not present in this one.
+        return false;
+    }
+
+    std::swap(this->connections_, this->previous_);
+    this->rates_.swap(rates);
+
+    for (auto& partial : this->partials_) {
+        partial.clear();
+    }
+
+    return true;
+}
+
+void Opm::data::InterRegFlowMap::mergePartials()
+{
+    for (auto& partial : this->partials_) {
+        const auto numConn = partial.low.size();
+        for (auto conn = 0*numConn; conn < numConn; ++conn) {
+            this->connections_.addConnection(partial.low[conn], partial.high[conn]);
+        }
+
+        this->appendRates(partial.rates);
+
+        partial.clear();
+    }
+}
+
+void Opm::data::InterRegFlowMap::Contributions::clear()
+{
+    this->low.clear();
+    this->high.clear();
+    this->rates.clear();
 }
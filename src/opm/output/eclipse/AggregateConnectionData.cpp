@@ -19,6 +19,8 @@
 
 #include <opm/output/eclipse/AggregateConnectionData.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/output/eclipse/VectorItems/connection.hpp>
 #include <opm/output/eclipse/VectorItems/intehead.hpp>
 
@@ -87,14 +89,20 @@ namespace {
                             const Opm::data::Wells& xw,
                             ConnOp&&                connOp)
     {
-        for (const auto& wname : sched.wellNames(sim_step)) {
-            const auto  well_iter = xw.find(wname);
+        const auto& wells = sched.wellNames(sim_step);
+        const auto  nWells = wells.size();
+
+        // Each well fills its own row of the connection arrays, so wells
+        // may be processed concurrently.
+        Opm::parallelFor(0, nWells, 16, 1, [&](const std::size_t wellIx)
+        {
+            const auto  well_iter = xw.find(wells[wellIx]);
             const auto* wellRes   = (well_iter == xw.end())
                 ? nullptr : &well_iter->second;
 
-            connectionLoop(grid, sched.getWell(wname, sim_step),
-                           wellRes, std::forward<ConnOp>(connOp));
-        }
+            connectionLoop(grid, sched.getWell(wells[wellIx], sim_step),
+                           wellRes, connOp);
+        });
     }
 
     namespace IConn {
@@ -103,16 +111,25 @@ namespace {
             return inteHead[VI::intehead::NICONZ];
         }
 
+        void reset(Opm::RestartIO::Helpers::WindowedMatrix<int>& array,
+                   const std::vector<int>& inteHead)
+        {
+            using WM = Opm::RestartIO::Helpers::WindowedMatrix<int>;
+
+            array.reset(WM::NumRows   { numWells(inteHead) },
+                        WM::NumCols   { maxNumConn(inteHead) },
+                        WM::WindowSize{ entriesPerConn(inteHead) });
+        }
+
         Opm::RestartIO::Helpers::WindowedMatrix<int>
         allocate(const std::vector<int>& inteHead)
         {
             using WM = Opm::RestartIO::Helpers::WindowedMatrix<int>;
 
-            return WM {
-                WM::NumRows   { numWells(inteHead) },
-                WM::NumCols   { maxNumConn(inteHead) },
-                WM::WindowSize{ entriesPerConn(inteHead) }
-            };
+            auto array = WM { WM::NumRows{ 0 }, WM::NumCols{ 1 }, WM::WindowSize{ 1 } };
+            reset(array, inteHead);
+
+            return array;
         }
 
         template <class IConnArray>
@@ -155,16 +172,25 @@ namespace {
             return inteHead[VI::intehead::NSCONZ];
         }
 
+        void reset(Opm::RestartIO::Helpers::WindowedMatrix<float>& array,
+                   const std::vector<int>& inteHead)
+        {
+            using WM = Opm::RestartIO::Helpers::WindowedMatrix<float>;
+
+            array.reset(WM::NumRows   { numWells(inteHead) },
+                        WM::NumCols   { maxNumConn(inteHead) },
+                        WM::WindowSize{ entriesPerConn(inteHead) });
+        }
+
         Opm::RestartIO::Helpers::WindowedMatrix<float>
         allocate(const std::vector<int>& inteHead)
         {
             using WM = Opm::RestartIO::Helpers::WindowedMatrix<float>;
 
-            return WM {
-                WM::NumRows   { numWells(inteHead) },
-                WM::NumCols   { maxNumConn(inteHead) },
-                WM::WindowSize{ entriesPerConn(inteHead) }
-            };
+            auto array = WM { WM::NumRows{ 0 }, WM::NumCols{ 1 }, WM::WindowSize{ 1 } };
+            reset(array, inteHead);
+
+            return array;
         }
 
         template <class SConnArray>
@@ -229,16 +255,25 @@ namespace {
             return inteHead[VI::intehead::NXCONZ];
         }
 
+        void reset(Opm::RestartIO::Helpers::WindowedMatrix<double>& array,
+                   const std::vector<int>& inteHead)
+        {
+            using WM = Opm::RestartIO::Helpers::WindowedMatrix<double>;
+
+            array.reset(WM::NumRows   { numWells(inteHead) },
+                        WM::NumCols   { maxNumConn(inteHead) },
+                        WM::WindowSize{ entriesPerConn(inteHead) });
+        }
+
         Opm::RestartIO::Helpers::WindowedMatrix<double>
         allocate(const std::vector<int>& inteHead)
         {
             using WM = Opm::RestartIO::Helpers::WindowedMatrix<double>;
 
-            return WM {
-                WM::NumRows   { numWells(inteHead) },
-                WM::NumCols   { maxNumConn(inteHead) },
-                WM::WindowSize{ entriesPerConn(inteHead) }
-            };
+            auto array = WM { WM::NumRows{ 0 }, WM::NumCols{ 1 }, WM::WindowSize{ 1 } };
+            reset(array, inteHead);
+
+            return array;
         }
 
         template <class XConnArray>
@@ -310,6 +345,15 @@ AggregateConnectionData(const std::vector<int>& inteHead)
     , xConn_(XConn::allocate(inteHead))
 {}
 
+void
+Opm::RestartIO::Helpers::AggregateConnectionData::
+reset(const std::vector<int>& inteHead)
+{
+    IConn::reset(this->iConn_, inteHead);
+    SConn::reset(this->sConn_, inteHead);
+    XConn::reset(this->xConn_, inteHead);
+}
+
 // ---------------------------------------------------------------------
 
 void
@@ -19,6 +19,8 @@
 
 #include <opm/output/eclipse/AggregateMSWData.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/output/eclipse/InteHEAD.hpp>
 #include <opm/output/eclipse/VectorItems/msw.hpp>
 
@@ -392,14 +394,16 @@ namespace {
     void MSWLoop(const std::vector<const Opm::Well*>& wells,
                  MSWOp&&                              mswOp)
     {
-        auto mswID = std::size_t{0};
-        for (const auto* well : wells) {
-            mswID += 1;
-
-            if (well == nullptr) { continue; }
+        const auto numMSW = wells.size();
 
-            mswOp(*well, mswID - 1);
-        }
+        // Each multi-segment well fills its own windows of the segment
+        // arrays, so wells may be processed concurrently.
+        Opm::parallelFor(0, numMSW, 4, 1, [&](const std::size_t mswID)
+        {
+            if (wells[mswID] != nullptr) {
+                mswOp(*wells[mswID], mswID);
+            }
+        });
     }
 
     namespace ISeg {
@@ -410,15 +414,24 @@ namespace {
             return inteHead[176] * inteHead[178];
         }
 
+        void reset(Opm::RestartIO::Helpers::WindowedArray<int>& array,
+                   const std::vector<int>& inteHead)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
+
+            array.reset(WV::NumWindows{ nswlmx(inteHead) },
+                        WV::WindowSize{ entriesPerMSW(inteHead) });
+        }
+
         Opm::RestartIO::Helpers::WindowedArray<int>
         allocate(const std::vector<int>& inteHead)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
 
-            return WV {
-                WV::NumWindows{ nswlmx(inteHead) },
-                WV::WindowSize{ entriesPerMSW(inteHead) }
-            };
+            auto array = WV { WV::NumWindows{ 0 }, WV::WindowSize{ 1 } };
+            reset(array, inteHead);
+
+            return array;
         }
 
         template <class ISegArray>
@@ -530,15 +543,24 @@ namespace {
             return inteHead[176] * inteHead[179];
         }
 
+        void reset(Opm::RestartIO::Helpers::WindowedArray<double>& array,
+                   const std::vector<int>& inteHead)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<double>;
+
+            array.reset(WV::NumWindows{ nswlmx(inteHead) },
+                        WV::WindowSize{ entriesPerMSW(inteHead) });
+        }
+
         Opm::RestartIO::Helpers::WindowedArray<double>
         allocate(const std::vector<int>& inteHead)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<double>;
 
-            return WV {
-                WV::NumWindows{ nswlmx(inteHead) },
-                WV::WindowSize{ entriesPerMSW(inteHead) }
-            };
+            auto array = WV { WV::NumWindows{ 0 }, WV::WindowSize{ 1 } };
+            reset(array, inteHead);
+
+            return array;
         }
 
         float valveFlowUnitCoefficient(const Opm::UnitSystem::UnitType uType)
@@ -1244,15 +1266,24 @@ namespace {
             return inteHead[177];
         }
 
+        void reset(Opm::RestartIO::Helpers::WindowedArray<int>& array,
+                   const std::vector<int>& inteHead)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
+
+            array.reset(WV::NumWindows{ nswlmx(inteHead) },
+                        WV::WindowSize{ entriesPerMSW(inteHead) });
+        }
+
         Opm::RestartIO::Helpers::WindowedArray<int>
         allocate(const std::vector<int>& inteHead)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
 
-            return WV {
-                WV::NumWindows{ nswlmx(inteHead) },
-                WV::WindowSize{ entriesPerMSW(inteHead) }
-            };
+            auto array = WV { WV::NumWindows{ 0 }, WV::WindowSize{ 1 } };
+            reset(array, inteHead);
+
+            return array;
         }
     } // ILBS
 
@@ -1283,16 +1314,25 @@ namespace {
             return inteHead[177];
         }
 
+        void reset(Opm::RestartIO::Helpers::WindowedMatrix<int>& array,
+                   const std::vector<int>& inteHead)
+        {
+            using WM = Opm::RestartIO::Helpers::WindowedMatrix<int>;
+
+            array.reset(WM::NumRows   { nswlmx(inteHead) },
+                        WM::NumCols   { maxBranchesPerMSWell(inteHead) },
+                        WM::WindowSize{ nilbrz(inteHead) });
+        }
+
         Opm::RestartIO::Helpers::WindowedMatrix<int>
         allocate(const std::vector<int>& inteHead)
         {
             using WM = Opm::RestartIO::Helpers::WindowedMatrix<int>;
 
-            return WM {
-                WM::NumRows   { nswlmx(inteHead) },
-                WM::NumCols   { maxBranchesPerMSWell(inteHead) },
-                WM::WindowSize{ nilbrz(inteHead) }
-            };
+            auto array = WM { WM::NumRows{ 0 }, WM::NumCols{ 1 }, WM::WindowSize{ 1 } };
+            reset(array, inteHead);
+
+            return array;
         }
     } // ILBR
 
@@ -1308,6 +1348,16 @@ AggregateMSWData(const std::vector<int>& inteHead)
     , iLBR_ (ILBR::allocate(inteHead))
 {}
 
+void
+Opm::RestartIO::Helpers::AggregateMSWData::
+reset(const std::vector<int>& inteHead)
+{
+    ISeg::reset(this->iSeg_, inteHead);
+    RSeg::reset(this->rSeg_, inteHead);
+    ILBS::reset(this->iLBS_, inteHead);
+    ILBR::reset(this->iLBR_, inteHead);
+}
+
 // ---------------------------------------------------------------------
 
 void
@@ -20,6 +20,8 @@
 
 #include <opm/output/eclipse/AggregateWellData.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/output/eclipse/VectorItems/intehead.hpp>
 #include <opm/output/eclipse/VectorItems/well.hpp>
 
@@ -101,10 +103,35 @@ namespace {
                   const std::size_t               simStep,
                   WellOp&&                        wellOp)
     {
+        const auto nWells = wells.size();
+
+        // Each well fills its own window of the well arrays, so wells may
+        // be processed concurrently.
+        Opm::parallelFor(0, nWells, 16, 1, [&](const std::size_t wellIx)
+        {
+            const auto& well = sched.getWell(wells[wellIx], simStep);
+            wellOp(well, well.seqIndex());
+        });
+    }
+
+    /// Multi-segment well IDs (1-based, in order of well names) indexed by
+    /// the wells' insertion index.  Only meaningful for multi-segment wells.
+    std::vector<std::size_t>
+    multiSegmentWellIDs(const std::vector<std::string>& wells,
+                        const Opm::Schedule&            sched,
+                        const std::size_t               simStep,
+                        const std::size_t               numWellWindows)
+    {
+        auto msWellIDs = std::vector<std::size_t>(numWellWindows, 0);
+
+        auto msWellID = std::size_t{0};
         for (const auto& wname : wells) {
             const auto& well = sched.getWell(wname, simStep);
-            wellOp(well, well.seqIndex());
+            msWellID += well.isMultiSegment();
+            msWellIDs[well.seqIndex()] = msWellID;
         }
+
+        return msWellIDs;
     }
 
     namespace IWell {
@@ -113,15 +140,24 @@ namespace {
             return inteHead[VI::intehead::NIWELZ];
         }
 
+        void reset(Opm::RestartIO::Helpers::WindowedArray<int>& array,
+                   const std::vector<int>& inteHead)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
+
+            array.reset(WV::NumWindows{ numWells(inteHead) },
+                        WV::WindowSize{ entriesPerWell(inteHead) });
+        }
+
         Opm::RestartIO::Helpers::WindowedArray<int>
         allocate(const std::vector<int>& inteHead)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
 
-            return WV {
-                WV::NumWindows{ numWells(inteHead) },
-                WV::WindowSize{ entriesPerWell(inteHead) }
-            };
+            auto array = WV { WV::NumWindows{ 0 }, WV::WindowSize{ 1 } };
+            reset(array, inteHead);
+
+            return array;
         }
 
         std::map <const std::string, size_t>  currentGroupMapNameIndex(const Opm::Schedule& sched, const size_t simStep, const std::vector<int>& inteHead)
@@ -620,15 +656,24 @@ namespace {
                 : std::nullopt;
         }
 
+        void reset(Opm::RestartIO::Helpers::WindowedArray<float>& array,
+                   const std::vector<int>& inteHead)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<float>;
+
+            array.reset(WV::NumWindows{ numWells(inteHead) },
+                        WV::WindowSize{ entriesPerWell(inteHead) });
+        }
+
         Opm::RestartIO::Helpers::WindowedArray<float>
         allocate(const std::vector<int>& inteHead)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<float>;
 
-            return WV {
-                WV::NumWindows{ numWells(inteHead) },
-                WV::WindowSize{ entriesPerWell(inteHead) }
-            };
+            auto array = WV { WV::NumWindows{ 0 }, WV::WindowSize{ 1 } };
+            reset(array, inteHead);
+
+            return array;
         }
 
         std::vector<float> defaultSWell()
@@ -1110,15 +1155,24 @@ namespace {
             return inteHead[VI::intehead::NXWELZ];
         }
 
+        void reset(Opm::RestartIO::Helpers::WindowedArray<double>& array,
+                   const std::vector<int>& inteHead)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<double>;
+
+            array.reset(WV::NumWindows{ numWells(inteHead) },
+                        WV::WindowSize{ entriesPerWell(inteHead) });
+        }
+
         Opm::RestartIO::Helpers::WindowedArray<double>
         allocate(const std::vector<int>& inteHead)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<double>;
 
-            return WV {
-                WV::NumWindows{ numWells(inteHead) },
-                WV::WindowSize{ entriesPerWell(inteHead) }
-            };
+            auto array = WV { WV::NumWindows{ 0 }, WV::WindowSize{ 1 } };
+            reset(array, inteHead);
+
+            return array;
         }
 
         template <class XWellArray>
@@ -1409,6 +1463,19 @@ namespace {
             return inteHead[VI::intehead::NZWELZ];
         }
 
+        void reset(Opm::RestartIO::Helpers::WindowedArray<
+            Opm::EclIO::PaddedOutputString<8>
+        >& array,
+                   const std::vector<int>& inteHead)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<
+                Opm::EclIO::PaddedOutputString<8>
+            >;
+
+            array.reset(WV::NumWindows{ numWells(inteHead) },
+                        WV::WindowSize{ entriesPerWell(inteHead) });
+        }
+
         Opm::RestartIO::Helpers::WindowedArray<
             Opm::EclIO::PaddedOutputString<8>
         >
@@ -1418,10 +1485,10 @@ namespace {
                 Opm::EclIO::PaddedOutputString<8>
             >;
 
-            return WV {
-                WV::NumWindows{ numWells(inteHead) },
-                WV::WindowSize{ entriesPerWell(inteHead) }
-            };
+            auto array = WV { WV::NumWindows{ 0 }, WV::WindowSize{ 1 } };
+            reset(array, inteHead);
+
+            return array;
         }
 
         template <class ZWellArray>
@@ -1453,6 +1520,18 @@ AggregateWellData(const std::vector<int>& inteHead)
     , nWGMax_(maxNumGroups(inteHead))
 {}
 
+void
+Opm::RestartIO::Helpers::AggregateWellData::
+reset(const std::vector<int>& inteHead)
+{
+    IWell::reset(this->iWell_, inteHead);
+    SWell::reset(this->sWell_, inteHead);
+    XWell::reset(this->xWell_, inteHead);
+    ZWell::reset(this->zWell_, inteHead);
+
+    this->nWGMax_ = maxNumGroups(inteHead);
+}
+
 // ---------------------------------------------------------------------
 
 void
@@ -1472,12 +1551,16 @@ captureDeclaredWellData(const Schedule&             sched,
     {
         //const auto grpNames = groupNames(sched.getGroups());
         const auto groupMapNameIndex = IWell::currentGroupMapNameIndex(sched, sim_step, inteHead);
-        auto msWellID = std::size_t{0};
 
-        wellLoop(wells, sched, sim_step, [&groupMapNameIndex, &msWellID, &step_glo, &wtest_state, &smry, &sched, &sim_step, this]
+        // The MSW ID depends on the order of the wells, so compute it up
+        // front rather than while processing the wells in parallel.
+        const auto msWellIDs = multiSegmentWellIDs(wells, sched, sim_step,
+                                                   this->iWell_.numWindows());
+
+        wellLoop(wells, sched, sim_step, [&groupMapNameIndex, &msWellIDs, &step_glo, &wtest_state, &smry, &sched, &sim_step, this]
             (const Well& well, const std::size_t wellID) -> void
         {
-            msWellID += well.isMultiSegment();  // 1-based index.
+            const auto msWellID = msWellIDs[wellID];  // 1-based index.
             auto iw   = this->iWell_[wellID];
             const auto& wtest_config = sched[sim_step].wtest_config();
 
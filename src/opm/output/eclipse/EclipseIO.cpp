@@ -123,6 +123,7 @@ class EclipseIO::Impl {
         out::Summary summary;
         bool output_enabled;
         std::optional<RestartIO::Helpers::AggregateAquiferData> aquiferData{std::nullopt};
+        RestartIO::AggregateBuffers restartBuffers{};
 
 private:
     mutable bool sumthin_active_{false};
@@ -319,7 +320,8 @@ void EclipseIO::writeTimeStep(const Action::State& action_state,
 
         RestartIO::save(rstFile, report_step, secs_elapsed, value,
                         es, grid, schedule, action_state, wtest_state, st,
-                        udq_state, this->impl->aquiferData, write_double);
+                        udq_state, this->impl->aquiferData, write_double,
+                        &this->impl->restartBuffers);
     }
 
     // RFT file written only if requested and never for substeps.
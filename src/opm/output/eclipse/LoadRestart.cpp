@@ -580,6 +580,57 @@ namespace {
         return {};
     }
 
+    std::vector<double>
+    double_vector(const std::string&                 key,
+                  const std::vector<std::size_t>&    cells,
+                  const std::size_t                  numcells,
+                  const Opm::EclIO::RestartFileView& rst_view)
+    {
+        const auto isDouble = rst_view.hasKeyword<double>(key);
+        if (! isDouble && ! rst_view.hasKeyword<float>(key)) {
+            // Data unavailable.  Return empty.
+            return {};
+        }
+
+        if (rst_view.keywordSize(key) != numcells) {
+            throw std::runtime_error {
+                "Restart file: Could not restore '"
+                + key
+                + "', mismatched number of cells"
+            };
+        }
+
+        if (isDouble) {
+            return rst_view.getKeywordElements<double>(key, cells);
+        }
+
+        // Data exists as type REAL.  Convert to double.
+        const auto data = rst_view.getKeywordElements<float>(key, cells);
+
+        return { data.begin(), data.end() };
+    }
+
+    /// Active cells whose solution values to restore.  All active cells
+    /// if 'cells' is null, otherwise the listed subset in that order.
+    struct CellSelection
+    {
+        std::size_t numActive;
+        const std::vector<std::size_t>* cells;
+
+        std::size_t size() const
+        {
+            return (this->cells == nullptr) ? this->numActive : this->cells->size();
+        }
+
+        std::vector<double>
+        values(const std::string& key, const Opm::EclIO::RestartFileView& rst_view) const
+        {
+            return (this->cells == nullptr)
+                ? double_vector(key, rst_view)
+                : double_vector(key, *this->cells, this->numActive, rst_view);
+        }
+    };
+
     void insertSolutionVector(const std::vector<double>&           vector,
                               const Opm::RestartKey&               value,
                               const std::vector<double>::size_type numcells,
@@ -598,11 +649,11 @@ namespace {
     }
 
     void loadIfAvailable(const Opm::RestartKey&               value,
-                         const std::vector<double>::size_type numcells,
+                         const CellSelection&                 cells,
                          const Opm::EclIO::RestartFileView&   rst_view,
                          Opm::data::Solution&                 sol)
     {
-        const auto& kwdata = double_vector(value.key, rst_view);
+        const auto& kwdata = cells.values(value.key, rst_view);
 
         if (kwdata.empty()) {
             throwIfMissingRequired(value);
@@ -613,22 +664,22 @@ namespace {
             return;
         }
 
-        insertSolutionVector(kwdata, value, numcells, sol);
+        insertSolutionVector(kwdata, value, cells.size(), sol);
     }
 
     void loadHysteresisIfAvailable(const std::string&                   primary,
                                    const Opm::RestartKey&               fallback_key,
-                                   const std::vector<double>::size_type numcells,
+                                   const CellSelection&                 cells,
                                    const Opm::EclIO::RestartFileView&   rst_view,
                                    Opm::data::Solution&                 sol)
     {
-        auto kwdata = double_vector(primary, rst_view);
+        auto kwdata = cells.values(primary, rst_view);
 
         if (kwdata.empty()) {
             // Primary key does not exist in rst_view.  Attempt to load
             // fallback keys directly.
 
-            loadIfAvailable(fallback_key, numcells, rst_view, sol);
+            loadIfAvailable(fallback_key, cells, rst_view, sol);
         }
         else {
             // Primary exists in rst_view.  Translate to Flow's hysteresis
@@ -638,7 +689,7 @@ namespace {
             std::transform(std::begin(smax), std::end(smax), std::begin(smax),
                            [](const double s) { return 1.0 - s; });
 
-            insertSolutionVector(smax, fallback_key, numcells, sol);
+            insertSolutionVector(smax, fallback_key, cells.size(), sol);
         }
     }
 
@@ -654,7 +705,7 @@ namespace {
     }
 
     void restoreHysteresisVector(const Opm::RestartKey&             value,
-                                 const int                          numcells,
+                                 const CellSelection&               cells,
                                  const Opm::EclIO::RestartFileView& rst_view,
                                  Opm::data::Solution&               sol)
     {
@@ -664,14 +715,14 @@ namespace {
         {
             // Attempt to load from SOMAX, fall back to value.key if
             // unavailable--typically in OPM Extended restart file.
-            loadHysteresisIfAvailable("SOMAX", value, numcells,
+            loadHysteresisIfAvailable("SOMAX", value, cells,
                                       rst_view, sol);
         }
         else if ((key == "KRNSW_GO") || (key == "PCSWM_GO"))
         {
             // Attempt to load from SGMAX, fall back to value.key if
             // unavailable--typically in OPM Extended restart file.
-            loadHysteresisIfAvailable("SGMAX", value, numcells,
+            loadHysteresisIfAvailable("SGMAX", value, cells,
                                       rst_view, sol);
         }
     }
@@ -696,7 +747,7 @@ namespace {
 
     Opm::data::Solution
     restoreSOLUTION(const std::vector<Opm::RestartKey>& solution_keys,
-                    const int                           numcells,
+                    const CellSelection&                cells,
                     const Opm::EclIO::RestartFileView&  rst_view)
     {
         Opm::data::Solution sol(/* init_si = */ false);
@@ -706,12 +757,12 @@ namespace {
                 // Special case handling of hysteresis data.  Possibly needs
                 // translation from ECLIPSE-compatible set to Flow's known
                 // set of hysteresis vectors.
-                restoreHysteresisVector(value, numcells, rst_view, sol);
+                restoreHysteresisVector(value, cells, rst_view, sol);
                 continue;
             }
 
             // Load regular (non-hysteresis) vector if available.
-            loadIfAvailable(value, numcells, rst_view, sol);
+            loadIfAvailable(value, cells, rst_view, sol);
         }
 
         return sol;
@@ -1645,27 +1696,33 @@ namespace {
             }
         }
     }
-} // Anonymous namespace
-
-namespace Opm { namespace RestartIO  {
 
-    RestartValue
-    load(const std::string&             filename,
-         int                            report_step,
-         Action::State&                 /*  action_state  */,
-         SummaryState&                  summary_state,
-         const std::vector<RestartKey>& solution_keys,
-         const EclipseState&            es,
-         const EclipseGrid&             grid,
-         const Schedule&                schedule,
-         const std::vector<RestartKey>& extra_keys)
+    Opm::RestartValue
+    loadImpl(const std::string&                  filename,
+             const int                           report_step,
+             Opm::SummaryState&                  summary_state,
+             const std::vector<Opm::RestartKey>& solution_keys,
+             const Opm::EclipseState&            es,
+             const Opm::EclipseGrid&             grid,
+             const Opm::Schedule&                schedule,
+             const std::vector<Opm::RestartKey>& extra_keys,
+             const std::vector<std::size_t>*     active_cells)
     {
+        using namespace Opm;
+
+        // Load the arrays of the report step up front unless only parts of
+        // the solution arrays are requested.
+        const auto preload = active_cells == nullptr;
+
         auto rst_file = std::make_shared<Opm::EclIO::ERst>(filename);
         auto rst_view = std::make_shared<Opm::EclIO::RestartFileView>
-            (std::move(rst_file), report_step);
+            (std::move(rst_file), report_step, preload);
 
-        auto xr = restoreSOLUTION(solution_keys,
-                                  grid.getNumActive(), *rst_view);
+        const auto cells = CellSelection {
+            static_cast<std::size_t>(grid.getNumActive()), active_cells
+        };
+
+        auto xr = restoreSOLUTION(solution_keys, cells, *rst_view);
 
         xr.convertToSI(es.getUnits());
 
@@ -1691,5 +1748,39 @@ namespace Opm { namespace RestartIO  {
 
         return rst_value;
     }
+} // Anonymous namespace
+
+namespace Opm { namespace RestartIO  {
+
+    RestartValue
+    load(const std::string&             filename,
+         int                            report_step,
+         Action::State&                 /*  action_state  */,
+         SummaryState&                  summary_state,
+         const std::vector<RestartKey>& solution_keys,
+         const EclipseState&            es,
+         const EclipseGrid&             grid,
+         const Schedule&                schedule,
+         const std::vector<RestartKey>& extra_keys)
+    {
+        return loadImpl(filename, report_step, summary_state, solution_keys,
+                        es, grid, schedule, extra_keys, nullptr);
+    }
+
+    RestartValue
+    loadPartition(const std::string&              filename,
+                  int                             report_step,
+                  Action::State&                  /*  action_state  */,
+                  SummaryState&                   summary_state,
+                  const std::vector<RestartKey>&  solution_keys,
+                  const EclipseState&             es,
+                  const EclipseGrid&              grid,
+                  const Schedule&                 schedule,
+                  const std::vector<std::size_t>& active_cells,
+                  const std::vector<RestartKey>&  extra_keys)
+    {
+        return loadImpl(filename, report_step, summary_state, solution_keys,
+                        es, grid, schedule, extra_keys, &active_cells);
+    }
 
 }} // Opm::RestartIO
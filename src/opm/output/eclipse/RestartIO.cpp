@@ -24,6 +24,7 @@
 
 #include <opm/output/eclipse/RestartIO.hpp>
 
+#include <opm/common/utility/ScopedTimer.hpp>
 #include <opm/common/utility/Visitor.hpp>
 
 #include <opm/output/eclipse/AggregateAquiferData.hpp>
@@ -314,6 +315,20 @@ namespace {
         rstFile.write("ZNODE", networkData.getZNode());
     }
 
+    template <class Aggregate>
+    Aggregate& resetAggregate(std::optional<Aggregate>& aggregate,
+                              const std::vector<int>&   ih)
+    {
+        if (aggregate.has_value()) {
+            aggregate->reset(ih);
+        }
+        else {
+            aggregate.emplace(ih);
+        }
+
+        return *aggregate;
+    }
+
     void writeMSWData(int                           sim_step,
                       const UnitSystem&             units,
                       const Schedule&               schedule,
@@ -321,12 +336,13 @@ namespace {
                       const Opm::SummaryState&      sumState,
                       const Opm::data::Wells&       wells,
                       const std::vector<int>&       ih,
+                      AggregateBuffers&             buffers,
                       EclIO::OutputStream::Restart& rstFile)
     {
         // write ISEG, RSEG, ILBS and ILBR to restart file
         const auto simStep = static_cast<std::size_t> (sim_step);
 
-        auto  MSWData = Helpers::AggregateMSWData(ih);
+        auto& MSWData = resetAggregate(buffers.mswData, ih);
         MSWData.captureDeclaredMSWData(schedule, simStep, units,
                                        ih, grid, sumState, wells);
 
@@ -406,9 +422,10 @@ namespace {
                    const Opm::WellTestState&       wtest_state,
                    const Opm::SummaryState&        sumState,
                    const std::vector<int>&         ih,
+                   AggregateBuffers&               buffers,
                    EclIO::OutputStream::Restart&   rstFile)
     {
-        auto wellData = Helpers::AggregateWellData(ih);
+        auto& wellData = resetAggregate(buffers.wellData, ih);
         wellData.captureDeclaredWellData(schedule, tracers, sim_step, action_state, wtest_state, sumState, ih);
         wellData.captureDynamicWellData(schedule, tracers, sim_step, wells, sumState);
 
@@ -436,7 +453,7 @@ namespace {
             rstFile.write("OPM_XWEL", opm_xwel);
         }
 
-        auto connectionData = Helpers::AggregateConnectionData(ih);
+        auto& connectionData = resetAggregate(buffers.connectionData, ih);
         connectionData.captureDeclaredConnData(schedule, grid, schedule.getUnits(),
                                                wells, sumState, sim_step);
 
@@ -514,6 +531,7 @@ namespace {
                           const std::vector<int>&                       inteHD,
                           const data::Aquifers&                         aquDynData,
                           std::optional<Helpers::AggregateAquiferData>& aquiferData,
+                          AggregateBuffers&                             buffers,
                           EclIO::OutputStream::Restart&                 rstFile)
     {
         writeGroup(sim_step, schedule.getUnits(), schedule, sumState, inteHD, rstFile);
@@ -538,11 +556,12 @@ namespace {
 
             if (haveMSW) {
                 writeMSWData(sim_step, schedule.getUnits(), schedule, grid,
-                             sumState, wellSol, inteHD, rstFile);
+                             sumState, wellSol, inteHD, buffers, rstFile);
             }
 
             writeWell(sim_step, ecl_compatible_rst, phases, grid, schedule, es.tracer(),
-                      wells, wellSol, action_state, wtest_state, sumState, inteHD, rstFile);
+                      wells, wellSol, action_state, wtest_state, sumState, inteHD,
+                      buffers, rstFile);
         }
 
         if (const auto& aqCfg = es.aquifer();
@@ -851,8 +870,11 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
           const SummaryState&                           sumState,
           const UDQState&                               udqState,
           std::optional<Helpers::AggregateAquiferData>& aquiferData,
-          bool                                          write_double)
+          bool                                          write_double,
+          AggregateBuffers*                             buffers)
 {
+    Timing::Scope timer{"RestartIO::save"};
+
     ::Opm::RestartIO::checkSaveArguments(es, value, grid);
 
     const auto& ioCfg = es.getIOConfig();
@@ -873,9 +895,15 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
                     seconds_elapsed, schedule, grid, es, rstFile);
 
     if (report_step > 0) {
+        // Use caller's buffers, if any, to reuse the storage of the well,
+        // connection and segment arrays from previous report steps.
+        auto localBuffers = AggregateBuffers{};
+        auto& aggregates = (buffers != nullptr) ? *buffers : localBuffers;
+
         writeDynamicData(sim_step, ecl_compatible_rst, es.runspec().phases(),
                          grid, es, schedule, value.wells, action_state, wtest_state,
-                         sumState, inteHD, value.aquifer, aquiferData, rstFile);
+                         sumState, inteHD, value.aquifer, aquiferData, aggregates,
+                         rstFile);
     }
 
     writeActionx(report_step, sim_step, schedule, action_state, sumState, rstFile);
@@ -25,6 +25,8 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/OpmLog/KeywordLocation.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/common/utility/ParallelFor.hpp>
+#include <opm/common/utility/ScopedTimer.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/output/eclipse/Inplace.hpp>
@@ -81,6 +83,7 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <regex>
 #include <stdexcept>
 #include <string>
@@ -495,8 +498,8 @@ struct quantity {
 struct fn_args
 {
     const std::vector<const Opm::Well*>& schedule_wells;
-    const std::string group_name;
-    const std::string keyword_name;
+    const std::string& group_name;
+    const std::string& keyword_name;
     double duration;
     const int sim_step;
     int  num;
@@ -508,7 +511,7 @@ struct fn_args
     const Opm::out::RegionCache& regionCache;
     const Opm::EclipseGrid& grid;
     const Opm::Schedule& schedule;
-    const std::vector< std::pair< std::string, double > > eff_factors;
+    const std::vector< std::pair< std::string, double > >& eff_factors;
     const Opm::Inplace& initial_inplace;
     const Opm::Inplace& inplace;
     const Opm::UnitSystem& unit_system;
@@ -2949,7 +2952,8 @@ namespace Evaluator {
         const Opm::Schedule& sched;
         const Opm::EclipseGrid& grid;
         const Opm::out::RegionCache& reg;
-        const Opm::Inplace initial_inplace;
+        const Opm::Inplace& initial_inplace;
+        std::size_t structure_epoch;
     };
 
     struct SimulatorResults
@@ -2958,59 +2962,153 @@ namespace Evaluator {
         const Opm::data::WellBlockAveragePressures& wbp;
         const Opm::data::GroupAndNetworkValues& grpNwrkSol;
         const std::map<std::string, double>& single;
-        const Opm::Inplace inplace;
+        const Opm::Inplace& inplace;
         const std::map<std::string, std::vector<double>>& region;
         const std::map<std::pair<std::string, int>, double>& block;
         const Opm::data::Aquifers& aquifers;
         const std::unordered_map<std::string, Opm::data::InterRegFlowMap>& ireg;
     };
 
+    // Identity of the well and group objects in the Schedule at the most
+    // recently evaluated report step.  The epoch number changes only when
+    // that set of objects changes, e.g., when a new well or group is
+    // introduced or when a keyword such as WEFAC or GRUPTREE creates new
+    // objects.  Evaluators use the epoch to decide when their resolved
+    // wells and efficiency factors must be recomputed.
+    class ScheduleStructure
+    {
+    public:
+        std::size_t update(const Opm::Schedule& sched,
+                           const std::size_t    sim_step);
+
+    private:
+        // Owning references to the objects guarantee that a new object
+        // cannot reuse the address of an object in the previous set.
+        std::vector<std::shared_ptr<const void>> objects_{};
+        std::vector<const void*> current_{};
+        std::size_t epoch_{0};
+        bool valid_{false};
+    };
+
+    std::size_t ScheduleStructure::update(const Opm::Schedule& sched,
+                                          const std::size_t    sim_step)
+    {
+        if (sim_step >= sched.size()) {
+            // No Schedule state from which to resolve objects.  Force
+            // lookup in every evaluator.
+            this->objects_.clear();
+            this->valid_ = false;
+            return ++this->epoch_;
+        }
+
+        const auto& state = sched[sim_step];
+
+        this->current_.clear();
+        for (const auto& [_, well] : state.wells) {
+            (void)_;
+            this->current_.push_back(well.get());
+        }
+
+        for (const auto& [_, group] : state.groups) {
+            (void)_;
+            this->current_.push_back(group.get());
+        }
+
+        std::sort(this->current_.begin(), this->current_.end());
+
+        const auto unchanged =
+            std::equal(this->current_.begin(), this->current_.end(),
+                       this->objects_.begin(), this->objects_.end(),
+                       [](const void* p1, const std::shared_ptr<const void>& p2)
+                       { return p1 == p2.get(); });
+
+        if (this->valid_ && unchanged) {
+            return this->epoch_;
+        }
+
+        this->objects_.clear();
+        for (const auto& [_, well] : state.wells) {
+            (void)_;
+            this->objects_.push_back(well);
+        }
+
+        for (const auto& [_, group] : state.groups) {
+            (void)_;
+            this->objects_.push_back(group);
+        }
+
+        std::sort(this->objects_.begin(), this->objects_.end(),
+                  [](const auto& p1, const auto& p2)
+                  { return p1.get() < p2.get(); });
+
+        this->valid_ = true;
+        return ++this->epoch_;
+    }
+
     class Base
     {
     public:
         virtual ~Base() {}
 
-        virtual void update(const std::size_t       sim_step,
-                            const double            stepSize,
-                            const InputData&        input,
-                            const SimulatorResults& simRes,
-                            Opm::SummaryState&      st) const = 0;
+        // Compute parameter value, in output units, from simulator
+        // results.  Nullopt if the value is not available, for instance
+        // because the entity is not yet active.  Must not modify any state
+        // shared with other evaluators since the values of different
+        // parameters may be computed concurrently.
+        virtual std::optional<double>
+        value(const std::size_t        sim_step,
+              const double             stepSize,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& st) const = 0;
+
+        // Store previously computed parameter value in summary state.
+        virtual void store(const double value, Opm::SummaryState& st) const = 0;
+
+        void update(const std::size_t       sim_step,
+                    const double            stepSize,
+                    const InputData&        input,
+                    const SimulatorResults& simRes,
+                    Opm::SummaryState&      st) const
+        {
+            const auto prm = this->value(sim_step, stepSize, input, simRes, st);
+            if (prm.has_value()) {
+                this->store(*prm, st);
+            }
+        }
     };
 
     class FunctionRelation : public Base
     {
     public:
         explicit FunctionRelation(Opm::EclIO::SummaryNode node, ofun fcn)
-            : node_(std::move(node))
-            , fcn_ (std::move(fcn))
+            : node_      (std::move(node))
+            , fcn_       (std::move(fcn))
+            , need_wells_(need_wells(this->node_))
+            , group_name_(this->make_group_name())
         {
             if (this->use_number()) {
                 this->number_ = std::max(0, this->node_.number);
             }
         }
 
-        void update(const std::size_t       sim_step,
-                    const double            stepSize,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t        sim_step,
+              const double             stepSize,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& st) const override
         {
-            const auto wells = need_wells(this->node_)
-                ? find_wells(input.sched, this->node_,
-                             static_cast<int>(sim_step), input.reg)
-                : std::vector<const Opm::Well*>{};
-
-            EfficiencyFactor efac{};
-            efac.setFactors(this->node_, input.sched, wells, sim_step);
+            this->resolveScheduleObjects(sim_step, input);
 
             const fn_args args {
-                wells, this->group_name(), this->node_.keyword,
+                this->wells_, this->group_name_, this->node_.keyword,
                 stepSize, static_cast<int>(sim_step),
                 this->number_, this->node_.fip_region,
                 st,
                 simRes.wellSol, simRes.wbp, simRes.grpNwrkSol,
                 input.reg, input.grid, input.sched,
-                std::move(efac.factors),
+                this->efac_.factors,
                 input.initial_inplace, simRes.inplace,
                 input.sched.getUnits()
             };
@@ -3018,15 +3116,50 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            return usys.from_si(prm.unit, prm.value);
+        }
+
+        void store(const double value, Opm::SummaryState& st) const override
+        {
+            updateValue(this->node_, value, st);
         }
 
     private:
         Opm::EclIO::SummaryNode node_;
         ofun                    fcn_;
+        bool                    need_wells_{false};
+        std::string             group_name_{};
         int                     number_{0};
 
-        std::string group_name() const
+        // Schedule objects resolved for structure epoch 'epoch_'.  These
+        // remain valid for as long as the set of well and group objects in
+        // the Schedule does not change, so we only need to look them up
+        // again when the epoch changes.
+        mutable std::optional<std::size_t>    epoch_{};
+        mutable std::vector<const Opm::Well*> wells_{};
+        mutable EfficiencyFactor              efac_{};
+
+        void resolveScheduleObjects(const std::size_t sim_step,
+                                    const InputData&  input) const
+        {
+            if (this->epoch_.has_value() &&
+                (*this->epoch_ == input.structure_epoch))
+            {
+                return;
+            }
+
+            this->wells_ = this->need_wells_
+                ? find_wells(input.sched, this->node_,
+                             static_cast<int>(sim_step), input.reg)
+                : std::vector<const Opm::Well*>{};
+
+            this->efac_.setFactors(this->node_, input.sched,
+                                   this->wells_, sim_step);
+
+            this->epoch_ = input.structure_epoch;
+        }
+
+        std::string make_group_name() const
         {
             using Cat = ::Opm::EclIO::SummaryNode::Category;
 
@@ -3060,19 +3193,25 @@ namespace Evaluator {
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double             /* stepSize */,
+              const InputData&            input,
+              const SimulatorResults&     simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.block.find(this->lookupKey());
             if (xPos == simRes.block.end()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second), st);
+            return usys.from_si(this->m_, xPos->second);
+        }
+
+        void store(const double value, Opm::SummaryState& st) const override
+        {
+            updateValue(this->node_, value, st);
         }
 
     private:
@@ -3094,19 +3233,25 @@ namespace Evaluator {
         , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double             /* stepSize */,
+              const InputData&            input,
+              const SimulatorResults&     simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.aquifers.find(this->node_.number);
             if (xPos == simRes.aquifers.end()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)), st);
+            return usys.from_si(this->m_, xPos->second.get(this->node_.keyword));
+        }
+
+        void store(const double value, Opm::SummaryState& st) const override
+        {
+            updateValue(this->node_, value, st);
         }
     private:
         Opm::EclIO::SummaryNode  node_;
@@ -3122,27 +3267,33 @@ namespace Evaluator {
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double             /* stepSize */,
+              const InputData&            input,
+              const SimulatorResults&     simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             if (this->node_.number < 0)
-                return;
+                return std::nullopt;
 
             auto xPos = simRes.region.find(this->node_.keyword);
             if (xPos == simRes.region.end())
-                return;
+                return std::nullopt;
 
             const auto ix = this->index();
             if (ix >= xPos->second.size())
-                return;
+                return std::nullopt;
 
             const auto  val  = xPos->second[ix];
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
+        }
+
+        void store(const double value, Opm::SummaryState& st) const override
+        {
+            updateValue(this->node_, value, st);
         }
 
     private:
@@ -3169,30 +3320,36 @@ namespace Evaluator {
             this->analyzeKeyword();
         }
 
-        void update(const std::size_t    /* sim_step */,
-                    const double            stepSize,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double                stepSize,
+              const InputData&            input,
+              const SimulatorResults&     simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             if (this->component_ == Component::NumComponents) {
-                return;
+                return std::nullopt;
             }
 
             auto flows = simRes.ireg.find(this->regname_);
             if (flows == simRes.ireg.end()) {
-                return;
+                return std::nullopt;
             }
 
             auto flow = flows->second.getInterRegFlows(this->r1_, this->r2_);
             if (! flow.has_value()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
             const auto  val  = this->getValue(flow->first, flow->second, stepSize);
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
+        }
+
+        void store(const double value, Opm::SummaryState& st) const override
+        {
+            updateValue(this->node_, value, st);
         }
 
     private:
@@ -3357,20 +3514,26 @@ namespace Evaluator {
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double             /* stepSize */,
+              const InputData&            input,
+              const SimulatorResults&     simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.single.find(this->node_.keyword);
             if (xPos == simRes.single.end())
-                return;
+                return std::nullopt;
 
             const auto  val  = xPos->second;
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
+        }
+
+        void store(const double value, Opm::SummaryState& st) const override
+        {
+            updateValue(this->node_, value, st);
         }
 
     private:
@@ -3381,14 +3544,19 @@ namespace Evaluator {
     class UserDefinedValue : public Base
     {
     public:
-        void update(const std::size_t       /* sim_step */,
-                    const double            /* stepSize */,
-                    const InputData&        /* input */,
-                    const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&      /* st */) const override
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double             /* stepSize */,
+              const InputData&         /* input */,
+              const SimulatorResults&  /* simRes */,
+              const Opm::SummaryState& /* st */) const override
         {
             // No-op
+            return std::nullopt;
         }
+
+        void store(const double /* value */, Opm::SummaryState& /* st */) const override
+        {}
     };
 
     class Time : public Base
@@ -3398,19 +3566,25 @@ namespace Evaluator {
             : saveKey_(std::move(saveKey))
         {}
 
-        void update(const std::size_t       /* sim_step */,
-                    const double               stepSize,
-                    const InputData&           input,
-                    const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double                stepSize,
+              const InputData&            input,
+              const SimulatorResults&  /* simRes */,
+              const Opm::SummaryState&    st) const override
         {
             const auto& usys = input.es.getUnits();
 
             const auto m   = ::Opm::UnitSystem::measure::time;
             const auto val = st.get_elapsed() + stepSize;
 
-            st.update(this->saveKey_, usys.from_si(m, val));
-            st.update("TIME", usys.from_si(m, val));
+            return usys.from_si(m, val);
+        }
+
+        void store(const double value, Opm::SummaryState& st) const override
+        {
+            st.update(this->saveKey_, value);
+            st.update("TIME", value);
         }
 
     private:
@@ -3424,14 +3598,20 @@ namespace Evaluator {
             : saveKey_(std::move(saveKey))
         {}
 
-        void update(const std::size_t       /* sim_step */,
-                    const double               stepSize,
-                    const InputData&           input,
-                    const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double                stepSize,
+              const InputData&            input,
+              const SimulatorResults&  /* simRes */,
+              const Opm::SummaryState&    st) const override
         {
             auto sim_time = make_sim_time(input.sched, st, stepSize);
-            st.update(this->saveKey_, sim_time.day());
+            return sim_time.day();
+        }
+
+        void store(const double value, Opm::SummaryState& st) const override
+        {
+            st.update(this->saveKey_, value);
         }
 
     private:
@@ -3445,14 +3625,20 @@ namespace Evaluator {
             : saveKey_(std::move(saveKey))
         {}
 
-        void update(const std::size_t       /* sim_step */,
-                    const double               stepSize,
-                    const InputData&           input,
-                    const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double                stepSize,
+              const InputData&            input,
+              const SimulatorResults&  /* simRes */,
+              const Opm::SummaryState&    st) const override
         {
             auto sim_time = make_sim_time(input.sched, st, stepSize);
-            st.update(this->saveKey_, sim_time.month());
+            return sim_time.month();
+        }
+
+        void store(const double value, Opm::SummaryState& st) const override
+        {
+            st.update(this->saveKey_, value);
         }
 
     private:
@@ -3466,14 +3652,20 @@ namespace Evaluator {
             : saveKey_(std::move(saveKey))
         {}
 
-        void update(const std::size_t       /* sim_step */,
-                    const double               stepSize,
-                    const InputData&           input,
-                    const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double                stepSize,
+              const InputData&            input,
+              const SimulatorResults&  /* simRes */,
+              const Opm::SummaryState&    st) const override
         {
             auto sim_time = make_sim_time(input.sched, st, stepSize);
-            st.update(this->saveKey_, sim_time.year());
+            return sim_time.year();
+        }
+
+        void store(const double value, Opm::SummaryState& st) const override
+        {
+            st.update(this->saveKey_, value);
         }
 
     private:
@@ -3487,17 +3679,23 @@ namespace Evaluator {
             : saveKey_(std::move(saveKey))
         {}
 
-        void update(const std::size_t       /* sim_step */,
-                    const double               stepSize,
-                    const InputData&        /* input */,
-                    const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double                stepSize,
+              const InputData&         /* input */,
+              const SimulatorResults&  /* simRes */,
+              const Opm::SummaryState&    st) const override
         {
             using namespace ::Opm::unit;
 
             const auto val = st.get_elapsed() + stepSize;
 
-            st.update(this->saveKey_, convert::to(val, ecl_year));
+            return convert::to(val, ecl_year);
+        }
+
+        void store(const double value, Opm::SummaryState& st) const override
+        {
+            st.update(this->saveKey_, value);
         }
 
     private:
@@ -3913,6 +4111,20 @@ std::string makeWGName(std::string name)
     return use_dflt ? std::string(":+:+:+:+") : std::move(name);
 }
 
+// Evaluation group of a configured summary parameter.  Parameters are
+// evaluated one group at a time so that evaluators of the same category,
+// which read the same parts of the simulator results, run back to back.
+// Parameters which read other summary vectors from the SummaryState must
+// be evaluated after those vectors and are therefore put in the last group.
+int evaluationGroup(const Opm::SummaryConfigNode& node)
+{
+    if (node.keyword().rfind("ROEW", 0) == 0) {
+        return 1 + static_cast<int>(Opm::SummaryConfigNode::Category::Miscellaneous);
+    }
+
+    return static_cast<int>(node.category());
+}
+
 class SummaryOutputParameters
 {
 public:
@@ -3936,11 +4148,13 @@ public:
                        std::string name,
                        const int   num,
                        std::string unit,
-                       EvalPtr     evaluator)
+                       EvalPtr     evaluator,
+                       const int   evalGroup = 0)
     {
         this->smspec_.add(std::move(keyword), std::move(name),
                           std::max (num, 0), std::move(unit));
 
+        this->evalOrder_.emplace_back(evalGroup, evaluator.get());
         this->evaluators_.push_back(std::move(evaluator));
     }
 
@@ -3954,9 +4168,25 @@ public:
         return this->evaluators_;
     }
 
+    // Evaluators sorted by evaluation group.  Order within a group is the
+    // order in which the parameters were created.
+    const std::vector<std::pair<int, const Evaluator::Base*>>&
+    evaluationOrder() const
+    {
+        return this->evalOrder_;
+    }
+
+    void sortEvaluationOrder()
+    {
+        std::stable_sort(this->evalOrder_.begin(), this->evalOrder_.end(),
+                         [](const auto& e1, const auto& e2)
+                         { return e1.first < e2.first; });
+    }
+
 private:
     SMSpecPrm smspec_{};
     std::vector<EvalPtr> evaluators_{};
+    std::vector<std::pair<int, const Evaluator::Base*>> evalOrder_{};
 };
 
 class SMSpecStreamDeferredCreation
@@ -4135,6 +4365,8 @@ private:
 
     mutable int miniStepID_{0};
     mutable double prevEvalTime_{std::numeric_limits<double>::lowest()};
+    mutable Evaluator::ScheduleStructure structure_{};
+    mutable std::vector<std::optional<double>> values_{};
 
     int prevCreate_{-1};
     int prevReportStepID_{-1};
@@ -4167,6 +4399,20 @@ private:
     MiniStep& getNextMiniStep(const int report_step, bool isSubstep);
     const MiniStep& lastUnwritten() const;
 
+    void evaluateOutputParameters(const int                          sim_step,
+                                  const double                       duration,
+                                  const Evaluator::InputData&        input,
+                                  const Evaluator::SimulatorResults& simRes,
+                                  SummaryState&                      st) const;
+
+    void computeValues(const std::size_t                  begin,
+                       const std::size_t                  end,
+                       const int                          sim_step,
+                       const double                       duration,
+                       const Evaluator::InputData&        input,
+                       const Evaluator::SimulatorResults& simRes,
+                       const SummaryState&                st) const;
+
     void write(const MiniStep& ms);
 
     void createSMSpecIfNecessary();
@@ -4203,6 +4449,9 @@ SummaryImplementation(const EclipseState&  es,
                                              sched, evaluatorFactory);
     this->configureUDQ(es, sumcfg, sched);
 
+    this->outputParameters_.sortEvaluationOrder();
+    this->values_.resize(this->outputParameters_.evaluationOrder().size());
+
     std::string esmryFileName = EclIO::OutputStream::outputFileName(this->rset_, "ESMRY");
 
     if (std::filesystem::exists(esmryFileName))
@@ -4254,8 +4503,15 @@ eval(const int                              sim_step,
     single_values["TIMESTEP"] = duration;
     st.update("TIMESTEP", this->es_.get().getUnits().from_si(Opm::UnitSystem::measure::time, duration));
 
+    // The parameter values are computed concurrently below, and the
+    // evaluators must then only read the Schedule.  Updating the schedule
+    // structure accesses the report step 'sim_step', which also loads that
+    // step if the Schedule is loaded lazily, before any evaluator runs.
+    const auto structure_epoch = this->structure_.update(this->sched_, sim_step);
+
     const Evaluator::InputData input {
-        this->es_, this->sched_, this->grid_, this->regCache_, initial_inplace
+        this->es_, this->sched_, this->grid_, this->regCache_, initial_inplace,
+        structure_epoch
     };
 
     const Evaluator::SimulatorResults simRes {
@@ -4263,9 +4519,7 @@ eval(const int                              sim_step,
         region_values, block_values, aquifer_values, interreg_flows
     };
 
-    for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
-    }
+    this->evaluateOutputParameters(sim_step, duration, input, simRes, st);
 
     for (auto& [_, evalPtr] : this->extra_parameters) {
         (void)_;
@@ -4280,6 +4534,61 @@ eval(const int                              sim_step,
     }
 }
 
+void
+Opm::out::Summary::SummaryImplementation::
+evaluateOutputParameters(const int                          sim_step,
+                         const double                       duration,
+                         const Evaluator::InputData&        input,
+                         const Evaluator::SimulatorResults& simRes,
+                         SummaryState&                      st) const
+{
+    // Parameters in one evaluation group are independent of each other.
+    // Compute all of a group's values, possibly concurrently, and then
+    // store them in the summary state in a fixed order before moving on to
+    // the next group.  The results are thus independent of the number of
+    // threads.
+
+    const auto& order = this->outputParameters_.evaluationOrder();
+
+    auto begin = std::size_t{0};
+    while (begin < order.size()) {
+        auto end = begin + 1;
+        while ((end < order.size()) && (order[end].first == order[begin].first)) {
+            ++end;
+        }
+
+        this->computeValues(begin, end, sim_step, duration, input, simRes, st);
+
+        for (auto i = begin; i < end; ++i) {
+            if (this->values_[i].has_value()) {
+                order[i].second->store(*this->values_[i], st);
+            }
+        }
+
+        begin = end;
+    }
+}
+
+void
+Opm::out::Summary::SummaryImplementation::
+computeValues(const std::size_t                  begin,
+              const std::size_t                  end,
+              const int                          sim_step,
+              const double                       duration,
+              const Evaluator::InputData&        input,
+              const Evaluator::SimulatorResults& simRes,
+              const SummaryState&                st) const
+{
+    const auto& order = this->outputParameters_.evaluationOrder();
+
+    parallelFor(begin, end, 256, 64, [&](const std::size_t i)
+    {
+        // Don't leave a stale value behind if the evaluation throws.
+        this->values_[i].reset();
+        this->values_[i] = order[i].second->value(sim_step, duration, input, simRes, st);
+    });
+}
+
 void Opm::out::Summary::SummaryImplementation::write(const bool is_final_summary)
 {
     const auto zero = std::vector<MiniStep>::size_type{0};
@@ -4423,7 +4732,8 @@ configureSummaryInput(const SummaryConfig& sumcfg,
                            makeWGName(node.namedEntity()),
                            node.number(),
                            std::move(prmDescr.unit),
-                           std::move(prmDescr.evaluator));
+                           std::move(prmDescr.evaluator),
+                           evaluationGroup(node));
     }
 
     if (! unsuppkw.empty())
@@ -4734,6 +5044,8 @@ void Summary::eval(SummaryState&                          st,
                    const Opm::data::Aquifers&             aquifer_values,
                    const InterRegFlowValues&              interreg_flows) const
 {
+    Timing::Scope timer{"Summary::eval"};
+
     // Report_step is the one-based sequence number of the containing report.
     // Report_step = 0 for the initial condition, before simulation starts.
     // We typically don't get reports_step = 0 here.  When outputting
@@ -4762,6 +5074,7 @@ void Summary::add_timestep(const SummaryState& st, const int report_step, bool i
 
 void Summary::write(const bool is_final_summary) const
 {
+    Timing::Scope timer{"Summary::write"};
     this->pImpl_->write(is_final_summary);
 }
 
@@ -0,0 +1,57 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc checkTabulated
+ */
+#ifndef OPM_CHECK_TABULATED_HPP
+#define OPM_CHECK_TABULATED_HPP
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+/*!
+ * \brief Compares a tabulated function of temperature and pressure and its
+ *        derivatives with the exact function at a point.
+ *
+ * The derivatives are compared relative to the sensitivity value/x of the function to
+ * the temperature and the pressure, as they may vanish at some points.
+ */
+template <class Evaluation>
+void checkTabulated(const Evaluation& tabulated, const Evaluation& exact,
+                    const std::array<double, 2>& point,
+                    double valueTol, double derivTol)
+{
+    BOOST_CHECK_CLOSE(tabulated.value(), exact.value(), valueTol);
+    for (int varIdx = 0; varIdx < Evaluation::numVars; ++varIdx) {
+        const double scale = std::max({std::abs(exact.derivative(varIdx)),
+                                       std::abs(exact.value())/point[varIdx],
+                                       1e-12});
+        BOOST_CHECK_SMALL((tabulated.derivative(varIdx) - exact.derivative(varIdx))/scale, derivTol);
+    }
+}
+
+#endif
@@ -335,6 +335,69 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedFunction2, Scalar, Types)
                                     1e-2);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedFunctionStorage, Scalar, Types)
+{
+    using Table = Opm::UniformXTabulated2DFunction<Scalar>;
+
+    Test<Scalar> test;
+    auto tab1 = test.createUniformXTabulatedFunction2(test.testFn1);
+    auto tab3 = test.createUniformXTabulatedFunction2(test.testFn3);
+
+    // Round trip through the nested sample point representation.
+    const Table copy(tab3.xPos(), tab3.yPos(), tab3.samples(), tab3.interpolationGuide());
+    BOOST_CHECK(copy == tab3);
+    BOOST_CHECK(!(tab1 == tab3));
+
+    BOOST_CHECK(tab1.hasSameSampling(tab3));
+    BOOST_CHECK(!tab1.hasSameSampling(test.createUniformXTabulatedFunction(test.testFn1)));
+
+    const Scalar tolerance = std::is_same_v<Scalar, float> ? 1e-5 : 1e-12;
+    for (Scalar x = -2.0; x <= 3.0; x += 0.37) {
+        for (Scalar y = -4.0; y <= 5.0; y += 0.41) {
+            const auto [v1, v3] = tab1.evalWith(tab3, x, y);
+            BOOST_CHECK_SMALL(v1 - tab1.eval(x, y), tolerance);
+            BOOST_CHECK_SMALL(v3 - tab3.eval(x, y), tolerance);
+        }
+    }
+
+    // Out of order insertion into an inner column must keep the other
+    // columns intact.
+    Table tab(Table::InterpolationPolicy::Vertical);
+    tab.appendXPos(1.0);
+    tab.appendXPos(2.0);
+    tab.appendSamplePoint(1, 0.5, 10.0);
+    tab.appendSamplePoint(1, 1.5, 11.0);
+    tab.appendSamplePoint(0, 1.0, 1.0);
+    tab.appendSamplePoint(0, 0.0, 0.0);
+    tab.appendXPos(0.0);
+    tab.appendSamplePoint(0, 0.0, -1.0);
+
+    BOOST_CHECK_EQUAL(tab.numX(), 3u);
+    BOOST_CHECK_EQUAL(tab.numY(0), 1u);
+    BOOST_CHECK_EQUAL(tab.numY(1), 2u);
+    BOOST_CHECK_EQUAL(tab.numY(2), 2u);
+    BOOST_CHECK_EQUAL(tab.valueAt(1, 0), Scalar(0.0));
+    BOOST_CHECK_EQUAL(tab.valueAt(1, 1), Scalar(1.0));
+    BOOST_CHECK_EQUAL(tab.yAt(2, 1), Scalar(1.5));
+    BOOST_CHECK_EQUAL(tab.valueAt(2, 0), Scalar(10.0));
+    BOOST_CHECK_EQUAL(tab.valueAt(0, 0), Scalar(-1.0));
+
+    // The sample points and the contiguous storage must agree.
+    const auto flat = tab.flatSamples();
+    BOOST_REQUIRE_EQUAL(flat.columnStart.size(), tab.numX() + 1);
+    BOOST_CHECK_EQUAL(flat.y.size(), 5u);
+    BOOST_CHECK_EQUAL(flat.value.size(), 5u);
+    for (std::size_t i = 0; i < tab.numX(); ++i) {
+        const auto& column = tab.samples()[i];
+        BOOST_REQUIRE_EQUAL(column.size(), flat.columnStart[i + 1] - flat.columnStart[i]);
+        for (std::size_t j = 0; j < column.size(); ++j) {
+            BOOST_CHECK_EQUAL(std::get<0>(column[j]), tab.xAt(i));
+            BOOST_CHECK_EQUAL(std::get<1>(column[j]), flat.y[flat.columnStart[i] + j]);
+            BOOST_CHECK_EQUAL(std::get<2>(column[j]), flat.value[flat.columnStart[i] + j]);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(IntervalTabulatedFunction1, Scalar, Types)
 {
     Test<Scalar> test;
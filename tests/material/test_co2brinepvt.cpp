@@ -39,7 +39,7 @@
 #endif
 
 //#include <opm/material/fluidsystems/blackoilpvt/Co2GasPvt.hpp>
-//#include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
 
 #include <opm/material/fluidsystems/blackoilpvt/GasPvtMultiplexer.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp>
@@ -55,6 +55,9 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 
 #include <iostream>
+#include <stdexcept>
+
+#include "checkTabulated.hpp"
 
 // values of strings based on the first SPE1 test case of opm-data.  note that in the
 // real world it does not make much sense to specify a fluid phase using more than a
@@ -282,3 +285,58 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Water, Scalar, Types)
     ensurePvtApiGas<Scalar>(co2Pvt);
     ensurePvtApiBrine<Eval>(brinePvt);
 }
+
+BOOST_AUTO_TEST_CASE(Tabulation)
+{
+    using Eval = Opm::DenseAd::Evaluation<double, 2>;
+
+    for (const bool saltConcentration : {false, true}) {
+        Opm::BrineCo2Pvt<double> exactPvt({0.1, 0.05});
+        exactPvt.setEnableSaltConcentration(saltConcentration);
+        Opm::BrineCo2Pvt<double> tabulatedPvt = exactPvt;
+        const Opm::BrineGasTabulationParams<double> params;
+        tabulatedPvt.setTabulation(params);
+
+        BOOST_CHECK(tabulatedPvt.tables().active());
+        BOOST_CHECK_LE(tabulatedPvt.tables().moleFractionError(), params.moleFractionTolerance);
+        BOOST_CHECK_LE(tabulatedPvt.tables().densityError(), params.densityTolerance);
+
+        for (const unsigned regionIdx : {0u, 1u}) {
+            for (const double T : {293.0, 318.7, 352.3, 401.1}) {
+                for (const double p : {2.3e6, 9.8e6, 2.71e7, 5.5e7}) {
+                    const Eval temperature = Eval::createVariable(T, 0);
+                    const Eval pressure = Eval::createVariable(p, 1);
+                    const Eval saltConc = saltConcentration ? Eval(70.0 + 30.0*regionIdx) : Eval(0.0);
+
+                    const Eval rsExact =
+                        exactPvt.saturatedGasDissolutionFactor(regionIdx, temperature, pressure, saltConc);
+                    const Eval rsTab =
+                        tabulatedPvt.saturatedGasDissolutionFactor(regionIdx, temperature, pressure, saltConc);
+                    checkTabulated(rsTab, rsExact, {T, p}, 0.1, 1e-2);
+
+                    const Eval bExact =
+                        exactPvt.saturatedInverseFormationVolumeFactor(regionIdx, temperature, pressure, saltConc);
+                    const Eval bTab =
+                        tabulatedPvt.saturatedInverseFormationVolumeFactor(regionIdx, temperature, pressure, saltConc);
+                    checkTabulated(bTab, bExact, {T, p}, 1e-3, 1e-2);
+                }
+            }
+        }
+
+        // outside of the tabulated range the correlations are used
+        const Eval temperature = Eval::createVariable(500.0, 0);
+        const Eval pressure = Eval::createVariable(1e7, 1);
+        BOOST_CHECK_EQUAL(tabulatedPvt.saturatedGasDissolutionFactor(0, temperature, pressure),
+                          exactPvt.saturatedGasDissolutionFactor(0, temperature, pressure));
+    }
+
+    // a tolerance which cannot be reached is reported and leaves the correlations in use
+    {
+        Opm::BrineCo2Pvt<double> pvt({0.1});
+        Opm::BrineGasTabulationParams<double> params;
+        params.densityTolerance = 1e-12;
+        params.maxRefinements = 0;
+        BOOST_CHECK_THROW(pvt.setTabulation(params), std::runtime_error);
+        BOOST_CHECK(!pvt.tables().active());
+    }
+}
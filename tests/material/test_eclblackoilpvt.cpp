@@ -58,6 +58,11 @@
 #include <opm/input/eclipse/Python/Python.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
 // values of strings based on the first SPE1 test case of opm-data.  note that in the
 // real world it does not make much sense to specify a fluid phase using more than a
 // single keyword, but for a unit test, this saves a lot of boiler-plate code.
@@ -136,6 +141,62 @@ static constexpr const char* deckString1 =
     "/\n"
     "\n";
 
+// a live oil and wet gas deck with two PVT regions
+static constexpr const char* deckStringLive =
+    "RUNSPEC\n"
+    "DIMENS\n"
+    "   2 2 1 /\n"
+    "TABDIMS\n"
+    " * 2 /\n"
+    "OIL\n"
+    "GAS\n"
+    "WATER\n"
+    "DISGAS\n"
+    "VAPOIL\n"
+    "METRIC\n"
+    "GRID\n"
+    "DX\n"
+    "   4*100 /\n"
+    "DY\n"
+    "   4*100 /\n"
+    "DZ\n"
+    "   4*10 /\n"
+    "TOPS\n"
+    "   4*1000 /\n"
+    "PORO\n"
+    "   4*0.2 /\n"
+    "PROPS\n"
+    "DENSITY\n"
+    "   859.5  1033.0  0.854 /\n"
+    "   860.04 1033.0  0.853 /\n"
+    "PVTW\n"
+    "   1.0  1.1 1e-6 1.1 2.0e-9 /\n"
+    "   2.0  1.2 1e-7 1.2 3.0e-9 /\n"
+    "PVTO\n"
+    "-- RS   PRESSURE  BO     VISCOSITY\n"
+    "   1.0    1.0     1.06   1.1 /\n"
+    "  20.0   40.0     1.10   0.9\n"
+    "         80.0     1.08   1.0 /\n"
+    "  50.0  100.0     1.20   0.8\n"
+    "        200.0     1.17   0.9 /\n"
+    "/\n"
+    "   2.0    2.0     1.07   1.2 /\n"
+    "  30.0   60.0     1.12   0.8\n"
+    "        120.0     1.10   0.9 /\n"
+    "/\n"
+    "PVTG\n"
+    "-- PRESSURE  RV      BG     VISCOSITY\n"
+    "     1.00    1.1e-3  1.1    0.01\n"
+    "             1.0e-3  1.15   0.005 /\n"
+    "   500.00    0.9e-3  1.2    0.02\n"
+    "             0.8e-3  1.25   0.015 /\n"
+    "/\n"
+    "     2.00    2.1e-3  2.1    0.02\n"
+    "             2.0e-3  2.15   0.015 /\n"
+    "   502.00    1.2e-3  2.2    2.02\n"
+    "             1.1e-3  2.25   2.015 /\n"
+    "/\n";
+
 template <class Evaluation, class OilPvt, class GasPvt, class WaterPvt>
 void ensurePvtApi(const OilPvt& oilPvt, const GasPvt& gasPvt, const WaterPvt& waterPvt)
 {
@@ -226,6 +287,15 @@ void ensurePvtApi(const OilPvt& oilPvt, const GasPvt& gasPvt, const WaterPvt& wa
                                                     So,
                                                     maxSo);
 
+        /////
+        // batched API
+        /////
+        const Opm::PvtBatchInput<Evaluation> batchInput;
+        const Opm::PvtBatchOutput<Evaluation> batchOutput;
+        waterPvt.evaluateBatch(batchInput, batchOutput);
+        oilPvt.evaluateBatch(batchInput, batchOutput);
+        gasPvt.evaluateBatch(batchInput, batchOutput);
+
         // prevent GCC from producing a "variable assigned but unused" warning
         tmp = 2.0*tmp;
     }
@@ -297,4 +367,151 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ConstantCompressibilityWater, Scalar, Types)
                         refTmp << ". (is " << tmp << ")");
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchEvaluation, Scalar, Types)
+{
+    Opm::GasPvtMultiplexer<Scalar> gasPvt;
+    Opm::OilPvtMultiplexer<Scalar> oilPvt;
+    Opm::WaterPvtMultiplexer<Scalar> waterPvt;
+
+    gasPvt.initFromState(eclState, schedule);
+    oilPvt.initFromState(eclState, schedule);
+    waterPvt.initFromState(eclState, schedule);
+
+    // interleave the two PVT regions to exercise the grouping by region
+    const std::size_t numCells = 50;
+    std::vector<unsigned> regionIdx(numCells);
+    std::vector<Scalar> temperature(numCells, 273.15 + 20.0);
+    std::vector<Scalar> pressure(numCells);
+    std::vector<Scalar> Rv(numCells);
+    for (std::size_t i = 0; i < numCells; ++i) {
+        regionIdx[i] = (i % 3 == 0) ? 1 : 0;
+        pressure[i] = 2e5 + i*9e5;
+        Rv[i] = 1e-3 + i*1e-5;
+    }
+
+    const auto checkClose = [](const Scalar batch, const Scalar single)
+    {
+        const Scalar tolerance = std::numeric_limits<Scalar>::epsilon()*1e2;
+        BOOST_CHECK_SMALL((batch - single)/single, tolerance);
+    };
+
+    std::vector<Scalar> invB(numCells), mu(numCells), satRatio(numCells);
+    Opm::PvtBatchInput<Scalar> input;
+    input.size = numCells;
+    input.regionIdx = regionIdx.data();
+    input.temperature = temperature.data();
+    input.pressure = pressure.data();
+
+    // gas, with oil vaporization factor
+    input.mixingRatio = Rv.data();
+    gasPvt.evaluateBatch(input, {invB.data(), mu.data(), satRatio.data()});
+    for (std::size_t i = 0; i < numCells; ++i) {
+        checkClose(invB[i], gasPvt.inverseFormationVolumeFactor(regionIdx[i], temperature[i],
+                                                                pressure[i], Rv[i], Scalar{0}));
+        checkClose(mu[i], gasPvt.viscosity(regionIdx[i], temperature[i],
+                                           pressure[i], Rv[i], Scalar{0}));
+        checkClose(satRatio[i], gasPvt.saturatedOilVaporizationFactor(regionIdx[i], temperature[i],
+                                                                      pressure[i]));
+    }
+
+    // oil and water without dissolved gas; only some of the outputs requested
+    input.mixingRatio = nullptr;
+    std::fill(mu.begin(), mu.end(), Scalar{-1});
+    oilPvt.evaluateBatch(input, {invB.data(), nullptr, nullptr});
+    for (std::size_t i = 0; i < numCells; ++i) {
+        checkClose(invB[i], oilPvt.inverseFormationVolumeFactor(regionIdx[i], temperature[i],
+                                                                pressure[i], Scalar{0}));
+        BOOST_CHECK_EQUAL(mu[i], Scalar{-1});
+    }
+
+    waterPvt.evaluateBatch(input, {nullptr, mu.data(), nullptr});
+    for (std::size_t i = 0; i < numCells; ++i) {
+        checkClose(mu[i], waterPvt.viscosity(regionIdx[i], temperature[i],
+                                             pressure[i], Scalar{0}, Scalar{0}));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Visitor, Scalar, Types)
+{
+    Opm::GasPvtMultiplexer<Scalar> gasPvt;
+    Opm::OilPvtMultiplexer<Scalar> oilPvt;
+    Opm::WaterPvtMultiplexer<Scalar> waterPvt;
+
+    gasPvt.initFromState(eclState, schedule);
+    oilPvt.initFromState(eclState, schedule);
+    waterPvt.initFromState(eclState, schedule);
+
+    // the visited implementations must yield exactly the values of the multiplexers
+    const Scalar T = 273.15 + 20.0;
+    const Scalar zero = 0.0;
+    for (unsigned regionIdx = 0; regionIdx < 2; ++regionIdx) {
+        for (const Scalar p : {2e5, 1e7, 4e7}) {
+            const Scalar Rv = 1e-3;
+            int numVisits = 0;
+            gasPvt.visit([&](const auto& pvt) {
+                ++numVisits;
+                BOOST_CHECK_EQUAL(pvt.inverseFormationVolumeFactor(regionIdx, T, p, Rv, zero),
+                                  gasPvt.inverseFormationVolumeFactor(regionIdx, T, p, Rv, zero));
+                BOOST_CHECK_EQUAL(pvt.viscosity(regionIdx, T, p, Rv, zero),
+                                  gasPvt.viscosity(regionIdx, T, p, Rv, zero));
+            });
+            oilPvt.visit([&](const auto& pvt) {
+                ++numVisits;
+                BOOST_CHECK_EQUAL(pvt.inverseFormationVolumeFactor(regionIdx, T, p, zero),
+                                  oilPvt.inverseFormationVolumeFactor(regionIdx, T, p, zero));
+                BOOST_CHECK_EQUAL(pvt.viscosity(regionIdx, T, p, zero),
+                                  oilPvt.viscosity(regionIdx, T, p, zero));
+            });
+            waterPvt.visit([&](const auto& pvt) {
+                ++numVisits;
+                BOOST_CHECK_EQUAL(pvt.inverseFormationVolumeFactor(regionIdx, T, p, zero, zero),
+                                  waterPvt.inverseFormationVolumeFactor(regionIdx, T, p, zero, zero));
+                BOOST_CHECK_EQUAL(pvt.viscosity(regionIdx, T, p, zero, zero),
+                                  waterPvt.viscosity(regionIdx, T, p, zero, zero));
+            });
+            BOOST_CHECK_EQUAL(numVisits, 3);
+        }
+    }
+
+    // without a PVT implementation there is nothing to visit
+    const Opm::GasPvtMultiplexer<Scalar> noGasPvt;
+    BOOST_CHECK_THROW(noGasPvt.visit([](const auto&) {}), std::logic_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
+
+// the tables of 1/B and 1/(B*mu) are sampled at the same points for PVTO and PVTG, so
+// the viscosity shares the table lookup with the formation volume factor
+BOOST_AUTO_TEST_CASE(SharedInvBSampling)
+{
+    using Scalar = double;
+
+    const auto python = std::make_shared<Opm::Python>();
+    const auto deck = Opm::Parser().parseString(deckStringLive);
+    const Opm::EclipseState eclState(deck);
+    const Opm::Schedule schedule(deck, eclState, python);
+
+    Opm::LiveOilPvt<Scalar> oilPvt;
+    Opm::WetGasPvt<Scalar> gasPvt;
+    oilPvt.initFromState(eclState, schedule);
+    gasPvt.initFromState(eclState, schedule);
+
+    const Scalar T = 273.15 + 20.0;
+    const Scalar tolerance = std::numeric_limits<Scalar>::epsilon()*1e2;
+    for (unsigned regionIdx = 0; regionIdx < 2; ++regionIdx) {
+        BOOST_CHECK(oilPvt.sharedInvBSampling(regionIdx));
+        BOOST_CHECK(gasPvt.sharedInvBSampling(regionIdx));
+
+        for (const Scalar p : {5e5, 3e6, 9e6, 3e7}) {
+            const Scalar Rs = 15.0;
+            const Scalar muo = oilPvt.inverseOilBTable()[regionIdx].eval(Rs, p, /*extrapolate=*/true)
+                / oilPvt.inverseOilBMuTable()[regionIdx].eval(Rs, p, /*extrapolate=*/true);
+            BOOST_CHECK_CLOSE(oilPvt.viscosity(regionIdx, T, p, Rs), muo, tolerance*100);
+
+            const Scalar Rv = 1e-3;
+            const Scalar mug = gasPvt.inverseGasB()[regionIdx].eval(p, Rv, /*extrapolate=*/true)
+                / gasPvt.inverseGasBMu()[regionIdx].eval(p, Rv, /*extrapolate=*/true);
+            BOOST_CHECK_CLOSE(gasPvt.viscosity(regionIdx, T, p, Rv, Scalar{0}), mug, tolerance*100);
+        }
+    }
+}
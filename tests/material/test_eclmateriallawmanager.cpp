@@ -48,6 +48,17 @@
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // values of strings taken from the SPE1 test case1 of opm-data
 static constexpr const char* fam1DeckString =
     "RUNSPEC\n"
@@ -961,3 +972,267 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Let, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(RegionSharedParams, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+
+    // the lower half of the grid uses the unscaled connate water saturation of the
+    // SWOF table, the upper half is scaled
+    std::string deckString = fam1DeckString;
+    deckString.replace(deckString.find("OIL\n"), 4, "ENDSCALE\n/\n\nOIL\n");
+    deckString += "\nSWL\n   150*0.12 150*0.2 /\n";
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(deckString);
+    const Opm::EclipseState eclState(deck);
+
+    const auto& eclGrid = eclState.getInputGrid();
+    const size_t n = eclGrid.getCartesianSize();
+
+    MaterialLawManager referenceManager;
+    referenceManager.initFromState(eclState);
+    referenceManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    MaterialLawManager sharedManager;
+    sharedManager.initFromState(eclState);
+    sharedManager.setRegionSharedParams(true);
+    sharedManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    BOOST_CHECK(sharedManager.regionSharedParams());
+    BOOST_CHECK(referenceManager.oilWaterScaledEpsInfoDrainage(0).Swl !=
+                referenceManager.oilWaterScaledEpsInfoDrainage(n - 1).Swl);
+
+    for (unsigned elemIdx = 0; elemIdx < n; elemIdx += 7) {
+        BOOST_CHECK(referenceManager.oilWaterScaledEpsInfoDrainage(elemIdx) ==
+                    sharedManager.oilWaterScaledEpsInfoDrainage(elemIdx));
+
+        for (int i = 0; i <= 100; i += 5) {
+            const Scalar Sw = Scalar(i) / 100;
+            for (int j = 0; j <= 100 - i; j += 5) {
+                const Scalar So = Scalar(j) / 100;
+                typename Fixture<Scalar>::FluidState fs;
+                fs.setSaturation(Fixture<Scalar>::waterPhaseIdx, Sw);
+                fs.setSaturation(Fixture<Scalar>::oilPhaseIdx, So);
+                fs.setSaturation(Fixture<Scalar>::gasPhaseIdx, 1 - Sw - So);
+
+                std::array<Scalar,numPhases> pcReference = {0.0, 0.0, 0.0};
+                std::array<Scalar,numPhases> pcShared = {0.0, 0.0, 0.0};
+                MaterialLaw::capillaryPressures(pcReference, referenceManager.materialLawParams(elemIdx), fs);
+                MaterialLaw::capillaryPressures(pcShared, sharedManager.materialLawParams(elemIdx), fs);
+
+                std::array<Scalar,numPhases> krReference = {0.0, 0.0, 0.0};
+                std::array<Scalar,numPhases> krShared = {0.0, 0.0, 0.0};
+                MaterialLaw::relativePermeabilities(krReference, referenceManager.materialLawParams(elemIdx), fs);
+                MaterialLaw::relativePermeabilities(krShared, sharedManager.materialLawParams(elemIdx), fs);
+
+                for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                    BOOST_CHECK_MESSAGE(pcReference[phaseIdx] == pcShared[phaseIdx],
+                                        "Capillary pressure of cell " << elemIdx
+                                        << " differs with region-shared parameters");
+                    BOOST_CHECK_MESSAGE(krReference[phaseIdx] == krShared[phaseIdx],
+                                        "Relative permeability of cell " << elemIdx
+                                        << " differs with region-shared parameters");
+                }
+            }
+        }
+    }
+
+    // connectionMaterialLawParams() must only modify the parameters of the given cell
+    BOOST_REQUIRE(sharedManager.materialLawParams(0).approach() == Opm::EclMultiplexerApproach::Default);
+    const auto oilWaterParams = [&sharedManager](unsigned elemIdx)
+    {
+        return &sharedManager.materialLawParams(elemIdx)
+            .template getRealParams<Opm::EclMultiplexerApproach::Default>().oilWaterParams();
+    };
+    BOOST_CHECK(oilWaterParams(0) == oilWaterParams(1));
+    sharedManager.connectionMaterialLawParams(0, 0);
+    BOOST_CHECK(oilWaterParams(0) != oilWaterParams(1));
+
+    // the cell is only detached from its region once
+    const auto* detached = oilWaterParams(0);
+    sharedManager.connectionMaterialLawParams(0, 0);
+    BOOST_CHECK(oilWaterParams(0) == detached);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ApproachVisitor, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+
+    const std::array<std::pair<std::string, Opm::EclMultiplexerApproach>, 3> approaches = {{
+        {"", Opm::EclMultiplexerApproach::Default},
+        {"STONE1\n", Opm::EclMultiplexerApproach::Stone1},
+        {"STONE2\n", Opm::EclMultiplexerApproach::Stone2},
+    }};
+
+    for (const auto& [keyword, approach] : approaches) {
+        std::string deckString = hysterDeckString;
+        deckString.replace(deckString.find("PROPS\n"), 6, "PROPS\n" + keyword);
+
+        Opm::Parser parser;
+        const auto deck = parser.parseString(deckString);
+        const Opm::EclipseState eclState(deck);
+        const size_t n = eclState.getInputGrid().getCartesianSize();
+
+        MaterialLawManager manager;
+        manager.initFromState(eclState);
+        manager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+        BOOST_CHECK(manager.threePhaseApproach() == approach);
+
+        int numVisits = 0;
+        MaterialLaw::visit(manager.threePhaseApproach(), [&](auto law) {
+            ++numVisits;
+            BOOST_CHECK(decltype(law)::approach == approach);
+
+            for (unsigned elemIdx = 0; elemIdx < n; elemIdx += 11) {
+                for (int i = 0; i <= 100; i += 5) {
+                    const Scalar Sw = Scalar(i) / 100;
+                    for (int j = 0; j <= 100 - i; j += 5) {
+                        const Scalar So = Scalar(j) / 100;
+                        typename Fixture<Scalar>::FluidState fs;
+                        fs.setSaturation(Fixture<Scalar>::waterPhaseIdx, Sw);
+                        fs.setSaturation(Fixture<Scalar>::oilPhaseIdx, So);
+                        fs.setSaturation(Fixture<Scalar>::gasPhaseIdx, 1 - Sw - So);
+
+                        const auto& params = manager.materialLawParams(elemIdx);
+                        std::array<Scalar,numPhases> pcMultiplexed = {0.0, 0.0, 0.0};
+                        std::array<Scalar,numPhases> pcVisited = {0.0, 0.0, 0.0};
+                        MaterialLaw::capillaryPressures(pcMultiplexed, params, fs);
+                        law.capillaryPressures(pcVisited, params, fs);
+
+                        std::array<Scalar,numPhases> krMultiplexed = {0.0, 0.0, 0.0};
+                        std::array<Scalar,numPhases> krVisited = {0.0, 0.0, 0.0};
+                        MaterialLaw::relativePermeabilities(krMultiplexed, params, fs);
+                        law.relativePermeabilities(krVisited, params, fs);
+
+                        BOOST_CHECK(pcMultiplexed == pcVisited);
+                        BOOST_CHECK(krMultiplexed == krVisited);
+                    }
+                }
+            }
+        });
+        BOOST_CHECK_EQUAL(numVisits, 1);
+    }
+}
+
+// Three saturation regions on nx*ny*nz cells of which the upper half uses a scaled
+// connate water saturation.
+static std::string manyCellsDeckString(const std::size_t nx, const std::size_t ny, const std::size_t nz)
+{
+    const std::size_t numCells = nx*ny*nz;
+    const std::size_t third = numCells / 3;
+    const std::size_t half = numCells / 2;
+
+    const std::string swof =
+        "0.1  0.0   1.0   2.0\n"
+        "0.3  0.05  0.6   1.0\n"
+        "0.5  0.2   0.25  0.5\n"
+        "0.7  0.45  0.05  0.2\n"
+        "0.9  0.8   0.0   0.0\n"
+        "1.0  1.0   0.0   0.0 /\n";
+    const std::string sgof =
+        "0.0  0.0   1.0   0.0\n"
+        "0.2  0.1   0.5   0.1\n"
+        "0.5  0.4   0.1   0.3\n"
+        "0.9  1.0   0.0   0.5 /\n";
+
+    return "RUNSPEC\n"
+        "DIMENS\n " + std::to_string(nx) + " " + std::to_string(ny) + " " + std::to_string(nz) + " /\n"
+        "TABDIMS\n 3 /\n"
+        "OIL\nGAS\nWATER\n"
+        "ENDSCALE\n/\n"
+        "METRIC\n"
+        "GRID\n"
+        "DX\n " + std::to_string(numCells) + "*100 /\n"
+        "DY\n " + std::to_string(numCells) + "*100 /\n"
+        "DZ\n " + std::to_string(numCells) + "*10 /\n"
+        "TOPS\n " + std::to_string(nx*ny) + "*2000 /\n"
+        "PORO\n " + std::to_string(numCells) + "*0.25 /\n"
+        "PERMX\n " + std::to_string(numCells) + "*100 /\n"
+        "PERMY\n " + std::to_string(numCells) + "*100 /\n"
+        "PERMZ\n " + std::to_string(numCells) + "*10 /\n"
+        "PROPS\n"
+        "SWOF\n" + swof + swof + swof +
+        "SGOF\n" + sgof + sgof + sgof +
+        "SWL\n " + std::to_string(half) + "*0.1 " + std::to_string(numCells - half) + "*0.15 /\n"
+        "REGIONS\n"
+        "SATNUM\n " + std::to_string(third) + "*1 " + std::to_string(third) + "*2 "
+        + std::to_string(numCells - 2*third) + "*3 /\n";
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ParallelInitMatchesSerial, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+
+    // enough cells for initParamsForElements() to distribute them over the threads
+    Opm::Parser parser;
+    const auto deck = parser.parseString(manyCellsDeckString(20, 10, 10));
+    const Opm::EclipseState eclState(deck);
+    const size_t n = eclState.getInputGrid().getCartesianSize();
+
+    int maxThreads = 1;
+#ifdef _OPENMP
+    maxThreads = omp_get_max_threads();
+#endif
+
+    const auto initialize = [&eclState, n](const int numThreads, const bool regionShared)
+    {
+#ifdef _OPENMP
+        omp_set_num_threads(numThreads);
+#else
+        static_cast<void>(numThreads);
+#endif
+        auto manager = std::make_unique<MaterialLawManager>();
+        manager->initFromState(eclState);
+        manager->setRegionSharedParams(regionShared);
+        manager->initParamsForElements(eclState, n, doOldLookup, doNothing);
+        return manager;
+    };
+
+    for (const bool regionShared : {false, true}) {
+        const auto serialManager = initialize(1, regionShared);
+        const auto parallelManager = initialize(std::max(maxThreads, 4), regionShared);
+
+        for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+            BOOST_CHECK_MESSAGE(serialManager->oilWaterScaledEpsInfoDrainage(elemIdx) ==
+                                parallelManager->oilWaterScaledEpsInfoDrainage(elemIdx),
+                                "Scaled end-points of cell " << elemIdx
+                                << " differ between serial and parallel set-up");
+
+            for (int i = 10; i <= 90; i += 20) {
+                const Scalar Sw = Scalar(i) / 100;
+                typename Fixture<Scalar>::FluidState fs;
+                fs.setSaturation(Fixture<Scalar>::waterPhaseIdx, Sw);
+                fs.setSaturation(Fixture<Scalar>::oilPhaseIdx, Scalar(0.9) - Sw);
+                fs.setSaturation(Fixture<Scalar>::gasPhaseIdx, Scalar(0.1));
+
+                std::array<Scalar,numPhases> pcSerial = {0.0, 0.0, 0.0};
+                std::array<Scalar,numPhases> pcParallel = {0.0, 0.0, 0.0};
+                MaterialLaw::capillaryPressures(pcSerial, serialManager->materialLawParams(elemIdx), fs);
+                MaterialLaw::capillaryPressures(pcParallel, parallelManager->materialLawParams(elemIdx), fs);
+
+                std::array<Scalar,numPhases> krSerial = {0.0, 0.0, 0.0};
+                std::array<Scalar,numPhases> krParallel = {0.0, 0.0, 0.0};
+                MaterialLaw::relativePermeabilities(krSerial, serialManager->materialLawParams(elemIdx), fs);
+                MaterialLaw::relativePermeabilities(krParallel, parallelManager->materialLawParams(elemIdx), fs);
+
+                BOOST_CHECK_MESSAGE(pcSerial == pcParallel,
+                                    "Capillary pressure of cell " << elemIdx
+                                    << " differs between serial and parallel set-up");
+                BOOST_CHECK_MESSAGE(krSerial == krParallel,
+                                    "Relative permeability of cell " << elemIdx
+                                    << " differs between serial and parallel set-up");
+            }
+        }
+    }
+
+#ifdef _OPENMP
+    omp_set_num_threads(maxThreads);
+#endif
+}
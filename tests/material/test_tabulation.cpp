@@ -34,11 +34,15 @@
 #define BOOST_TEST_MODULE Tabulation
 #include <boost/test/unit_test.hpp>
 
+#include <opm/material/common/Tabulated1DFunction.hpp>
 #include <opm/material/components/H2O.hpp>
 #include <opm/material/components/TabulatedComponent.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
 #include <tuple>
+#include <vector>
 
 using Types = boost::mpl::list<float,double>;
 
@@ -108,3 +112,58 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(H2O, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Tabulated1DFunction_SegmentLookup, Scalar, Types)
+{
+    // Strongly non-uniform sampling, with a few repeated abscissas, so
+    // that buckets of the segment index span several segments.
+    std::vector<Scalar> x, y;
+    for (unsigned i = 0; i < 200; ++i) {
+        x.push_back(Scalar(i*i)/100 + ((i == 50 || i == 51) ? Scalar(0.0) : Scalar(i)/1000));
+        y.push_back(Scalar(1.0) + Scalar(i % 7));
+    }
+    x[51] = x[50];
+
+    const Opm::Tabulated1DFunction<Scalar> f(x, y, /*sortInputs=*/false);
+
+    // Reference segment search over the full table.
+    const auto referenceSegment = [&x](const Scalar xi) -> std::size_t
+    {
+        const std::size_t n = x.size();
+        if (xi <= x[1])
+            return 0;
+        if (xi >= x[n - 2])
+            return n - 2;
+
+        const auto pos = std::upper_bound(x.begin() + 1, x.begin() + n - 2, xi);
+        return static_cast<std::size_t>(pos - x.begin()) - 1;
+    };
+
+    auto samples = x;
+    for (unsigned i = 0; i + 1 < x.size(); ++i) {
+        samples.push_back((x[i] + x[i + 1])/2);
+    }
+    samples.push_back(x.front() - 1);
+    samples.push_back(x.back() + 1);
+
+    Opm::SegmentHint hint{};
+    for (const auto& xi : samples) {
+        const auto expect = referenceSegment(xi);
+        BOOST_CHECK_EQUAL(f.findSegmentIndex(xi, /*extrapolate=*/true).value, expect);
+
+        const auto hinted = f.findSegmentIndex(xi, hint, /*extrapolate=*/true).value;
+        BOOST_CHECK_EQUAL(hinted, expect);
+        BOOST_CHECK_EQUAL(hint.value, expect);
+
+        // Same position again must be served from the hint.
+        BOOST_CHECK_EQUAL(f.findSegmentIndex(xi, hint, /*extrapolate=*/true).value, expect);
+        BOOST_CHECK_EQUAL(f.eval(xi, hint, /*extrapolate=*/true),
+                          f.eval(xi, /*extrapolate=*/true));
+    }
+
+    // Hints from other, larger tables must not be trusted.
+    Opm::SegmentHint stale{1000};
+    BOOST_CHECK_EQUAL(f.findSegmentIndex(x[10], stale).value, referenceSegment(x[10]));
+
+    BOOST_CHECK_THROW(f.findSegmentIndex(x.back() + 1, hint), std::logic_error);
+}
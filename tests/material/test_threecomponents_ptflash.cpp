@@ -45,6 +45,12 @@
 #include <opm/material/fluidstates/CompositionalFluidState.hpp>
 #include <opm/material/fluidmatrixinteractions/LinearMaterial.hpp>
 
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 // It is a three component system
 using Scalar = double;
 using FluidSystem = Opm::ThreeComponentFluidSystem<Scalar>;
@@ -220,3 +226,87 @@ for (const auto& sample : test_methods) {
 }
 #endif
 }
+
+BOOST_AUTO_TEST_CASE(PtFlashBatch)
+{
+    using Flash = Opm::PTFlash<double, FluidSystem>;
+
+    // a range of pressures and compositions which covers single- and two-phase states
+    std::vector<FluidState> states;
+    std::vector<ComponentVector> zs;
+    for (int pIdx = 0; pIdx < 20; ++pIdx) {
+        for (int cIdx = 0; cIdx < 20; ++cIdx) {
+            const Evaluation p = Evaluation::createVariable(1e5*std::pow(1.4, pIdx), 0);
+            ComponentVector z;
+            z[0] = Evaluation::createVariable(0.005 + 0.05*cIdx, 1);
+            z[1] = Evaluation::createVariable(0.3*(1.0 - Opm::getValue(z[0])), 2);
+            z[2] = 1. - z[0] - z[1];
+
+            FluidState fs;
+            fs.setPressure(FluidSystem::oilPhaseIdx, p);
+            fs.setPressure(FluidSystem::gasPhaseIdx, p);
+            fs.setTemperature(300.0);
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                fs.setMoleFraction(FluidSystem::oilPhaseIdx, compIdx, z[compIdx]);
+                fs.setMoleFraction(FluidSystem::gasPhaseIdx, compIdx, z[compIdx]);
+            }
+            fs.setSaturation(FluidSystem::oilPhaseIdx, 1.0);
+            fs.setSaturation(FluidSystem::gasPhaseIdx, 0.0);
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                fs.setKvalue(compIdx, fs.wilsonK_(compIdx));
+            }
+            fs.setLvalue(1.0);
+
+            states.push_back(fs);
+            zs.push_back(z);
+        }
+    }
+
+    for (const std::string method : {"newton", "ssi+newton"}) {
+        std::vector<FluidState> reference = states;
+        for (std::size_t idx = 0; idx < reference.size(); ++idx) {
+            Flash::solve(reference[idx], zs[idx], method, 1e-12);
+        }
+
+        std::vector<FluidState> batch = states;
+        std::vector<Opm::PTFlashStatistics> statistics;
+        Flash::solveBatch(batch, zs, method, 1e-12, &statistics);
+        BOOST_REQUIRE_EQUAL(statistics.size(), batch.size());
+
+        std::size_t numTwoPhase = 0;
+        for (std::size_t idx = 0; idx < batch.size(); ++idx) {
+            BOOST_CHECK(Opm::MathToolbox<Evaluation>::isSame(batch[idx].L(), reference[idx].L(), 1e-12));
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                BOOST_CHECK(Opm::MathToolbox<Evaluation>::isSame(batch[idx].moleFraction(FluidSystem::oilPhaseIdx, compIdx),
+                                                                 reference[idx].moleFraction(FluidSystem::oilPhaseIdx, compIdx),
+                                                                 1e-12));
+            }
+            BOOST_CHECK(statistics[idx].stabilityTest);
+            BOOST_CHECK_GT(statistics[idx].stabilityIterations, 0u);
+            if (!statistics[idx].singlePhase) {
+                ++numTwoPhase;
+                BOOST_CHECK_GT(statistics[idx].newtonIterations, 0u);
+            }
+        }
+        BOOST_CHECK_GT(numTwoPhase, 0u);
+        BOOST_CHECK_LT(numTwoPhase, batch.size());
+
+        // flashing the converged states again starts from their K-values, so the
+        // two-phase states skip the stability test and need fewer iterations
+        std::vector<Opm::PTFlashStatistics> restartStatistics;
+        Flash::solveBatch(batch, zs, method, 1e-12, &restartStatistics);
+        Opm::PTFlashStatistics total, restartTotal;
+        for (std::size_t idx = 0; idx < batch.size(); ++idx) {
+            if (!statistics[idx].singlePhase) {
+                BOOST_CHECK(!restartStatistics[idx].stabilityTest);
+            }
+            total += statistics[idx];
+            restartTotal += restartStatistics[idx];
+        }
+        BOOST_CHECK_LT(restartTotal.stabilityIterations, total.stabilityIterations);
+        BOOST_CHECK_LT(restartTotal.newtonIterations, total.newtonIterations);
+    }
+
+    std::vector<ComponentVector> tooFew(zs.begin(), zs.begin() + 1);
+    BOOST_CHECK_THROW(Flash::solveBatch(states, tooFew, "newton"), std::invalid_argument);
+}
@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdio>
 #include <ctime>
@@ -720,6 +721,150 @@ BOOST_AUTO_TEST_CASE(ResetACTNUM) {
     BOOST_CHECK_EQUAL(grid.getGlobalIndex(1,2,3), 321U);
 }
 
+BOOST_AUTO_TEST_CASE(GeometryCache) {
+    // A tilted and sheared grid with some inactive cells.
+    Opm::EclipseGrid grid(std::array<int,3>{{6, 5, 4}},
+                          Opm::EclipseGrid(6, 5, 4, 10.0, 20.0, 2.5).getCOORD(),
+                          Opm::EclipseGrid(6, 5, 4, 10.0, 20.0, 2.5).getZCORN());
+    {
+        auto coord = grid.getCOORD();
+        auto zcorn = grid.getZCORN();
+        for (std::size_t i = 0; i < coord.size(); i += 3)
+            coord[i] += 0.1 * coord[i + 2];
+
+        for (std::size_t i = 0; i < zcorn.size(); ++i)
+            zcorn[i] += 0.5 * std::sin(0.7 * i) + 1.0e-3 * i;
+
+        std::vector<int> actnum(grid.getCartesianSize(), 1);
+        actnum[3] = actnum[17] = actnum[64] = 0;
+        grid = Opm::EclipseGrid(grid.getNXYZ(), coord, zcorn, actnum.data());
+    }
+
+    struct Geometry {
+        std::array<double,3> center, dims;
+        double depth, thickness, volume;
+    };
+
+    auto geometry = [&grid]() {
+        std::vector<Geometry> cells;
+        for (std::size_t g = 0; g < grid.getCartesianSize(); ++g)
+            cells.push_back({grid.getCellCenter(g), grid.getCellDims(g), grid.getCellDepth(g),
+                             grid.getCellThickness(g), grid.getCellVolume(g)});
+        return cells;
+    };
+
+    const auto reference = geometry();
+    const auto reference_volume = grid.activeVolume();
+    BOOST_CHECK(!grid.hasGeometryCache());
+
+    grid.cacheGeometry();
+    BOOST_CHECK(grid.hasGeometryCache());
+    {
+        const auto cached = geometry();
+        for (std::size_t g = 0; g < cached.size(); ++g) {
+            BOOST_CHECK(cached[g].center == reference[g].center);
+            BOOST_CHECK(cached[g].dims == reference[g].dims);
+            BOOST_CHECK_EQUAL(cached[g].depth, reference[g].depth);
+            BOOST_CHECK_EQUAL(cached[g].thickness, reference[g].thickness);
+            BOOST_CHECK_EQUAL(cached[g].volume, reference[g].volume);
+        }
+        BOOST_CHECK(grid.activeVolume() == reference_volume);
+    }
+
+    grid.cacheGeometry(true);
+    {
+        const auto cached = geometry();
+        for (std::size_t g = 0; g < cached.size(); ++g) {
+            for (std::size_t d = 0; d < 3; ++d) {
+                BOOST_CHECK_CLOSE(cached[g].center[d], reference[g].center[d], 1.0e-4);
+                BOOST_CHECK_CLOSE(cached[g].dims[d], reference[g].dims[d], 1.0e-4);
+            }
+            BOOST_CHECK_CLOSE(cached[g].depth, reference[g].depth, 1.0e-4);
+            BOOST_CHECK_CLOSE(cached[g].thickness, reference[g].thickness, 1.0e-4);
+            BOOST_CHECK_CLOSE(cached[g].volume, reference[g].volume, 1.0e-4);
+        }
+        BOOST_CHECK(grid.activeVolume() == reference_volume);
+    }
+
+    grid.resetACTNUM();
+    BOOST_CHECK(!grid.hasGeometryCache());
+    BOOST_CHECK_EQUAL(grid.getCellVolume(3), reference[3].volume);
+}
+
+BOOST_AUTO_TEST_CASE(CompactStorage) {
+    const std::array<int,3> dims {{7, 4, 5}};
+    auto coord = Opm::EclipseGrid(7, 4, 5, 100.0, 150.0, 4.0).getCOORD();
+    auto zcorn = Opm::EclipseGrid(7, 4, 5, 100.0, 150.0, 4.0).getZCORN();
+    for (std::size_t i = 0; i < coord.size(); i += 3) {
+        coord[i] += 452000.0 + 0.2 * coord[i + 2];
+        coord[i + 1] += 6780000.0;
+        coord[i + 2] += 2500.0;
+    }
+    for (std::size_t i = 0; i < zcorn.size(); ++i)
+        zcorn[i] += 2500.0 + 0.8 * std::sin(0.3 * i);
+
+    const Opm::EclipseGrid reference(dims, coord, zcorn);
+    Opm::EclipseGrid grid(dims, coord, zcorn);
+
+    BOOST_CHECK(!grid.hasCompactStorage());
+    BOOST_CHECK(!grid.compactStorage(1.0e-12));
+    BOOST_CHECK(!grid.hasCompactStorage());
+
+    BOOST_CHECK(grid.compactStorage());
+    BOOST_CHECK(grid.hasCompactStorage());
+
+    for (std::size_t g = 0; g < grid.getCartesianSize(); ++g) {
+        const auto center = grid.getCellCenter(g);
+        const auto ref_center = reference.getCellCenter(g);
+        for (std::size_t d = 0; d < 3; ++d)
+            BOOST_CHECK_SMALL(center[d] - ref_center[d], 1.0e-4);
+
+        BOOST_CHECK_SMALL(grid.getCellDepth(g) - reference.getCellDepth(g), 1.0e-4);
+        BOOST_CHECK_CLOSE(grid.getCellVolume(g), reference.getCellVolume(g), 1.0e-4);
+    }
+
+    BOOST_CHECK_THROW(grid.getCOORD(), std::logic_error);
+    BOOST_CHECK_THROW(grid.getZCORN(), std::logic_error);
+
+    // Expanding the storage gives the reconstructed arrays, within the
+    // documented bound of 2^-24 times the span of the pillar.
+    {
+        const auto& ref_zcorn = reference.getZCORN();
+        const auto [zmin, zmax] = std::minmax_element(ref_zcorn.begin(), ref_zcorn.end());
+        grid.expandStorage();
+        BOOST_CHECK(!grid.hasCompactStorage());
+        const auto& expanded = grid.getZCORN();
+        BOOST_CHECK_EQUAL(expanded.size(), ref_zcorn.size());
+        for (std::size_t i = 0; i < expanded.size(); ++i)
+            BOOST_CHECK_SMALL(expanded[i] - ref_zcorn[i], 6.0e-8 * (*zmax - *zmin) + 1.0e-9);
+
+        BOOST_CHECK_EQUAL(grid.getCOORD().size(), reference.getCOORD().size());
+    }
+
+    // Undefined pillar points are not representable.
+    {
+        auto bad_zcorn = zcorn;
+        bad_zcorn[5] = 1.0e20;
+        Opm::EclipseGrid bad(dims, coord, bad_zcorn);
+        BOOST_CHECK(!bad.compactStorage());
+    }
+
+    // Compacting a grid twice gives the same result, and compact grids
+    // compare by their reconstructed arrays.
+    {
+        Opm::EclipseGrid first(dims, coord, zcorn);
+        Opm::EclipseGrid second(dims, coord, zcorn);
+        BOOST_CHECK(first.compactStorage());
+        const auto first_equal = first.equal(reference);
+        first.expandStorage();
+        BOOST_CHECK(first_equal == (first.getCOORD() == reference.getCOORD() &&
+                                    first.getZCORN() == reference.getZCORN()));
+        BOOST_CHECK(second.compactStorage());
+        BOOST_CHECK(first.compactStorage());
+        BOOST_CHECK(first.equal(second));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(TestCP_example) {
     const char* deckData =
 
@@ -42,6 +42,8 @@
 #include <opm/input/eclipse/Deck/DeckValue.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Deck/FileDeck.hpp>
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/io/eclipse/rst/state.hpp>
@@ -160,6 +162,30 @@ BOOST_AUTO_TEST_CASE(LoadRestartSim) {
 }
 
 
+BOOST_AUTO_TEST_CASE(LoadLazyRestartSim) {
+    Parser parser;
+    auto python = std::make_shared<Python>();
+    auto deck = parser.parseFile("SPE1CASE2_RESTART.DATA");
+    EclipseState ecl_state(deck);
+
+    auto rst_file = std::make_shared<EclIO::ERst>("SPE1CASE2.X0060");
+    auto rst_view = std::make_shared<EclIO::RestartFileView>(std::move(rst_file), 60);
+    auto rst_state = RestartIO::RstState::load(std::move(rst_view), ecl_state.runspec(), parser);
+
+    Schedule eager(deck, ecl_state, python, {}, &rst_state);
+
+    ParseContext parseContext;
+    parseContext.setLazyScheduleLoading(true);
+    ErrorGuard errors;
+    Schedule lazy(deck, ecl_state, parseContext, errors, python, {}, &rst_state);
+
+    // Lazy loading starts at the restart step.
+    BOOST_CHECK_EQUAL(lazy.numLoadedSteps(), std::size_t{61});
+    BOOST_CHECK_EQUAL(lazy.size(), eager.size());
+    BOOST_CHECK_MESSAGE(lazy == eager, "Lazily loaded restarted Schedule must equal eagerly loaded Schedule");
+}
+
+
 BOOST_AUTO_TEST_CASE(LoadUDQRestartSim) {
     const auto& [sched, restart_sched, rst_state] = load_schedule_pair("UDQ_WCONPROD.DATA", "UDQ_WCONPROD_RESTART.DATA", "UDQ_WCONPROD.X0006", 6);
     std::size_t report_step = 10;
@@ -24,6 +24,8 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/common/utility/TimeService.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
 
 #include <opm/input/eclipse/Python/Python.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
@@ -346,6 +348,16 @@ static Schedule make_schedule(const std::string& deck_string) {
 
 
 
+template <typename T>
+static std::vector<T> copy_values(const std::vector<const T*>& value_list) {
+    std::vector<T> values;
+    for (const auto* value : value_list)
+        values.push_back(*value);
+
+    return values;
+}
+
+
 BOOST_AUTO_TEST_CASE(SerializeWTest) {
     auto sched = make_schedule(WTEST_deck);
     auto sched0 = make_schedule(deck0);
@@ -353,12 +365,14 @@ BOOST_AUTO_TEST_CASE(SerializeWTest) {
     auto wtest2 = sched[3].wtest_config();
 
     {
-        std::vector<Opm::WellTestConfig> value_list;
+        std::vector<const Opm::WellTestConfig*> value_list;
         std::vector<std::size_t> index_list;
-        sched.pack_state<Opm::WellTestConfig>( value_list, index_list );
+        std::vector<std::size_t> value_index;
+        sched.pack_state<Opm::WellTestConfig>( value_list, index_list, value_index );
         BOOST_CHECK_EQUAL( value_list.size(), 2 );
 
-        sched0.unpack_state<Opm::WellTestConfig>( value_list, index_list );
+        auto values = copy_values(value_list);
+        sched0.unpack_state<Opm::WellTestConfig>( values, index_list, value_index );
     }
     BOOST_CHECK( wtest1 == sched0[0].wtest_config());
     BOOST_CHECK( wtest1 == sched0[1].wtest_config());
@@ -376,11 +390,13 @@ BOOST_AUTO_TEST_CASE(SerializeWList) {
     auto wlm2 = sched[3].wlist_manager();
 
     {
-        std::vector<Opm::WListManager> value_list;
+        std::vector<const Opm::WListManager*> value_list;
         std::vector<std::size_t> index_list;
-        sched.pack_state<Opm::WListManager>( value_list, index_list);
+        std::vector<std::size_t> value_index;
+        sched.pack_state<Opm::WListManager>( value_list, index_list, value_index );
         BOOST_CHECK_EQUAL( value_list.size(), 2 );
-        sched0.unpack_state<Opm::WListManager>( value_list, index_list );
+        auto values = copy_values(value_list);
+        sched0.unpack_state<Opm::WListManager>( values, index_list, value_index );
     }
     BOOST_CHECK( wlm1 == sched0[0].wlist_manager());
     BOOST_CHECK( wlm1 == sched0[1].wlist_manager());
@@ -397,11 +413,13 @@ BOOST_AUTO_TEST_CASE(SerializeGECON) {
     auto gecon1 = sched[0].gecon.get();
 
     {
-        std::vector<Opm::GroupEconProductionLimits> value_list;
+        std::vector<const Opm::GroupEconProductionLimits*> value_list;
         std::vector<std::size_t> index_list;
-        sched.pack_state<Opm::GroupEconProductionLimits>( value_list, index_list );
+        std::vector<std::size_t> value_index;
+        sched.pack_state<Opm::GroupEconProductionLimits>( value_list, index_list, value_index );
         BOOST_CHECK_EQUAL( value_list.size(), 1 );
-        sched0.unpack_state<Opm::GroupEconProductionLimits>( value_list, index_list );
+        auto values = copy_values(value_list);
+        sched0.unpack_state<Opm::GroupEconProductionLimits>( values, index_list, value_index );
     }
     BOOST_CHECK( gecon1 == sched0[0].gecon());
     BOOST_CHECK( gecon1 == sched0[1].gecon());
@@ -415,11 +433,13 @@ BOOST_AUTO_TEST_CASE(SerializeGCONSALE) {
     auto gconsale2 = sched[3].gconsale.get();
 
     {
-        std::vector<Opm::GConSale> value_list;
+        std::vector<const Opm::GConSale*> value_list;
         std::vector<std::size_t> index_list;
-        sched.pack_state<Opm::GConSale>( value_list, index_list );
+        std::vector<std::size_t> value_index;
+        sched.pack_state<Opm::GConSale>( value_list, index_list, value_index );
         BOOST_CHECK_EQUAL( value_list.size(), 2 );
-        sched0.unpack_state<Opm::GConSale>( value_list, index_list );
+        auto values = copy_values(value_list);
+        sched0.unpack_state<Opm::GConSale>( values, index_list, value_index );
     }
 
     BOOST_CHECK( gconsale1 == sched0[0].gconsale());
@@ -438,11 +458,13 @@ BOOST_AUTO_TEST_CASE(SerializeGCONSUMP) {
     auto gconsump2 = sched[3].gconsump.get();
 
     {
-        std::vector<Opm::GConSump> value_list;
+        std::vector<const Opm::GConSump*> value_list;
         std::vector<std::size_t> index_list;
-        sched.pack_state<Opm::GConSump>( value_list, index_list );
+        std::vector<std::size_t> value_index;
+        sched.pack_state<Opm::GConSump>( value_list, index_list, value_index );
         BOOST_CHECK_EQUAL( value_list.size(), 2 );
-        sched0.unpack_state<Opm::GConSump>( value_list, index_list );
+        auto values = copy_values(value_list);
+        sched0.unpack_state<Opm::GConSump>( values, index_list, value_index );
     }
 
     BOOST_CHECK( gconsump1 == sched0[0].gconsump());
@@ -462,11 +484,13 @@ BOOST_AUTO_TEST_CASE(SerializeVFP) {
     auto vfpinj2 = sched[3].vfpinj;
 
     {
-        std::vector<Opm::VFPInjTable> value_list;
+        std::vector<const Opm::VFPInjTable*> value_list;
         std::vector<std::size_t> index_list;
-        sched.pack_map<int, Opm::VFPInjTable>( value_list, index_list );
+        std::vector<std::size_t> value_index;
+        sched.pack_map<int, Opm::VFPInjTable>( value_list, index_list, value_index );
         BOOST_CHECK_EQUAL( value_list.size(), 2 );
-        sched0.unpack_map<int, Opm::VFPInjTable>( value_list, index_list );
+        auto values = copy_values(value_list);
+        sched0.unpack_map<int, Opm::VFPInjTable>( values, index_list, value_index );
     }
 
     BOOST_CHECK( vfpinj1 == sched0[0].vfpinj);
@@ -485,11 +509,13 @@ BOOST_AUTO_TEST_CASE(SerializeGROUPS) {
     auto groups2 = sched[3].groups;
 
     {
-        std::vector<Opm::Group> value_list;
+        std::vector<const Opm::Group*> value_list;
         std::vector<std::size_t> index_list;
-        sched.pack_map<std::string, Opm::Group>( value_list, index_list );
+        std::vector<std::size_t> value_index;
+        sched.pack_map<std::string, Opm::Group>( value_list, index_list, value_index );
         BOOST_CHECK_EQUAL( value_list.size(), 5 );
-        sched0.unpack_map<std::string, Opm::Group>( value_list, index_list );
+        auto values = copy_values(value_list);
+        sched0.unpack_map<std::string, Opm::Group>( values, index_list, value_index );
     }
 
     BOOST_CHECK( groups1 == sched0[0].groups);
@@ -508,3 +534,70 @@ BOOST_AUTO_TEST_CASE(SerializeGROUPS) {
 
 
 
+
+BOOST_AUTO_TEST_CASE(SerializeBackReference) {
+    auto sched = make_schedule(GCONSALE_deck);
+    auto sched0 = make_schedule(deck0);
+    std::vector<Opm::GConSale> values{ sched[0].gconsale(), sched[3].gconsale() };
+
+    // Report steps 4 and 5 refer back to the object of steps 0 and 1.
+    sched0.unpack_state<Opm::GConSale>( values, {0, 2, 4}, {0, 1, 0} );
+
+    BOOST_CHECK( sched[0].gconsale() == sched0[0].gconsale());
+    BOOST_CHECK( sched[3].gconsale() == sched0[2].gconsale());
+    BOOST_CHECK( sched[0].gconsale() == sched0[5].gconsale());
+
+    BOOST_CHECK( &sched0[1].gconsale() == &sched0[0].gconsale());
+    BOOST_CHECK( &sched0[3].gconsale() == &sched0[2].gconsale());
+    BOOST_CHECK( &sched0[4].gconsale() == &sched0[0].gconsale());
+    BOOST_CHECK( &sched0[5].gconsale() == &sched0[0].gconsale());
+}
+
+namespace {
+
+// Serializes the group related members of the report steps only.
+struct GroupMembers {
+    Schedule& sched;
+
+    template <class Serializer>
+    void serializeOp(Serializer& serializer) {
+        sched.pack_unpack<Opm::GConSale>(serializer);
+        sched.pack_unpack<Opm::GConSump>(serializer);
+        sched.pack_unpack_map<std::string, Opm::Group>(serializer);
+    }
+};
+
+}
+
+BOOST_AUTO_TEST_CASE(SerializeRestoresSharing) {
+    auto sched = make_schedule(GCONSALE_deck);
+    auto sched0 = make_schedule(deck0);
+
+    Opm::Serialization::MemPacker packer;
+    Opm::Serializer serializer(packer);
+    serializer.pack(GroupMembers{sched});
+    GroupMembers members0{sched0};
+    serializer.unpack(members0);
+
+    for (std::size_t step = 0; step < sched.size(); ++step) {
+        BOOST_CHECK( sched[step].gconsale() == sched0[step].gconsale() );
+        BOOST_CHECK( sched[step].gconsump() == sched0[step].gconsump() );
+        BOOST_CHECK( sched[step].groups == sched0[step].groups );
+        if (step == 0)
+            continue;
+
+        BOOST_CHECK_EQUAL( &sched[step].gconsale() == &sched[step - 1].gconsale(),
+                           &sched0[step].gconsale() == &sched0[step - 1].gconsale() );
+        BOOST_CHECK_EQUAL( &sched[step].gconsump() == &sched[step - 1].gconsump(),
+                           &sched0[step].gconsump() == &sched0[step - 1].gconsump() );
+
+        for (const auto& name : sched[step].groups.keys()) {
+            if (!sched[step - 1].groups.has(name))
+                continue;
+
+            const auto shared = sched[step].groups.get_ptr(name) == sched[step - 1].groups.get_ptr(name);
+            const auto shared0 = sched0[step].groups.get_ptr(name) == sched0[step - 1].groups.get_ptr(name);
+            BOOST_CHECK_MESSAGE( !shared || shared0, "Group " << name << " not shared at report step " << step );
+        }
+    }
+}
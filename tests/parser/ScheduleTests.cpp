@@ -89,6 +89,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -6008,4 +6009,350 @@ SOURCE
         BOOST_CHECK_EQUAL(rate23,
                       schedule.getUnits().to_si("Mass/Time", 0.01));
     }
-}
\ No newline at end of file
+}
+
+BOOST_AUTO_TEST_CASE(ScheduleMemoryUsage) {
+    const auto input = std::string { R"(
+START             -- 0
+19 JUN 2007 /
+
+SCHEDULE
+
+WELSPECS
+  'P1' 'G1' 1 1 1* 'OIL' /
+  'P2' 'G1' 2 2 1* 'OIL' /
+  'P3' 'G2' 3 3 1* 'OIL' /
+/
+
+WCONPROD
+  'P*' 'OPEN' 'ORAT' 1000.0 /
+/
+
+DATES             -- 1
+ 10 JUL 2007 /
+ 10 AUG 2007 /
+ 10 SEP 2007 /
+ 10 OCT 2007 /
+/
+
+WCONPROD
+  'P2' 'OPEN' 'ORAT' 500.0 /
+/
+
+DATES             -- 5
+ 10 NOV 2007 /
+ 10 DEC 2007 /
+ 10 JAN 2008 /
+/
+)" };
+
+    const auto schedule = make_schedule(input);
+    const auto usage = schedule.memory_usage();
+
+    BOOST_CHECK_EQUAL(usage.snapshots, schedule.size());
+
+    // Unchanged entries are shared between snapshots.  Report step 4 only
+    // replaces P2, so there are the three original wells plus the new P2,
+    // and the trie copied at step 4 holds the only other three elements.
+    for (std::size_t step = 1; step < schedule.size(); ++step) {
+        const auto& prev = schedule[step - 1];
+        const auto& curr = schedule[step];
+
+        BOOST_CHECK(curr.wells.get_ptr("P1") == prev.wells.get_ptr("P1"));
+        BOOST_CHECK(curr.wells.get_ptr("P3") == prev.wells.get_ptr("P3"));
+        BOOST_CHECK_EQUAL(curr.wells.get_ptr("P2") == prev.wells.get_ptr("P2"), step != 4);
+
+        for (const auto* group : { "FIELD", "G1", "G2" }) {
+            BOOST_CHECK(curr.groups.get_ptr(group) == prev.groups.get_ptr(group));
+        }
+    }
+
+    BOOST_CHECK_EQUAL(usage.wells.objects, std::size_t{4});
+    BOOST_CHECK_EQUAL(usage.wells.entries, std::size_t{6});
+
+    BOOST_CHECK_EQUAL(usage.groups.objects, std::size_t{3});
+    BOOST_CHECK_EQUAL(usage.groups.entries, std::size_t{3});
+
+    const auto total = usage.total();
+    BOOST_CHECK_EQUAL(total.objects, usage.wells.objects + usage.groups.objects +
+                      usage.vfpprod.objects + usage.vfpinj.objects);
+    BOOST_CHECK_GT(total.bytes, std::size_t{0});
+}
+
+BOOST_AUTO_TEST_CASE(ScheduleLazyLoading) {
+    const auto deck = Parser{}.parseString(R"(
+START             -- 0
+19 JUN 2007 /
+
+GRID
+PORO
+    1000*0.1 /
+PERMX
+    1000*1 /
+PERMY
+    1000*0.1 /
+PERMZ
+    1000*0.01 /
+
+SCHEDULE
+
+WELSPECS
+  'P1' 'G1' 1 1 1* 'OIL' /
+  'P2' 'G1' 2 2 1* 'OIL' /
+/
+
+COMPDAT
+  'P1' 1 1 1 2 'OPEN' /
+/
+
+DATES             -- 1
+ 10 JUL 2007 /
+ 10 AUG 2007 /
+/
+
+WELSPECS
+  'P3' 'G2' 3 3 1* 'OIL' /
+/
+
+COMPDAT
+  'P3' 3 3 1 3 'OPEN' /
+/
+
+WCONPROD
+  'P*' 'OPEN' 'ORAT' 1000.0 /
+/
+
+DATES             -- 3
+ 10 SEP 2007 /
+ 10 OCT 2007 /
+/
+)");
+
+    const EclipseGrid grid(10, 10, 10);
+    const TableManager table (deck);
+    const FieldPropsManager fp(deck, Phases{true, true, true}, grid, table);
+    const Runspec runspec (deck);
+
+    const auto python = std::make_shared<Python>();
+    const auto eager = Schedule { deck, grid, fp, runspec, python };
+
+    auto parseContext = ParseContext{};
+    parseContext.setLazyScheduleLoading(true);
+    auto errors = ErrorGuard{};
+
+    auto lazy = Schedule { deck, grid, fp, runspec, parseContext, errors, python };
+
+    BOOST_CHECK_EQUAL(lazy.size(), eager.size());
+    BOOST_CHECK_EQUAL(lazy.numLoadedSteps(), std::size_t{1});
+    BOOST_CHECK_EQUAL(eager.numLoadedSteps(), eager.size());
+
+    // Time queries do not need to load the report steps.
+    for (std::size_t report_step = 0; report_step < eager.size(); ++report_step) {
+        BOOST_CHECK_EQUAL(lazy.simTime(report_step), eager.simTime(report_step));
+        BOOST_CHECK_EQUAL(lazy.seconds(report_step), eager.seconds(report_step));
+    }
+    BOOST_CHECK_EQUAL(lazy.stepLength(1), eager.stepLength(1));
+    BOOST_CHECK_EQUAL(lazy.numLoadedSteps(), std::size_t{1});
+
+    BOOST_CHECK(! lazy.hasWell("P3", 1));
+    BOOST_CHECK_EQUAL(lazy.numLoadedSteps(), std::size_t{2});
+
+    const auto& p3 = lazy.getWell("P3", 3);
+    BOOST_CHECK_EQUAL(lazy.numLoadedSteps(), std::size_t{4});
+    BOOST_CHECK_EQUAL(lazy.memory_usage().snapshots, std::size_t{4});
+    BOOST_CHECK_EQUAL(p3.getConnections().size(), std::size_t{3});
+
+    // The reference must stay valid when the remaining steps are loaded.
+    BOOST_CHECK_EQUAL(lazy.getWellsatEnd().size(), std::size_t{3});
+    BOOST_CHECK_EQUAL(lazy.numLoadedSteps(), lazy.size());
+    BOOST_CHECK_EQUAL(p3.getConnections().size(), std::size_t{3});
+
+    BOOST_CHECK_MESSAGE(lazy == eager, "Lazily loaded Schedule must equal eagerly loaded Schedule");
+
+    // Runtime updates only load the report step following the updated one.
+    {
+        auto updated_eager = eager;
+        auto updated_lazy = Schedule { deck, grid, fp, runspec, parseContext, errors, python };
+
+        updated_eager.stop_well("P1", 1);
+        updated_lazy.stop_well("P1", 1);
+        BOOST_CHECK_EQUAL(updated_lazy.numLoadedSteps(), std::size_t{3});
+        BOOST_CHECK(updated_lazy.getWell("P1", 1).getStatus() == Well::Status::STOP);
+
+        BOOST_CHECK_MESSAGE(updated_lazy == updated_eager, "Updated lazy Schedule must equal updated eager Schedule");
+    }
+
+    // Concurrent queries loading different report steps.
+    {
+        const auto concurrent = Schedule { deck, grid, fp, runspec, parseContext, errors, python };
+
+        std::vector<std::size_t> num_wells(eager.size(), 0);
+        std::vector<std::thread> threads;
+        for (std::size_t report_step = 0; report_step < eager.size(); ++report_step) {
+            threads.emplace_back([&concurrent, &num_wells, report_step]()
+            {
+                num_wells[report_step] = concurrent.getWells(report_step).size();
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (std::size_t report_step = 0; report_step < eager.size(); ++report_step) {
+            BOOST_CHECK_EQUAL(num_wells[report_step], eager.getWells(report_step).size());
+        }
+        BOOST_CHECK_EQUAL(concurrent.numLoadedSteps(), concurrent.size());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(LazyScheduleLoadingOwnsInput)
+{
+    const auto make_deck = [](const std::string& p3_ij)
+    {
+        return Parser{}.parseString(fmt::format(R"(
+START             -- 0
+19 JUN 2007 /
+
+GRID
+PORO
+    1000*0.1 /
+PERMX
+    1000*1 /
+PERMY
+    1000*0.1 /
+PERMZ
+    1000*0.01 /
+
+SCHEDULE
+
+WELSPECS
+  'P1' 'G1' 1 1 1* 'OIL' /
+/
+
+COMPDAT
+  'P1' 1 1 1 2 'OPEN' /
+/
+
+DATES             -- 1
+ 10 JUL 2007 /
+/
+
+WELSPECS
+  'P3' 'G2' 3 3 1* 'OIL' /
+/
+
+COMPDAT
+  'P3' {} 1 3 'OPEN' /
+/
+
+DATES             -- 2
+ 10 AUG 2007 /
+/
+)", p3_ij));
+    };
+
+    const auto python = std::make_shared<Python>();
+
+    auto parseContext = ParseContext{};
+    parseContext.setLazyScheduleLoading(true);
+
+    // The second deck connects P3 at its well head, which needs the grid
+    // when the report step is loaded.
+    for (const auto* p3_ij : { "3 3", "1* 1*" }) {
+        const auto deck = make_deck(p3_ij);
+        const Runspec runspec (deck);
+
+        auto grid = std::make_unique<EclipseGrid>(10, 10, 10);
+        const TableManager table (deck);
+        auto fp = std::make_unique<FieldPropsManager>(deck, Phases{true, true, true}, *grid, table);
+
+        const auto eager = Schedule { deck, *grid, *fp, runspec, python };
+
+        auto errors = ErrorGuard{};
+        const auto lazy = Schedule { deck, *grid, *fp, runspec, parseContext, errors, python };
+        BOOST_CHECK_EQUAL(lazy.numLoadedSteps(), std::size_t{1});
+
+        grid.reset();
+        fp.reset();
+
+        BOOST_CHECK_EQUAL(lazy.getWell("P3", 2).getConnections().size(), std::size_t{3});
+        BOOST_CHECK_MESSAGE(lazy == eager, "Lazy Schedule must not refer to the grid of the constructor");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(LazyScheduleLoadingDiagnostics)
+{
+    const auto make_deck = [](const std::string& well0, const std::string& well1)
+    {
+        return Parser{}.parseString(fmt::format(R"(
+START
+ 10 JAN 2007 /
+RUNSPEC
+DIMENS
+  10 10 10 /
+GRID
+DX
+    1000*0.25 /
+DY
+    1000*0.25 /
+DZ
+    1000*0.25 /
+TOPS
+    100*0.25 /
+
+SCHEDULE
+
+WELSPECS
+  '{}' 'G1' 1 1 1* 'OIL' /
+/
+
+DATES             -- 1
+ 10 JUL 2007 /
+/
+
+WELSPECS
+  '{}' 'G2' 3 3 1* 'OIL' /
+/
+
+DATES             -- 2
+ 10 AUG 2007 /
+/
+)", well0, well1));
+    };
+
+    const EclipseGrid grid(10, 10, 10);
+    const auto python = std::make_shared<Python>();
+
+    auto parseContext = ParseContext{};
+    parseContext.setLazyScheduleLoading(true);
+    parseContext.update(ParseContext::PARSE_WGNAME_SPACE, InputErrorAction::DELAYED_EXIT1);
+
+    // Errors in the report steps loaded by the constructor end up in the
+    // caller's ErrorGuard, just like with eager loading.
+    {
+        const auto deck = make_deck(" P1", "P2");
+        const TableManager table (deck);
+        const FieldPropsManager fp(deck, Phases{true, true, true}, grid, table);
+        const Runspec runspec (deck);
+
+        auto errors = ErrorGuard{};
+        const auto sched = Schedule { deck, grid, fp, runspec, parseContext, errors, python };
+        BOOST_CHECK_MESSAGE(static_cast<bool>(errors), "Error in report step 0 must be reported to the caller");
+        errors.clear();
+    }
+
+    // Errors in the report steps loaded on demand are reported by throwing.
+    {
+        const auto deck = make_deck("P1", " P2");
+        const TableManager table (deck);
+        const FieldPropsManager fp(deck, Phases{true, true, true}, grid, table);
+        const Runspec runspec (deck);
+
+        auto errors = ErrorGuard{};
+        const auto sched = Schedule { deck, grid, fp, runspec, parseContext, errors, python };
+        BOOST_CHECK(! errors);
+        BOOST_CHECK_NO_THROW(sched.getWells(0));
+        BOOST_CHECK_THROW(sched.getWells(1), std::runtime_error);
+    }
+}
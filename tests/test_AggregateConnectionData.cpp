@@ -891,4 +891,42 @@ BOOST_AUTO_TEST_CASE(InactiveCell) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(Reset_Matches_Fresh_Capture)
+{
+    auto simCase = SimulationCase{first_sim()};
+    const auto rptStep = std::size_t{1};
+    const auto ih = MockIH {static_cast<int>(simCase.sched.getWells(rptStep).size())};
+    const auto& [wrc, sum_state] = wr(simCase.sched);
+
+    auto reused = Opm::RestartIO::Helpers::AggregateConnectionData{ih.value};
+    reused.captureDeclaredConnData(simCase.sched, simCase.grid, simCase.es.getUnits(),
+                                   wrc, sum_state, rptStep);
+
+    // Deactivate the cell of connection 2 to leave one connection fewer
+    // than in the previous capture.
+    std::vector<int> actnum(500, 1);
+    actnum[simCase.grid.getGlobalIndex(2,4,1)] = 0;
+    simCase.grid.resetACTNUM(actnum);
+
+    reused.reset(ih.value);
+    reused.captureDeclaredConnData(simCase.sched, simCase.grid, simCase.es.getUnits(),
+                                   wrc, sum_state, rptStep);
+
+    auto fresh = Opm::RestartIO::Helpers::AggregateConnectionData{ih.value};
+    fresh.captureDeclaredConnData(simCase.sched, simCase.grid, simCase.es.getUnits(),
+                                  wrc, sum_state, rptStep);
+
+    BOOST_CHECK(reused.getIConn() == fresh.getIConn());
+    BOOST_CHECK(reused.getSConn() == fresh.getSConn());
+    BOOST_CHECK(reused.getXConn() == fresh.getXConn());
+
+    // Resetting to different dimensions resizes the arrays.
+    const auto ih5 = MockIH{ 5 };
+    reused.reset(ih5.value);
+
+    BOOST_CHECK_EQUAL(reused.getIConn().size(), ih5.nwells * ih5.ncwmax * ih5.niconz);
+    BOOST_CHECK_EQUAL(reused.getSConn().size(), ih5.nwells * ih5.ncwmax * ih5.nsconz);
+    BOOST_CHECK_EQUAL(reused.getXConn().size(), ih5.nwells * ih5.ncwmax * ih5.nxconz);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -25,6 +25,7 @@
 #include <opm/output/eclipse/AggregateWellData.hpp>
 #include <opm/output/eclipse/AggregateConnectionData.hpp>
 #include <opm/output/eclipse/AggregateGroupData.hpp>
+#include <opm/output/eclipse/AggregateMSWData.hpp>
 
 #include <opm/output/eclipse/VectorItems/intehead.hpp>
 #include <opm/output/eclipse/VectorItems/well.hpp>
@@ -56,12 +57,20 @@
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <algorithm>
 #include <exception>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include <fmt/format.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "tests/WorkArea.hpp"
 
 struct MockIH
@@ -650,6 +659,84 @@ TSTEP            -- 3
         return Opm::Parser{}.parseFile(fname);
     }
 
+    // Vertical wells W01, W02, ... in separate columns of a 10x10x3 grid.
+    // The first 'numMSW' wells are multi-segment wells.
+    Opm::Deck many_wells_sim(const int numWells, const int numMSW)
+    {
+        auto input = std::string { R"~(
+RUNSPEC
+OIL
+GAS
+WATER
+DIMENS
+ 10 10 3 /
+WELLDIMS
+ 100 3 2 100 /
+WSEGDIMS
+ 10 10 2 /
+START
+ 1 'JAN' 2020 /
+
+GRID
+DXV
+10*100. /
+DYV
+10*100. /
+DZV
+3*10. /
+TOPS
+100*2000. /
+PORO
+300*0.2 /
+PERMX
+300*100. /
+PERMY
+300*100. /
+PERMZ
+300*10. /
+
+SCHEDULE
+)~" };
+
+        auto welspecs = std::string { "WELSPECS\n" };
+        auto compdat = std::string { "COMPDAT\n" };
+        auto segments = std::string{};
+
+        for (auto w = 0; w < numWells; ++w) {
+            const auto name = fmt::format("W{:02d}", w + 1);
+            const auto i = 1 + w % 10;
+            const auto j = 1 + w / 10;
+
+            welspecs += fmt::format(" '{}' 'G1' {} {} 1* 'OIL' /\n", name, i, j);
+            compdat += fmt::format(" '{}' {} {} 1 3 'OPEN' 2* 0.2 /\n", name, i, j);
+
+            if (w < numMSW) {
+                segments += fmt::format(R"~(WELSEGS
+ '{0}' 2000 0 1* 'INC' 'HF-' 'HO' /
+ 2 4 1 1 10 10 0.2 1.0E-5 /
+/
+COMPSEGS
+ '{0}' /
+ {1} {2} 1 1  0 10 /
+ {1} {2} 2 1 10 20 /
+ {1} {2} 3 1 20 30 /
+/
+)~", name, i, j);
+            }
+        }
+
+        input += welspecs + "/\n" + compdat + "/\n" + segments + R"~(
+WCONPROD
+ 'W*' 'OPEN' 'ORAT' 100.0 /
+/
+
+TSTEP
+10 10 /
+)~";
+
+        return Opm::Parser{}.parseString(input);
+    }
+
     Opm::SummaryState sim_state()
     {
         auto state = Opm::SummaryState{Opm::TimeService::now()};
@@ -1821,4 +1908,85 @@ BOOST_AUTO_TEST_CASE(WELL_POD)
     BOOST_CHECK_EQUAL(conn1.ijk[2], 1);
 }
 
+// --------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE (Parallel_Matches_Serial)
+{
+    // More wells, and more multi-segment wells, than the thresholds for
+    // building the restart arrays of the wells concurrently.
+    const auto simCase = SimulationCase{many_wells_sim(20, 6)};
+    const auto& units = simCase.es.getUnits();
+    const auto rptStep = std::size_t{1};
+
+    const auto ih = Opm::RestartIO::Helpers::
+        createInteHead(simCase.es, simCase.grid, simCase.sched, 0.0,
+                       rptStep, rptStep + 1, rptStep);
+
+    const auto smry = sim_state();
+    const auto xw = Opm::data::Wells{};
+
+    const auto capture = [&]()
+    {
+        auto awd = Opm::RestartIO::Helpers::AggregateWellData{ih};
+        awd.captureDeclaredWellData(simCase.sched, simCase.es.tracer(), rptStep,
+                                    Opm::Action::State{}, Opm::WellTestState{},
+                                    smry, ih);
+        awd.captureDynamicWellData(simCase.sched, simCase.es.tracer(),
+                                   rptStep, xw, smry);
+
+        auto acd = Opm::RestartIO::Helpers::AggregateConnectionData{ih};
+        acd.captureDeclaredConnData(simCase.sched, simCase.grid, units,
+                                    xw, smry, rptStep);
+
+        auto amswd = Opm::RestartIO::Helpers::AggregateMSWData{ih};
+        amswd.captureDeclaredMSWData(simCase.sched, rptStep, units, ih,
+                                     simCase.grid, smry, xw);
+
+        return std::make_tuple(awd, acd, amswd);
+    };
+
+#ifdef _OPENMP
+    const auto maxThreads = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif
+
+    const auto [serialWell, serialConn, serialMSW] = capture();
+
+#ifdef _OPENMP
+    omp_set_num_threads(std::max(maxThreads, 4));
+#endif
+
+    const auto [parWell, parConn, parMSW] = capture();
+
+#ifdef _OPENMP
+    omp_set_num_threads(maxThreads);
+#endif
+
+    const auto check = [](const auto& expect, const auto& actual)
+    {
+        BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(),
+                                      expect.begin(), expect.end());
+    };
+
+    check(serialWell.getIWell(), parWell.getIWell());
+    check(serialWell.getSWell(), parWell.getSWell());
+    check(serialWell.getXWell(), parWell.getXWell());
+
+    check(serialConn.getIConn(), parConn.getIConn());
+    check(serialConn.getSConn(), parConn.getSConn());
+    check(serialConn.getXConn(), parConn.getXConn());
+
+    check(serialMSW.getISeg(), parMSW.getISeg());
+    check(serialMSW.getRSeg(), parMSW.getRSeg());
+    check(serialMSW.getILBs(), parMSW.getILBs());
+    check(serialMSW.getILBr(), parMSW.getILBr());
+
+    // The multi-segment wells are included.
+    using Ix = ::Opm::RestartIO::Helpers::VectorItems::IWell::index;
+    const auto niwelz = static_cast<std::size_t>
+        (ih[::Opm::RestartIO::Helpers::VectorItems::intehead::NIWELZ]);
+    BOOST_CHECK_EQUAL(parWell.getIWell()[5*niwelz + Ix::MsWID], 6);
+    BOOST_CHECK_EQUAL(parWell.getIWell()[6*niwelz + Ix::MsWID], 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
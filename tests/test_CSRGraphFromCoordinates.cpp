@@ -23,8 +23,14 @@
 
 #include <opm/common/utility/CSRGraphFromCoordinates.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <map>
+#include <numeric>
+#include <random>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(No_Self_Connections)
 
@@ -3004,3 +3010,135 @@ BOOST_AUTO_TEST_CASE(Linear_4x1x1_Symmetric_Multiple_Repeated_Add_3x1x1_Expand_N
 BOOST_AUTO_TEST_SUITE_END()     // Tracked
 
 BOOST_AUTO_TEST_SUITE_END()     // Permit_Self_Connections
+
+// ---------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(Large_Graphs)
+
+namespace {
+    // Large enough to exercise the multi-threaded build when available.
+    using CSRGraph = Opm::utility::CSRGraphFromCoordinates<int, true>;
+
+    using Pairs = std::vector<std::pair<int, int>>;
+
+    Pairs randomPairs(const int numVertices,
+                      const int numPairs,
+                      const unsigned int seed)
+    {
+        auto rng = std::mt19937{seed};
+        auto vertex = std::uniform_int_distribution<int>{0, numVertices - 1};
+
+        auto pairs = Pairs{};
+        pairs.reserve(numPairs);
+
+        for (auto n = 0; n < numPairs; ++n) {
+            const auto v1 = vertex(rng);
+            const auto v2 = vertex(rng);
+
+            if (v1 != v2) {
+                pairs.emplace_back(v1, v2);
+            }
+        }
+
+        return pairs;
+    }
+
+    void checkGraph(const CSRGraph& graph,
+                    const Pairs&    pairs,
+                    const int       numVertices)
+    {
+        auto edges = std::map<std::pair<int, int>, int>{};
+        for (const auto& pair : pairs) {
+            edges.emplace(pair, 0);
+        }
+
+        auto expectIA = std::vector<std::size_t>(numVertices + 1, 0);
+        auto expectJA = std::vector<int>{};
+        {
+            auto edgeID = 0;
+            for (auto& [edge, id] : edges) {
+                id = edgeID++;
+                expectIA[edge.first + 1] += 1;
+                expectJA.push_back(edge.second);
+            }
+        }
+
+        std::partial_sum(expectIA.begin(), expectIA.end(), expectIA.begin());
+
+        auto expectMap = std::vector<std::size_t>{};
+        expectMap.reserve(pairs.size());
+        for (const auto& pair : pairs) {
+            expectMap.push_back(edges.at(pair));
+        }
+
+        BOOST_CHECK_EQUAL(graph.numVertices(), static_cast<std::size_t>(numVertices));
+        BOOST_CHECK_EQUAL(graph.numEdges(), edges.size());
+
+        const auto& ia = graph.startPointers();
+        BOOST_CHECK(std::equal(ia.begin(), ia.end(), expectIA.begin(), expectIA.end()));
+
+        const auto& ja = graph.columnIndices();
+        BOOST_CHECK(std::equal(ja.begin(), ja.end(), expectJA.begin(), expectJA.end()));
+
+        const auto& nzMap = graph.compressedIndexMap();
+        BOOST_CHECK(std::equal(nzMap.begin(), nzMap.end(), expectMap.begin(), expectMap.end()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Few_Vertices_Many_Repeats)
+{
+    // Inter-region flow like.  Many contributions to few unique edges.
+    const auto numVertices = 17;
+    const auto pairs = randomPairs(numVertices, 500'000, 1234);
+
+    auto graph = CSRGraph{};
+    for (const auto& [v1, v2] : pairs) {
+        graph.addConnection(v1, v2);
+    }
+
+    graph.compress(numVertices);
+
+    checkGraph(graph, pairs, numVertices);
+}
+
+BOOST_AUTO_TEST_CASE(Many_Vertices)
+{
+    // Cell connection like.  Few contributions per vertex.
+    const auto numVertices = 100'000;
+    const auto pairs = randomPairs(numVertices, 600'000, 5678);
+
+    auto graph = CSRGraph{};
+    for (const auto& [v1, v2] : pairs) {
+        graph.addConnection(v1, v2);
+    }
+
+    graph.compress(numVertices);
+
+    checkGraph(graph, pairs, numVertices);
+}
+
+BOOST_AUTO_TEST_CASE(Expand_Existing_Index_Map)
+{
+    const auto numVertices = 1'000;
+
+    auto pairs = randomPairs(numVertices / 2, 300'000, 42);
+
+    auto graph = CSRGraph{};
+    for (const auto& [v1, v2] : pairs) {
+        graph.addConnection(v1, v2);
+    }
+
+    graph.compress(numVertices / 2);
+
+    const auto morePairs = randomPairs(numVertices, 300'000, 4242);
+    for (const auto& [v1, v2] : morePairs) {
+        graph.addConnection(v1, v2);
+    }
+
+    graph.compress(numVertices, true);
+
+    pairs.insert(pairs.end(), morePairs.begin(), morePairs.end());
+    checkGraph(graph, pairs, numVertices);
+}
+
+BOOST_AUTO_TEST_SUITE_END()     // Large_Graphs
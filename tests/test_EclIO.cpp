@@ -26,6 +26,7 @@
 #include <iostream>
 #include <limits>
 #include <tuple>
+#include <type_traits>
 #include <cmath>
 #include <numeric>
 
@@ -412,6 +413,66 @@ BOOST_AUTO_TEST_CASE(TestEcl_getList) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestEcl_getElements) {
+
+    // Arrays spanning several data blocks.  Compare selected elements,
+    // read without loading the full array, to the full array.
+
+    std::vector<int> inte(2345);
+    std::vector<float> real(2345);
+    std::vector<double> doub(3001);
+
+    std::iota(inte.begin(), inte.end(), -17);
+    for (std::size_t i = 0; i < real.size(); i++)
+        real[i] = 0.5f*i;
+    for (std::size_t i = 0; i < doub.size(); i++)
+        doub[i] = 1.0e5 - 3.25*i;
+
+    const std::vector<std::size_t> elements {
+        0, 1, 2, 998, 999, 1000, 1001, 1500, 1999, 2000, 2344
+    };
+
+    const std::vector<std::size_t> doubElements {
+        5, 999, 1000, 2001, 2002, 2003, 3000
+    };
+
+    auto subset = [](const auto& vect, const std::vector<std::size_t>& elms) {
+        std::decay_t<decltype(vect)> result;
+        for (auto e : elms)
+            result.push_back(vect[e]);
+        return result;
+    };
+
+    WorkArea work;
+
+    for (const bool formatted : {false, true}) {
+        const std::string testFile = formatted ? "TEST.FDAT" : "TEST.DAT";
+
+        {
+            EclOutput eclTest(testFile, formatted);
+            eclTest.write("INTE", inte);
+            eclTest.write("REAL", real);
+            eclTest.write("DOUB", doub);
+        }
+
+        EclFile file1(testFile);
+
+        BOOST_CHECK(file1.getElements<int>(0, elements) == subset(inte, elements));
+        BOOST_CHECK(file1.getElements<float>(1, elements) == subset(real, elements));
+        BOOST_CHECK(file1.getElements<double>(2, doubElements) == subset(doub, doubElements));
+        BOOST_CHECK(file1.getElements<double>(2, {}).empty());
+
+        BOOST_CHECK_THROW(file1.getElements<int>(0, {5, 3}), std::invalid_argument);
+        BOOST_CHECK_THROW(file1.getElements<int>(0, {2345}), std::invalid_argument);
+        BOOST_CHECK_THROW(file1.getElements<double>(0, {1}), std::runtime_error);
+
+        // Already loaded arrays are sliced in memory.
+        file1.loadData();
+        BOOST_CHECK(file1.getElements<int>(0, elements) == subset(inte, elements));
+    }
+}
+
+
 BOOST_AUTO_TEST_CASE(TestEcl_Write_CHAR) {
     WorkArea work;
     std::string testFile1="TEST.FDAT";
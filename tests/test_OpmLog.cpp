@@ -28,6 +28,9 @@
 #include <stdexcept>
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 
 #include <opm/common/OpmLog/OpmLog.hpp>
@@ -168,6 +171,109 @@ BOOST_AUTO_TEST_CASE(LoggerDefaultTypesEnabled) {
     BOOST_CHECK_EQUAL( logger.enabledMessageTypes() , Log::DefaultMessageTypes);
 }
 
+BOOST_AUTO_TEST_CASE(Test_AsyncLogger) {
+    const int numThreads = 4;
+    const int numMessages = 1000;
+
+    Logger logger;
+    std::ostringstream log_stream;
+    auto counter = std::make_shared<CounterLog>();
+    auto streamLog = std::make_shared<StreamLog>( log_stream , Log::MessageType::Info );
+    logger.addBackend("COUNTER" , counter);
+    logger.addBackend("STREAM" , streamLog);
+
+    logger.setAsynchronous(true);
+    BOOST_CHECK( logger.isAsynchronous() );
+    {
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < numThreads; ++thread) {
+            threads.emplace_back([&logger, thread]()
+            {
+                for (int message = 0; message < numMessages; ++message)
+                    logger.addMessage( Log::MessageType::Info , std::to_string(thread) + " " + std::to_string(message));
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    // Error messages are written before the call returns.
+    logger.addMessage( Log::MessageType::Error , "Error");
+    BOOST_CHECK_EQUAL( 1U , counter->numMessages(Log::MessageType::Error) );
+    BOOST_CHECK_EQUAL( std::size_t(numThreads*numMessages) , counter->numMessages(Log::MessageType::Info) );
+
+    // The messages of each thread keep their order.
+    std::vector<int> next(numThreads, 0);
+    std::istringstream lines(log_stream.str());
+    int thread = 0, message = 0, numLines = 0;
+    while (lines >> thread >> message) {
+        BOOST_CHECK_EQUAL( message , next[thread]++ );
+        ++numLines;
+    }
+    BOOST_CHECK_EQUAL( numLines , numThreads*numMessages );
+
+    logger.addMessage( Log::MessageType::Warning , "Warning");
+    logger.setAsynchronous(false);
+    BOOST_CHECK( !logger.isAsynchronous() );
+    BOOST_CHECK_EQUAL( 1U , counter->numMessages(Log::MessageType::Warning) );
+}
+
+
+BOOST_AUTO_TEST_CASE(Test_AsyncLoggerLimits) {
+    Logger logger;
+    std::ostringstream log_stream;
+    auto streamLog = std::make_shared<StreamLog>( log_stream , Log::DefaultMessageTypes );
+    streamLog->setMessageLimiter(std::make_shared<MessageLimiter>(2));
+    logger.addBackend("STREAM" , streamLog);
+
+    logger.setAsynchronous(true);
+    for (int message = 0; message < 5; ++message)
+        logger.addTaggedMessage( Log::MessageType::Warning , "Tag" , "Warning");
+
+    // Looking up a backend waits for the pending messages.
+    auto stream = logger.getBackend<StreamLog>("STREAM");
+    BOOST_CHECK_EQUAL( log_stream.str() , "Warning\nWarning\nMessage limit reached for message tag: Tag\n");
+}
+
+
+namespace {
+
+class ThrowingLog: public LogBackend {
+public:
+    ThrowingLog() : LogBackend( Log::DefaultMessageTypes )
+    {}
+
+    void addMessageUnconditionally(int64_t /* messageType */, const std::string& message) override
+    {
+        throw std::runtime_error(message);
+    }
+};
+
+}
+
+BOOST_AUTO_TEST_CASE(Test_AsyncLoggerBackendFailure) {
+    Logger logger;
+    logger.addBackend("THROW" , std::make_shared<ThrowingLog>());
+
+    logger.setAsynchronous(true);
+    logger.addMessage( Log::MessageType::Warning , "First");
+    logger.addMessage( Log::MessageType::Warning , "Second");
+
+    // The first exception thrown on the logging thread is rethrown once.
+    try {
+        logger.flush();
+        BOOST_ERROR( "flush() must rethrow the exception of the backend" );
+    }
+    catch (const std::runtime_error& e) {
+        BOOST_CHECK_EQUAL( std::string{ e.what() } , "First" );
+    }
+    BOOST_CHECK_NO_THROW( logger.flush() );
+
+    logger.removeAllBackends();
+    logger.setAsynchronous(false);
+}
+
+
 BOOST_AUTO_TEST_CASE( CounterLogTesting) {
     CounterLog counter(Log::DefaultMessageTypes);
 
@@ -22,6 +22,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/input/eclipse/Schedule/Well/PAvgCalculator.hpp>
+#include <opm/input/eclipse/Schedule/Well/PAvgCalculatorCollection.hpp>
 
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
@@ -35,6 +36,8 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <memory>
+#include <stdexcept>
 #include <utility>
 #include <type_traits>
 #include <vector>
@@ -1635,3 +1638,131 @@ BOOST_AUTO_TEST_CASE(All_Specified)
 }
 
 BOOST_AUTO_TEST_SUITE_END() // Integration
+
+// ===========================================================================
+
+BOOST_AUTO_TEST_SUITE(Calculator_Collection)
+
+namespace {
+    void assignSources(const std::vector<std::size_t>& locations,
+                       const double                    offset,
+                       Opm::PAvgDynamicSourceData&     src)
+    {
+        using Span = std::remove_cv_t<
+            std::remove_reference_t<decltype(src[0])>>;
+        using Item = typename Span::Item;
+
+        for (const auto& loc : locations) {
+            src[loc]
+                .set(Item::Pressure, offset + 1234.0 + ((loc * 37) % 100))
+                .set(Item::PoreVol, 1.0 + ((loc * 13) % 7) / 4.0)
+                .set(Item::MixtureDensity, 0.1 + ((loc * 7) % 10) / 100.0);
+        }
+    }
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Batch_Matches_Individual_Wells)
+{
+    const auto dims = std::array { 10, 10, 3 };
+    const auto grid = shoeBox(dims);
+
+    // Vertical well in column (8,8) and horizontal well in (6..8,8,2).
+    // Wells share source locations around cell (8,8,2).
+    const auto wellConns = std::vector {
+        qfsProducer(dims, 0),
+        horizontalProducer_X(dims, 6, 3),
+    };
+
+    const auto controls = std::vector {
+        AveragingControls::defaults(),
+        Opm::PAvg { 0.875, 0.123, Opm::PAvg::DepthCorrection::RES, false },
+    };
+
+    const auto refDepth = std::vector { 2000.5, 2002.0 };
+    const auto gravity  = standardGravity();
+
+    auto calcs = Opm::PAvgCalculatorCollection{};
+    for (auto well = 0*wellConns.size(); well < wellConns.size(); ++well) {
+        calcs.setCalculator(well, std::make_unique<Opm::PAvgCalculator>(grid, wellConns[well]));
+    }
+
+    auto blockSource = Opm::PAvgDynamicSourceData { calcs.allWBPCells() };
+    assignSources(calcs.allWBPCells(), 0.0, blockSource);
+
+    auto connSource = std::vector<Opm::PAvgDynamicSourceData>{};
+    auto inputs = std::vector<Opm::PAvgCalculatorCollection::WellInputs>{};
+    for (auto well = 0*wellConns.size(); well < wellConns.size(); ++well) {
+        const auto conns = calcs[well].allWellConnections();
+        assignSources(conns, -10.0, connSource.emplace_back(conns));
+    }
+
+    for (auto well = 0*wellConns.size(); well < wellConns.size(); ++well) {
+        inputs.push_back({ &connSource[well], &controls[well], refDepth[well] });
+    }
+
+    calcs.inferBlockAveragePressures(blockSource, inputs, gravity);
+
+    using WBPMode = Opm::PAvgCalculator::Result::WBPMode;
+
+    for (auto well = 0*wellConns.size(); well < wellConns.size(); ++well) {
+        auto calc = Opm::PAvgCalculator { grid, wellConns[well] };
+
+        auto sources = Opm::PAvgCalculator::Sources{};
+        sources.wellBlocks(blockSource).wellConns(connSource[well]);
+
+        calc.inferBlockAveragePressures(sources, controls[well], gravity, refDepth[well]);
+
+        const auto& expect = calc.averagePressures();
+        const auto& actual = calcs[well].averagePressures();
+
+        for (const auto mode : { WBPMode::WBP, WBPMode::WBP4, WBPMode::WBP5, WBPMode::WBP9 }) {
+            BOOST_CHECK_EQUAL(actual.value(mode), expect.value(mode));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Batch_After_Pruning)
+{
+    const auto dims = std::array { 10, 10, 3 };
+    const auto grid = shoeBox(dims);
+
+    auto calcs = Opm::PAvgCalculatorCollection{};
+    calcs.setCalculator(0, std::make_unique<Opm::PAvgCalculator>(grid, qfsProducer(dims, 0)));
+
+    const auto connSource = Opm::PAvgDynamicSourceData { calcs[0].allWellConnections() };
+    const auto controls = AveragingControls::defaults();
+    const auto inputs = std::vector<Opm::PAvgCalculatorCollection::WellInputs> {
+        { &connSource, &controls, 2000.5 },
+    };
+
+    {
+        auto blockSource = Opm::PAvgDynamicSourceData { calcs.allWBPCells() };
+        assignSources(calcs.allWBPCells(), 0.0, blockSource);
+
+        calcs.inferBlockAveragePressures(blockSource, inputs, standardGravity());
+    }
+
+    // Deactivate cells in column I=10.  Later batch calculation must use
+    // the reduced source location set.
+    calcs.pruneInactiveWBPCells([&dims](const std::vector<std::size_t>& cells)
+    {
+        auto isActive = std::vector<bool>(cells.size());
+        std::transform(cells.begin(), cells.end(), isActive.begin(),
+                       [nx = static_cast<std::size_t>(dims[0])]
+                       (const std::size_t cell) { return (cell % nx) != nx - 1; });
+        return isActive;
+    });
+
+    const auto wbpCells = calcs.allWBPCells();
+    BOOST_CHECK_EQUAL(wbpCells.size(), std::size_t{3 * 6});
+
+    auto blockSource = Opm::PAvgDynamicSourceData { wbpCells };
+    assignSources(wbpCells, 0.0, blockSource);
+
+    BOOST_CHECK_NO_THROW(calcs.inferBlockAveragePressures(blockSource, inputs, standardGravity()));
+
+    BOOST_CHECK_THROW(calcs.inferBlockAveragePressures(blockSource, {}, standardGravity()),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Calculator_Collection
@@ -0,0 +1,211 @@
+/*
+  Copyright 2024 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE Persistent_Map
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/PersistentMap.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+namespace {
+    // Degenerate hash function to exercise full hash collisions.
+    struct ConstantHash
+    {
+        std::size_t operator()(const int) const { return 42; }
+    };
+
+    // Hash function which makes the two lowest trie levels collide.
+    struct ShiftedHash
+    {
+        std::size_t operator()(const int i) const
+        {
+            return static_cast<std::size_t>(i) << 10;
+        }
+    };
+
+    template <typename Map>
+    std::map<typename Map::value_type::first_type,
+             typename Map::value_type::second_type>
+    asStdMap(const Map& m)
+    {
+        auto result = std::map<typename Map::value_type::first_type,
+                               typename Map::value_type::second_type>{};
+
+        for (const auto& [key, value] : m) {
+            result.emplace(key, value);
+        }
+
+        return result;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+    const auto m = Opm::utility::PersistentMap<std::string, int>{};
+
+    BOOST_CHECK_EQUAL(m.size(), std::size_t{0});
+    BOOST_CHECK_MESSAGE(m.empty(), "Default constructed map must be empty");
+    BOOST_CHECK_MESSAGE(m.begin() == m.end(), "Empty map must have begin() == end()");
+    BOOST_CHECK_MESSAGE(m.find("W1") == nullptr, "Empty map must not have element W1");
+    BOOST_CHECK_THROW(m.at("W1"), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(Insert_And_Replace)
+{
+    auto m = Opm::utility::PersistentMap<std::string, int>{};
+
+    m.insert_or_assign("W1", 1);
+    m.insert_or_assign("W2", 2);
+    m.insert_or_assign("W3", 3);
+
+    BOOST_CHECK_EQUAL(m.size(), std::size_t{3});
+    BOOST_CHECK_EQUAL(m.at("W1"), 1);
+    BOOST_CHECK_EQUAL(m.at("W2"), 2);
+    BOOST_CHECK_EQUAL(m.at("W3"), 3);
+
+    m.insert_or_assign("W2", 22);
+
+    BOOST_CHECK_EQUAL(m.size(), std::size_t{3});
+    BOOST_CHECK_EQUAL(m.at("W2"), 22);
+    BOOST_CHECK_MESSAGE(! m.contains("W4"), "Map must not have element W4");
+}
+
+BOOST_AUTO_TEST_CASE(Copies_Are_Independent)
+{
+    auto m1 = Opm::utility::PersistentMap<int, int>{};
+    for (auto i = 0; i < 1000; ++i) {
+        m1.insert_or_assign(i, i);
+    }
+
+    auto m2 = m1;
+    BOOST_CHECK_MESSAGE(m2.sharesStructure(m1), "Unmodified copy must share structure");
+
+    m2.insert_or_assign(17, -17);
+    m2.insert_or_assign(1000, 1000);
+
+    BOOST_CHECK_MESSAGE(! m2.sharesStructure(m1), "Modified copy must not share root");
+
+    BOOST_CHECK_EQUAL(m1.size(), std::size_t{1000});
+    BOOST_CHECK_EQUAL(m2.size(), std::size_t{1001});
+
+    BOOST_CHECK_EQUAL(m1.at(17), 17);
+    BOOST_CHECK_EQUAL(m2.at(17), -17);
+    BOOST_CHECK_MESSAGE(! m1.contains(1000), "Original map must not see insertion into copy");
+    BOOST_CHECK_EQUAL(m2.at(1000), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(Iteration_Visits_All_Elements)
+{
+    auto m = Opm::utility::PersistentMap<int, int>{};
+    auto expect = std::map<int, int>{};
+
+    for (auto i = 0; i < 5000; ++i) {
+        m.insert_or_assign(3 * i, i);
+        expect.emplace(3 * i, i);
+    }
+
+    const auto actual = asStdMap(m);
+
+    BOOST_CHECK_EQUAL(actual.size(), m.size());
+    BOOST_CHECK_MESSAGE(actual == expect, "Iteration must visit each element exactly once");
+}
+
+BOOST_AUTO_TEST_CASE(Partial_Hash_Collisions)
+{
+    auto m = Opm::utility::PersistentMap<int, int, ShiftedHash>{};
+
+    for (auto i = 0; i < 100; ++i) {
+        m.insert_or_assign(i, 2 * i);
+    }
+
+    BOOST_CHECK_EQUAL(m.size(), std::size_t{100});
+
+    for (auto i = 0; i < 100; ++i) {
+        BOOST_CHECK_EQUAL(m.at(i), 2 * i);
+    }
+
+    BOOST_CHECK_EQUAL(asStdMap(m).size(), std::size_t{100});
+}
+
+BOOST_AUTO_TEST_CASE(Full_Hash_Collisions)
+{
+    auto m = Opm::utility::PersistentMap<int, int, ConstantHash>{};
+
+    for (auto i = 0; i < 10; ++i) {
+        m.insert_or_assign(i, i);
+    }
+
+    auto m2 = m;
+    m2.insert_or_assign(5, 50);
+
+    BOOST_CHECK_EQUAL(m.size(), std::size_t{10});
+    BOOST_CHECK_EQUAL(m2.size(), std::size_t{10});
+    BOOST_CHECK_EQUAL(m.at(5), 5);
+    BOOST_CHECK_EQUAL(m2.at(5), 50);
+    BOOST_CHECK_MESSAGE(! m.contains(10), "Map must not have element 10");
+    BOOST_CHECK_EQUAL(asStdMap(m2).size(), std::size_t{10});
+}
+
+BOOST_AUTO_TEST_CASE(Memory_Usage_Counts_Shared_Nodes_Once)
+{
+    using Map = Opm::utility::PersistentMap<int, std::shared_ptr<int>>;
+
+    auto snapshots = std::vector<Map>(1);
+    for (auto i = 0; i < 5000; ++i) {
+        snapshots.front().insert_or_assign(i, std::make_shared<int>(i));
+    }
+
+    for (auto step = 1; step < 100; ++step) {
+        snapshots.push_back(snapshots.back());
+        snapshots.back().insert_or_assign(step, std::make_shared<int>(-step));
+    }
+
+    auto single = Opm::utility::PersistentMapMemoryUsage{};
+    {
+        auto seen = std::unordered_set<const void*>{};
+        snapshots.front().accumulateMemoryUsage(seen, single);
+    }
+
+    auto all = Opm::utility::PersistentMapMemoryUsage{};
+    auto objects = std::unordered_set<const void*>{};
+    {
+        auto seen = std::unordered_set<const void*>{};
+        for (const auto& snapshot : snapshots) {
+            snapshot.accumulateMemoryUsage(seen, all, [&objects](const auto& elm)
+            {
+                objects.insert(elm.second.get());
+            });
+        }
+    }
+
+    BOOST_CHECK_EQUAL(single.entries, std::size_t{5000});
+    BOOST_CHECK_EQUAL(objects.size(), std::size_t{5000 + 99});
+
+    // Each snapshot replaces one element, so each snapshot adds at most one
+    // new node per trie level.
+    BOOST_CHECK_LE(all.nodes, single.nodes + 99*4);
+    BOOST_CHECK_LT(all.entries, 2 * single.entries);
+}
@@ -796,6 +796,77 @@ BOOST_AUTO_TEST_CASE(ExtraData_content) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(Load_Partition) {
+    namespace OS = ::Opm::EclIO::OutputStream;
+
+    WorkArea test_area("test_Restart");
+    test_area.copyIn("BASE_SIM.DATA");
+    Setup setup("BASE_SIM.DATA");
+
+    Action::State action_state;
+    WellTestState wtest_state;
+    UDQState udq_state(10);
+    const auto num_cells = setup.grid.getNumActive();
+    auto aquiferData = std::optional<Opm::RestartIO::Helpers::AggregateAquiferData>{std::nullopt};
+    const auto sumState = sim_state(setup.schedule);
+    const auto outputDir = test_area.currentWorkingDirectory();
+
+    for (const bool write_double : {false, true}) {
+        {
+            const auto seqnum = 1;
+            auto rstFile = OS::Restart {
+                OS::ResultSet { outputDir, "FILE" }, seqnum,
+                OS::Formatted { false }, OS::Unified{ true }
+            };
+
+            RestartIO::save(rstFile, seqnum, 100,
+                            RestartValue(mkSolution(num_cells), mkWells(), mkGroups(), {}),
+                            setup.es, setup.grid, setup.schedule, action_state,
+                            wtest_state, sumState, udq_state, aquiferData,
+                            write_double);
+        }
+
+        const auto rstFile = OS::outputFileName({outputDir, "FILE"}, "UNRST");
+
+        const auto keys = std::vector<RestartKey> {
+            {"PRESSURE", UnitSystem::measure::pressure},
+            {"RS", UnitSystem::measure::identity},
+            {"RV", UnitSystem::measure::identity},
+            {"NO", UnitSystem::measure::identity, false},
+        };
+
+        auto st_full = sim_state(setup.schedule);
+        const auto full = RestartIO::load(rstFile, 1, action_state, st_full, keys,
+                                          setup.es, setup.grid, setup.schedule);
+
+        const auto cells = std::vector<std::size_t> {
+            0, 1, 7, 8, 9, static_cast<std::size_t>(num_cells) - 1
+        };
+
+        auto st_part = sim_state(setup.schedule);
+        const auto part = RestartIO::loadPartition(rstFile, 1, action_state, st_part, keys,
+                                                   setup.es, setup.grid, setup.schedule, cells);
+
+        BOOST_CHECK(! part.solution.has("NO"));
+        for (const auto* key : {"PRESSURE", "RS", "RV"}) {
+            const auto& fullData = full.solution.data<double>(key);
+            const auto& partData = part.solution.data<double>(key);
+
+            BOOST_REQUIRE_EQUAL(partData.size(), cells.size());
+            for (std::size_t i = 0; i < cells.size(); ++i) {
+                BOOST_CHECK_EQUAL(partData[i], fullData[cells[i]]);
+            }
+        }
+
+        BOOST_CHECK_EQUAL(part.wells.size(), full.wells.size());
+
+        BOOST_CHECK_THROW(RestartIO::loadPartition(rstFile, 1, action_state, st_part, keys,
+                                                   setup.es, setup.grid, setup.schedule,
+                                                   {3, 2}),
+                          std::invalid_argument);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(STORE_THPRES) {
     namespace OS = ::Opm::EclIO::OutputStream;
 
@@ -0,0 +1,243 @@
+/*
+  Copyright 2024 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE ScopedTimer_Tests
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/ScopedTimer.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include <opm/json/JsonObject.hpp>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Opm;
+
+namespace {
+
+struct TimingFixture
+{
+    TimingFixture()
+    {
+        Timing::reset();
+        Timing::enable(true);
+    }
+
+    ~TimingFixture()
+    {
+        Timing::enable(false);
+        Timing::reset();
+    }
+};
+
+Json::JsonObject report()
+{
+    std::ostringstream os;
+    Timing::writeReport(os);
+    return Json::JsonObject { os.str() };
+}
+
+Json::JsonObject trace()
+{
+    std::ostringstream os;
+    Timing::writeChromeTrace(os);
+    return Json::JsonObject { os.str() };
+}
+
+Json::JsonObject child(const Json::JsonObject& node, const std::string& name)
+{
+    const auto children = node.get_item("children");
+    for (std::size_t i = 0; i < children.size(); ++i) {
+        auto item = children.get_array_item(i);
+        if (item.get_string("name") == name)
+            return item;
+    }
+
+    throw std::invalid_argument("No child named " + name);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+    Timing::reset();
+    BOOST_CHECK(!Timing::enabled());
+    {
+        Timing::Scope timer{"outer"};
+        Timing::addCount(Timing::Counter::BytesRead, 10);
+    }
+
+    const auto root = report();
+    BOOST_CHECK(!root.has_item("children"));
+
+    const auto events = trace();
+    BOOST_CHECK_EQUAL(events.get_item("traceEvents").size(), 0U);
+}
+
+BOOST_FIXTURE_TEST_CASE(NestedScopes, TimingFixture)
+{
+    {
+        Timing::Scope outer{"outer"};
+        Timing::addCount(Timing::Counter::BytesRead, 100);
+        for (int i = 0; i < 3; ++i) {
+            Timing::Scope inner{"inner"};
+            Timing::addCount(Timing::Counter::BytesRead, 10);
+            Timing::addCount(Timing::Counter::BytesWritten, 1);
+        }
+        {
+            Timing::Scope other{"other"};
+            Timing::addCount(Timing::Counter::Allocations, 5);
+        }
+    }
+
+    // Not attributed to any scope.
+    Timing::addCount(Timing::Counter::BytesRead, 1000);
+
+    const auto root = report();
+    BOOST_CHECK_EQUAL(root.get_string("name"), "total");
+    BOOST_CHECK_EQUAL(root.get_item("children").size(), 1U);
+
+    const auto outer = child(root, "outer");
+    BOOST_CHECK_EQUAL(outer.get_int("calls"), 1);
+    BOOST_CHECK_EQUAL(outer.get_int("bytes_read"), 130);
+    BOOST_CHECK_EQUAL(outer.get_int("bytes_written"), 3);
+    BOOST_CHECK_EQUAL(outer.get_int("allocations"), 5);
+    BOOST_CHECK_EQUAL(outer.get_item("children").size(), 2U);
+
+    const auto inner = child(outer, "inner");
+    BOOST_CHECK_EQUAL(inner.get_int("calls"), 3);
+    BOOST_CHECK_EQUAL(inner.get_int("bytes_read"), 30);
+    BOOST_CHECK_EQUAL(inner.get_int("bytes_written"), 3);
+    BOOST_CHECK(inner.get_double("seconds") <= outer.get_double("seconds"));
+
+    const auto other = child(outer, "other");
+    BOOST_CHECK_EQUAL(other.get_int("calls"), 1);
+    BOOST_CHECK_EQUAL(other.get_int("allocations"), 5);
+    BOOST_CHECK_EQUAL(root.get_int("bytes_read"), 130);
+
+    const auto chromeTrace = trace();
+    const auto events = chromeTrace.get_item("traceEvents");
+    BOOST_CHECK_EQUAL(events.size(), 5U);
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        const auto event = events.get_array_item(i);
+        BOOST_CHECK_EQUAL(event.get_string("ph"), "X");
+        BOOST_CHECK(event.get_double("dur") >= 0.0);
+    }
+
+    const auto first = events.get_array_item(0);
+    BOOST_CHECK_EQUAL(first.get_string("name"), "outer");
+    BOOST_CHECK_EQUAL(first.get_item("args").get_int("bytes_read"), 130);
+}
+
+BOOST_FIXTURE_TEST_CASE(Threads, TimingFixture)
+{
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]()
+        {
+            for (int i = 0; i < 100; ++i) {
+                Timing::Scope timer{"work"};
+                Timing::addCount(Timing::Counter::BytesWritten, 2);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    const auto root = report();
+    const auto work = child(root, "work");
+    BOOST_CHECK_EQUAL(work.get_int("calls"), 400);
+    BOOST_CHECK_EQUAL(work.get_int("bytes_written"), 800);
+
+    const auto events = trace();
+    BOOST_CHECK_EQUAL(events.get_item("traceEvents").size(), 400U);
+}
+
+BOOST_FIXTURE_TEST_CASE(ResetWhileOpen, TimingFixture)
+{
+    {
+        Timing::Scope outer{"outer"};
+        {
+            Timing::Scope before{"before"};
+        }
+
+        Timing::reset();
+
+        Timing::Scope after{"after"};
+        Timing::addCount(Timing::Counter::BytesRead, 1);
+    }
+
+    const auto root = report();
+    BOOST_CHECK_EQUAL(root.get_item("children").size(), 1U);
+    BOOST_CHECK_EQUAL(child(root, "after").get_int("calls"), 1);
+}
+
+BOOST_AUTO_TEST_CASE(EclipseStateMembers)
+{
+    const auto deck = Parser{}.parseString(R"(
+RUNSPEC
+DIMENS
+  2 2 2 /
+OIL
+WATER
+GRID
+DX
+  8*100 /
+DY
+  8*100 /
+DZ
+  8*10 /
+TOPS
+  4*1000 /
+PORO
+  8*0.25 /
+PERMX
+  8*100 /
+PERMY
+  8*100 /
+PERMZ
+  8*10 /
+)");
+
+    const TimingFixture fixture{};
+    {
+        const EclipseState es { deck };
+    }
+
+    // The data members are built within the EclipseState scope.
+    const auto root = report();
+    BOOST_CHECK_EQUAL(root.get_item("children").size(), 1U);
+
+    const auto es = child(root, "EclipseState");
+    BOOST_CHECK_EQUAL(es.get_int("calls"), 1);
+    BOOST_CHECK_NO_THROW(child(es, "TableManager"));
+    BOOST_CHECK_NO_THROW(child(es, "EclipseGrid"));
+    BOOST_CHECK_NO_THROW(child(es, "FieldProps"));
+}
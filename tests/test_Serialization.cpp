@@ -24,9 +24,11 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <opm/common/OpmLog/KeywordLocation.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
@@ -38,10 +40,12 @@
 #include <opm/input/eclipse/EclipseState/EclipseConfig.hpp>
 #include <opm/input/eclipse/EclipseState/Runspec.hpp>
 #include <opm/input/eclipse/EclipseState/TracerConfig.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FaceDir.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/Fault.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FaultCollection.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FaultFace.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/MULTREGTScanner.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/NNC.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/TranCalculator.hpp>
@@ -50,6 +54,10 @@
 #include <opm/input/eclipse/EclipseState/InitConfig/FoamConfig.hpp>
 #include <opm/input/eclipse/EclipseState/InitConfig/InitConfig.hpp>
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
 #include <opm/input/eclipse/Schedule/GasLiftOpt.hpp>
 #include <opm/input/eclipse/Schedule/RSTConfig.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
@@ -335,6 +343,162 @@ TEST_FOR_TYPE(WellType)
 TEST_FOR_TYPE(WListManager)
 TEST_FOR_TYPE(WriteRestartFileEvents)
 
+namespace {
+
+class BufferSerializer : public Opm::Serializer<Opm::Serialization::MemPacker>
+{
+public:
+    using Opm::Serializer<Opm::Serialization::MemPacker>::Serializer;
+
+    const std::vector<char>& buffer() const
+    {
+        return this->m_buffer;
+    }
+
+    void setBuffer(const std::vector<char>& buffer)
+    {
+        this->m_buffer = buffer;
+    }
+};
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(SinglePass_Matches_TwoPass)
+{
+    const auto schedule = Opm::Schedule::serializationTestObject();
+    const auto tables = Opm::TableManager::serializationTestObject();
+
+    Opm::Serialization::MemPacker packer;
+    BufferSerializer twoPass(packer);
+    twoPass.pack(schedule, tables);
+
+    BufferSerializer singlePass(packer);
+    singlePass.packSinglePass(schedule, tables);
+
+    BOOST_CHECK_EQUAL(singlePass.position(), twoPass.position());
+    BOOST_CHECK(singlePass.buffer() == twoPass.buffer());
+
+    Opm::Schedule scheduleOut{};
+    Opm::TableManager tablesOut{};
+    singlePass.unpack(scheduleOut, tablesOut);
+    BOOST_CHECK_EQUAL(singlePass.position(), twoPass.position());
+    BOOST_CHECK(scheduleOut == schedule);
+    BOOST_CHECK(tablesOut == tables);
+}
+
+BOOST_AUTO_TEST_CASE(Stream_Matches_TwoPass)
+{
+    const auto schedule = Opm::Schedule::serializationTestObject();
+
+    Opm::Serialization::MemPacker packer;
+    BufferSerializer twoPass(packer);
+    twoPass.pack(schedule);
+
+    for (const std::size_t chunkSize : {std::size_t{1}, std::size_t{64}, std::size_t{1} << 20}) {
+        std::vector<char> streamed;
+        std::size_t numChunks = 0;
+        BufferSerializer stream(packer);
+        const auto size = stream.packStream([&streamed, &numChunks](const char* data, const std::size_t n)
+                                            {
+                                                streamed.insert(streamed.end(), data, data + n);
+                                                ++numChunks;
+                                            },
+                                            chunkSize, schedule);
+
+        BOOST_CHECK_EQUAL(size, streamed.size());
+        BOOST_CHECK(streamed == twoPass.buffer());
+        if (chunkSize >= streamed.size()) {
+            BOOST_CHECK_EQUAL(numChunks, std::size_t{1});
+        } else {
+            BOOST_CHECK(numChunks > 1);
+        }
+
+        BufferSerializer reader(packer);
+        reader.setBuffer(streamed);
+        Opm::Schedule out{};
+        reader.unpack(out);
+        BOOST_CHECK(out == schedule);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(LazyScheduleSerialization)
+{
+    const auto deck = Opm::Parser{}.parseString(R"(
+START             -- 0
+19 JUN 2007 /
+
+GRID
+PORO
+    1000*0.1 /
+PERMX
+    1000*1 /
+PERMY
+    1000*0.1 /
+PERMZ
+    1000*0.01 /
+
+SCHEDULE
+
+WELSPECS
+  'P1' 'G1' 1 1 1* 'OIL' /
+/
+
+COMPDAT
+  'P1' 1 1 1 2 'OPEN' /
+/
+
+DATES             -- 1
+ 10 JUL 2007 /
+/
+
+WELSPECS
+  'P3' 'G2' 3 3 1* 'OIL' /
+/
+
+COMPDAT
+  'P3' 3 3 1 3 'OPEN' /
+/
+
+DATES             -- 3
+ 10 AUG 2007 /
+ 10 SEP 2007 /
+/
+)");
+
+    const Opm::EclipseGrid grid(10, 10, 10);
+    const Opm::TableManager table (deck);
+    const Opm::FieldPropsManager fp(deck, Opm::Phases{true, true, true}, grid, table);
+    const Opm::Runspec runspec (deck);
+
+    const auto python = std::make_shared<Opm::Python>();
+    const auto eager = Opm::Schedule { deck, grid, fp, runspec, python };
+
+    auto parseContext = Opm::ParseContext{};
+    parseContext.setLazyScheduleLoading(true);
+    auto errors = Opm::ErrorGuard{};
+    auto lazy = Opm::Schedule { deck, grid, fp, runspec, parseContext, errors, python };
+    BOOST_CHECK_EQUAL(lazy.getWells(0).size(), std::size_t{1});
+
+    Opm::Serialization::MemPacker packer;
+    Opm::Serializer serializer(packer);
+    serializer.pack(lazy);
+    BOOST_CHECK_EQUAL(lazy.numLoadedSteps(), std::size_t{1});
+
+    auto copy = Opm::Schedule{};
+    serializer.unpack(copy);
+
+    // The remaining report steps are loaded from the serialized deck.
+    BOOST_CHECK_EQUAL(copy.size(), eager.size());
+    BOOST_CHECK_EQUAL(copy.numLoadedSteps(), std::size_t{1});
+    BOOST_CHECK_EQUAL(copy.getWell("P3", 3).getConnections().size(), std::size_t{3});
+    for (std::size_t report_step = 0; report_step < eager.size(); ++report_step) {
+        BOOST_CHECK_MESSAGE(copy[report_step] == eager[report_step],
+                            "Report step " << report_step << " of deserialized lazy Schedule "
+                            "must equal eagerly loaded report step");
+    }
+    BOOST_CHECK_EQUAL(copy.numLoadedSteps(), copy.size());
+}
 
 bool init_unit_test_func()
 {
@@ -60,6 +60,7 @@
 #include <ctime>
 #include <exception>
 #include <filesystem>
+#include <fstream>
 #include <map>
 #include <memory>
 #include <sstream>
@@ -72,6 +73,10 @@
 
 #include <fmt/format.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace Opm;
 using rt = data::Rates::opt;
 using p_cmode = Opm::Group::ProductionCMode;
@@ -2832,6 +2837,77 @@ BOOST_AUTO_TEST_CASE(Test_SummaryState) {
     BOOST_CHECK_EQUAL(st.get_conn_var("OP2", "COPR", 101, 99), 99);
 }
 
+BOOST_AUTO_TEST_CASE(parallel_evaluation_is_deterministic)
+{
+    // Request BSWAT in every cell of the 10x10x10 grid, such that there
+    // are enough block parameters for them to be evaluated concurrently.
+    const auto deck = [] {
+        std::ifstream is("summary_deck.DATA");
+        std::stringstream buffer;
+        buffer << is.rdbuf();
+        auto deck_string = buffer.str();
+
+        auto bswat = std::string{"BSWAT\n"};
+        for (int k = 1; k <= 10; ++k)
+            for (int j = 1; j <= 10; ++j)
+                for (int i = 1; i <= 10; ++i)
+                    bswat += fmt::format(" {} {} {} /\n", i, j, k);
+        bswat += "/\n";
+
+        const auto pos = deck_string.find("\nSUMMARY\n");
+        BOOST_REQUIRE(pos != std::string::npos);
+        deck_string.insert(pos + std::string{"\nSUMMARY\n"}.size(), bswat);
+
+        return Parser{}.parseString(deck_string);
+    }();
+
+    const EclipseState es { deck };
+    const Schedule schedule { deck, es, std::make_shared<Python>() };
+    const SummaryConfig config { deck, schedule, es.fieldProps(), es.aquifer() };
+    const auto wells = result_wells();
+    const auto grp_nwrk = result_group_nwrk();
+
+    out::Summary::BlockValues block_values;
+    for (int cell = 1; cell <= 1000; ++cell)
+        block_values[std::make_pair("BSWAT", cell)] = 0.001 * cell;
+
+    WorkArea ta { "summary_test" };
+
+    auto evaluate = [&](const int num_threads)
+    {
+#ifdef _OPENMP
+        omp_set_num_threads(num_threads);
+#else
+        static_cast<void>(num_threads);
+#endif
+
+        SummaryState st(std::time_t{0});
+        out::Summary writer(es, config, es.getInputGrid(), schedule, "PARALLEL");
+        for (int step = 0; step < 3; ++step)
+            writer.eval(st, step, step * day, wells, {}, grp_nwrk, {}, {}, {}, {}, block_values);
+
+        return st;
+    };
+
+#ifdef _OPENMP
+    const auto max_threads = omp_get_max_threads();
+#endif
+
+    const auto reference = evaluate(1);
+    BOOST_CHECK_GT(reference.size(), std::size_t{1000});
+    BOOST_CHECK_CLOSE(reference.get("BSWAT:1"), 0.001, 1.0e-8);
+
+    for (const int num_threads : { 2, 3, 4, 8 }) {
+        BOOST_CHECK_MESSAGE(evaluate(num_threads) == reference,
+                            "Summary state differs when evaluated with "
+                            << num_threads << " threads");
+    }
+
+#ifdef _OPENMP
+    omp_set_num_threads(max_threads);
+#endif
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Summary
 
 // ####################################################################
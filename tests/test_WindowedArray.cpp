@@ -155,4 +155,35 @@ BOOST_AUTO_TEST_CASE(Matrix)
     }
 }
 
+// ====================================================================
+
+BOOST_AUTO_TEST_CASE(Reset)
+{
+    using Wa = Opm::RestartIO::Helpers::WindowedArray<int>;
+    using Wm = Opm::RestartIO::Helpers::WindowedMatrix<int>;
+
+    auto wa = Wa{ Wa::NumWindows{ 5 }, Wa::WindowSize{ 7 } };
+    std::fill(std::begin(wa[2]), std::end(wa[2]), 42);
+
+    wa.reset(Wa::NumWindows{ 3 }, Wa::WindowSize{ 4 });
+
+    BOOST_CHECK_EQUAL(wa.numWindows(), Wa::Idx{3});
+    BOOST_CHECK_EQUAL(wa.windowSize(), Wa::Idx{4});
+    BOOST_CHECK(wa.data() == std::vector<int>(3 * 4, 0));
+
+    BOOST_CHECK_THROW(wa.reset(Wa::NumWindows{ 3 }, Wa::WindowSize{ 0 }), std::invalid_argument);
+
+    auto wm = Wm{ Wm::NumRows{ 3 }, Wm::NumCols{ 2 }, Wm::WindowSize{ 4 } };
+    std::fill(std::begin(wm(1, 1)), std::end(wm(1, 1)), 17);
+
+    wm.reset(Wm::NumRows{ 2 }, Wm::NumCols{ 3 }, Wm::WindowSize{ 2 });
+
+    BOOST_CHECK_EQUAL(wm.numRows(), Wm::Idx{2});
+    BOOST_CHECK_EQUAL(wm.numCols(), Wm::Idx{3});
+    BOOST_CHECK_EQUAL(wm.windowSize(), Wm::Idx{2});
+    BOOST_CHECK(wm.data() == std::vector<int>(2 * 3 * 2, 0));
+
+    BOOST_CHECK_THROW(wm.reset(Wm::NumRows{ 2 }, Wm::NumCols{ 0 }, Wm::WindowSize{ 2 }), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END ()
@@ -23,10 +23,13 @@
 
 #include <opm/output/data/InterRegFlowMap.hpp>
 
+#include <cstddef>
 #include <optional>
 #include <stdexcept>
+#include <thread>
 #include <utility>
 #include <tuple>
+#include <vector>
 
 #include "tests/MessageBuffer.cpp"
 
@@ -975,4 +978,178 @@ BOOST_AUTO_TEST_CASE(LinearBuffer_ManyReadWrite)
     }
 }
 
+namespace {
+    Opm::data::InterRegFlowMap::FlowRates scaled(Opm::data::InterRegFlowMap::FlowRates rate,
+                                                 const float factor)
+    {
+        using Component = Opm::data::InterRegFlowMap::Component;
+
+        for (const auto comp : { Component::Oil, Component::Gas, Component::Water,
+                                 Component::Disgas, Component::Vapoil })
+        {
+            rate[comp] *= factor;
+        }
+
+        return rate;
+    }
+
+    void checkSameFlows(const Opm::data::InterRegFlowMap& map1,
+                        const Opm::data::InterRegFlowMap& map2,
+                        const int                         numRegions)
+    {
+        using Component = Opm::data::InterRegFlowMap::ReadOnlyWindow::Component;
+        using Direction = Opm::data::InterRegFlowMap::ReadOnlyWindow::Direction;
+
+        BOOST_CHECK_EQUAL(map1.numRegions(), map2.numRegions());
+
+        for (auto r1 = 0; r1 < numRegions; ++r1) {
+            for (auto r2 = 0; r2 < numRegions; ++r2) {
+                if (r1 == r2) {
+                    continue;
+                }
+
+                const auto flows1 = map1.getInterRegFlows(r1, r2);
+                const auto flows2 = map2.getInterRegFlows(r1, r2);
+
+                BOOST_REQUIRE_EQUAL(flows1.has_value(), flows2.has_value());
+                if (! flows1.has_value()) {
+                    continue;
+                }
+
+                BOOST_CHECK_EQUAL(flows1->second, flows2->second);
+
+                for (const auto comp : { Component::Oil, Component::Gas, Component::Water,
+                                         Component::Disgas, Component::Vapoil })
+                {
+                    for (const auto dir : { Direction::Positive, Direction::Negative }) {
+                        BOOST_CHECK_EQUAL(flows1->first.flow(comp, dir),
+                                          flows2->first.flow(comp, dir));
+                    }
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Concurrent_Accumulation)
+{
+    const auto numRegions = 5;
+    const auto numThreads = std::size_t{4};
+    const auto numConnPerThread = 1000;
+
+    const auto rates = std::vector {
+        conn_1(), conn_2(), conn_3(),
+    };
+
+    auto connection = [&rates](const std::size_t thread, const int conn)
+    {
+        const auto r1 = static_cast<int>((thread + conn) % numRegions);
+        const auto r2 = static_cast<int>((3*thread + 2*conn + 1) % numRegions);
+
+        return std::tuple { r1, r2, scaled(rates[conn % 3], 1.0f + thread) };
+    };
+
+    auto concurrent = Opm::data::InterRegFlowMap{};
+    concurrent.prepareConcurrentAccumulation(numThreads);
+
+    BOOST_CHECK_THROW(concurrent.addConnection(0, 1, conn_1(), numThreads),
+                      std::invalid_argument);
+
+    {
+        auto threads = std::vector<std::thread>{};
+        for (auto thread = 0*numThreads; thread < numThreads; ++thread) {
+            threads.emplace_back([&concurrent, &connection, thread]()
+            {
+                for (auto conn = 0; conn < numConnPerThread; ++conn) {
+                    const auto& [r1, r2, rate] = connection(thread, conn);
+                    concurrent.addConnection(r1, r2, rate, thread);
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    concurrent.compress(numRegions);
+
+    // Partial contributions are merged in order of thread index.
+    auto serial = Opm::data::InterRegFlowMap{};
+    for (auto thread = 0*numThreads; thread < numThreads; ++thread) {
+        for (auto conn = 0; conn < numConnPerThread; ++conn) {
+            const auto& [r1, r2, rate] = connection(thread, conn);
+            serial.addConnection(r1, r2, rate);
+        }
+    }
+
+    serial.compress(numRegions);
+
+    checkSameFlows(concurrent, serial, numRegions);
+}
+
+BOOST_AUTO_TEST_CASE(Reuse_Previous_Structure)
+{
+    const auto numRegions = 4;
+
+    auto addStep = [](Opm::data::InterRegFlowMap& flowMap, const float factor)
+    {
+        flowMap.addConnection(0, 1, scaled(conn_1(), factor));
+        flowMap.addConnection(2, 1, scaled(conn_2(), factor));
+        flowMap.addConnection(1, 0, scaled(conn_3(), factor));
+        flowMap.addConnection(3, 2, scaled(conn_1(), factor));
+        flowMap.addConnection(0, 3, scaled(conn_2(), factor));
+    };
+
+    auto flowMap = Opm::data::InterRegFlowMap{};
+    addStep(flowMap, 1.0f);
+    flowMap.compress(numRegions);
+
+    for (const auto factor : { 2.0f, -0.5f }) {
+        flowMap.clear();
+        BOOST_CHECK_EQUAL(flowMap.numRegions(), 0);
+
+        addStep(flowMap, factor);
+        flowMap.compress(numRegions);
+
+        auto expect = Opm::data::InterRegFlowMap{};
+        addStep(expect, factor);
+        expect.compress(numRegions);
+
+        checkSameFlows(flowMap, expect, numRegions);
+    }
+
+    // Subset of previous connections.  Must not report flows for the
+    // connections that are no longer present.
+    flowMap.clear();
+    flowMap.addConnection(0, 1, conn_1());
+    flowMap.compress(numRegions);
+
+    BOOST_CHECK_MESSAGE(! flowMap.getInterRegFlows(2, 1).has_value(),
+                        "Connection from previous structure must NOT have a value");
+
+    // Superset of previous connections.
+    flowMap.clear();
+    addStep(flowMap, 1.0f);
+    flowMap.addConnection(1, 3, conn_3());
+    flowMap.compress(numRegions);
+
+    {
+        auto expect = Opm::data::InterRegFlowMap{};
+        addStep(expect, 1.0f);
+        expect.addConnection(1, 3, conn_3());
+        expect.compress(numRegions);
+
+        checkSameFlows(flowMap, expect, numRegions);
+    }
+
+    // Different number of regions.
+    flowMap.clear();
+    addStep(flowMap, 1.0f);
+    flowMap.addConnection(1, 3, conn_3());
+    flowMap.compress(numRegions + 1);
+
+    BOOST_CHECK_EQUAL(flowMap.numRegions(), numRegions + 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // InterRegMap
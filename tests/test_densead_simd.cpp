@@ -0,0 +1,242 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Tests for evaluations which use SIMD packs as their value type.
+ *
+ * Every operation on a packed evaluation must yield, in each lane, the same value and
+ * derivatives as the corresponding operation on a scalar evaluation.
+ */
+#include "config.h"
+
+#define BOOST_TEST_MODULE DenseAdSimdTests
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/densead/SimdPack.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityWaterPvt.hpp>
+
+#include <limits>
+
+#include <array>
+#include <string>
+#include <type_traits>
+
+namespace {
+
+template <class Scalar, int width, int numVars>
+struct Config
+{
+    using ScalarEval = Opm::DenseAd::Evaluation<Scalar, numVars>;
+    using Pack = Opm::DenseAd::SimdPack<Scalar, width>;
+    using PackEval = Opm::DenseAd::Evaluation<Pack, numVars>;
+
+    static constexpr Scalar tolerance()
+    { return std::is_same<Scalar, float>::value ? 1e-5 : 1e-12; }
+
+    // an evaluation which depends on the first two variables with a different value
+    // and different derivatives in each lane
+    static ScalarEval laneInput(int laneIdx, Scalar offset)
+    {
+        ScalarEval result = ScalarEval::createVariable(offset + 0.25*laneIdx, 0);
+        result.setDerivative(1, 0.5 - 0.125*laneIdx);
+        return result;
+    }
+
+    static PackEval packInput(Scalar offset)
+    {
+        PackEval result;
+        for (int laneIdx = 0; laneIdx < width; ++laneIdx)
+            Opm::DenseAd::insertLane(result, laneIdx, laneInput(laneIdx, offset));
+        return result;
+    }
+
+    template <class PackFn, class ScalarFn>
+    static void checkLanes(const std::string& name, PackFn&& packFn, ScalarFn&& scalarFn)
+    {
+        const auto packResult = packFn();
+        for (int laneIdx = 0; laneIdx < width; ++laneIdx) {
+            const auto expected = scalarFn(laneIdx);
+            const auto actual = Opm::DenseAd::extractLane(packResult, laneIdx);
+            BOOST_CHECK_MESSAGE(Opm::MathToolbox<ScalarEval>::isSame(actual, expected, tolerance()),
+                                name << " differs in lane " << laneIdx
+                                << ": " << actual << " != " << expected);
+        }
+    }
+};
+
+using Configs = boost::mpl::list<Config<double, 4, 3>,
+                                 Config<double, 4, 24>,
+                                 Config<float, 8, 3>,
+                                 Config<double, 2, 2>>;
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(PackBasics)
+{
+    using Pack = Opm::DenseAd::SimdPack<double, 4>;
+
+    Pack a(2.0);
+    Pack b;
+    for (int i = 0; i < Pack::size(); ++i)
+        b[i] = i;
+
+    const Pack c = (a + b)*3.0 - 1.0/a;
+    for (int i = 0; i < Pack::size(); ++i)
+        BOOST_CHECK_CLOSE(c[i], (2.0 + i)*3.0 - 0.5, 1e-12);
+
+    const auto mask = b < a;
+    BOOST_CHECK(mask.any());
+    BOOST_CHECK(!mask.all());
+    BOOST_CHECK(mask[0] && mask[1] && !mask[2] && !mask[3]);
+
+    const Pack d = Opm::DenseAd::select(mask, a, b);
+    BOOST_CHECK_EQUAL(d[0], 2.0);
+    BOOST_CHECK_EQUAL(d[1], 2.0);
+    BOOST_CHECK_EQUAL(d[2], 2.0);
+    BOOST_CHECK_EQUAL(d[3], 3.0);
+
+    // isfinite() and isnan() hold iff they hold for all lanes
+    using Toolbox = Opm::MathToolbox<Pack>;
+    Pack e = a;
+    e[1] = std::numeric_limits<double>::quiet_NaN();
+    BOOST_CHECK(!Toolbox::isfinite(e));
+    BOOST_CHECK(!Toolbox::isnan(e));
+    BOOST_CHECK(Toolbox::isnan(Pack(std::numeric_limits<double>::quiet_NaN())));
+    BOOST_CHECK(Toolbox::isfinite(a));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Arithmetic, Cfg, Configs)
+{
+    const auto x = Cfg::packInput(1.5);
+    const auto y = Cfg::packInput(0.75);
+    const auto xs = [](int lane) { return Cfg::laneInput(lane, 1.5); };
+    const auto ys = [](int lane) { return Cfg::laneInput(lane, 0.75); };
+
+    Cfg::checkLanes("x + y", [&]() { return x + y; }, [&](int l) { return xs(l) + ys(l); });
+    Cfg::checkLanes("x - y", [&]() { return x - y; }, [&](int l) { return xs(l) - ys(l); });
+    Cfg::checkLanes("x * y", [&]() { return x * y; }, [&](int l) { return xs(l) * ys(l); });
+    Cfg::checkLanes("x / y", [&]() { return x / y; }, [&](int l) { return xs(l) / ys(l); });
+    Cfg::checkLanes("2 / x", [&]() { return 2.0 / x; }, [&](int l) { return 2.0 / xs(l); });
+    Cfg::checkLanes("x * 3 - 1", [&]() { return x*3.0 - 1.0; }, [&](int l) { return xs(l)*3.0 - 1.0; });
+    Cfg::checkLanes("-x", [&]() { return -x; }, [&](int l) { return -xs(l); });
+
+    auto z = x;
+    z *= y;
+    z /= x + 1.0;
+    z += 0.5;
+    Cfg::checkLanes("compound", [&]() { return z; },
+                    [&](int l) { auto zs = xs(l); zs *= ys(l); zs /= xs(l) + 1.0; zs += 0.5; return zs; });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Functions, Cfg, Configs)
+{
+    const auto x = Cfg::packInput(1.5);
+    const auto y = Cfg::packInput(0.75);
+    const auto xs = [](int lane) { return Cfg::laneInput(lane, 1.5); };
+    const auto ys = [](int lane) { return Cfg::laneInput(lane, 0.75); };
+
+    Cfg::checkLanes("exp", [&]() { return Opm::exp(x); }, [&](int l) { return Opm::exp(xs(l)); });
+    Cfg::checkLanes("log", [&]() { return Opm::log(x); }, [&](int l) { return Opm::log(xs(l)); });
+    Cfg::checkLanes("sqrt", [&]() { return Opm::sqrt(x); }, [&](int l) { return Opm::sqrt(xs(l)); });
+    Cfg::checkLanes("pow(x, 2.5)", [&]() { return Opm::pow(x, 2.5); },
+                    [&](int l) { return Opm::pow(xs(l), 2.5); });
+    Cfg::checkLanes("pow(2.5, x)", [&]() { return Opm::pow(2.5, x); },
+                    [&](int l) { return Opm::pow(2.5, xs(l)); });
+    Cfg::checkLanes("pow(x, y)", [&]() { return Opm::pow(x, y); },
+                    [&](int l) { return Opm::pow(xs(l), ys(l)); });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Branching, Cfg, Configs)
+{
+    // the offsets are chosen such that the comparisons differ between lanes
+    const auto x = Cfg::packInput(-0.3);
+    const auto y = 0.5 - Cfg::packInput(-0.3);
+    const auto xs = [](int lane) { return Cfg::laneInput(lane, -0.3); };
+    const auto ys = [](int lane) { return 0.5 - Cfg::laneInput(lane, -0.3); };
+
+    Cfg::checkLanes("abs", [&]() { return Opm::abs(x); }, [&](int l) { return Opm::abs(xs(l)); });
+    Cfg::checkLanes("min", [&]() { return Opm::min(x, y); }, [&](int l) { return Opm::min(xs(l), ys(l)); });
+    Cfg::checkLanes("max", [&]() { return Opm::max(x, y); }, [&](int l) { return Opm::max(xs(l), ys(l)); });
+    Cfg::checkLanes("min(x, 0.1)", [&]() { return Opm::min(x, 0.1); },
+                    [&](int l) { return Opm::min(xs(l), 0.1); });
+    Cfg::checkLanes("max(0.1, x)", [&]() { return Opm::max(0.1, x); },
+                    [&](int l) { return Opm::max(0.1, xs(l)); });
+    Cfg::checkLanes("select",
+                    [&]() { return Opm::DenseAd::select(x.value() > y.value(), x*x, y); },
+                    [&](int l) { return (xs(l) > ys(l)) ? xs(l)*xs(l) : ys(l); });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ZeroBasePower, Cfg, Configs)
+{
+    // lane 0 has a zero base, the remaining ones do not
+    auto x = Cfg::packInput(0.0);
+    const auto xs = [](int lane) { return Cfg::laneInput(lane, 0.0); };
+
+    Cfg::checkLanes("pow(0, 2)", [&]() { return Opm::pow(x, 2.0); },
+                    [&](int l) { return Opm::pow(xs(l), 2.0); });
+    Cfg::checkLanes("pow(x, x)", [&]() { return Opm::pow(x, x + 1.0); },
+                    [&](int l) { return Opm::pow(xs(l), xs(l) + 1.0); });
+
+    using Toolbox = Opm::MathToolbox<typename Cfg::PackEval>;
+    BOOST_CHECK(Toolbox::isfinite(Opm::pow(x, 2.0)));
+    BOOST_CHECK(!Toolbox::isfinite(Opm::log(x)));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(WaterPvt, Cfg, Configs)
+{
+    using Scalar = typename Cfg::ScalarEval::ValueType;
+    using ScalarEval = typename Cfg::ScalarEval;
+    using PackEval = typename Cfg::PackEval;
+
+    Opm::ConstantCompressibilityWaterPvt<Scalar> pvt;
+    pvt.setNumRegions(1);
+    pvt.setReferencePressure(0, 2.0e7);
+    pvt.setReferenceFormationVolumeFactor(0, 1.03);
+    pvt.setCompressibility(0, 4.5e-10);
+    pvt.setViscosity(0, 3.0e-4, 1.0e-9);
+    pvt.initEnd();
+
+    // each lane is a cell with a different pressure
+    const auto pressure = [](int lane) { return ScalarEval::createVariable(1.0e7 + 5.0e6*lane, 0); };
+    PackEval packPressure;
+    for (int laneIdx = 0; laneIdx < Cfg::Pack::size(); ++laneIdx)
+        Opm::DenseAd::insertLane(packPressure, laneIdx, pressure(laneIdx));
+    const PackEval packTemperature(Scalar(300.0));
+    const PackEval packZero(Scalar(0.0));
+    const ScalarEval temperature(Scalar(300.0));
+    const ScalarEval zero(Scalar(0.0));
+
+    Cfg::checkLanes("inverseFormationVolumeFactor",
+                    [&]() { return pvt.inverseFormationVolumeFactor(0, packTemperature, packPressure,
+                                                                    packZero, packZero); },
+                    [&](int l) { return pvt.inverseFormationVolumeFactor(0, temperature, pressure(l),
+                                                                         zero, zero); });
+    Cfg::checkLanes("viscosity",
+                    [&]() { return pvt.viscosity(0, packTemperature, packPressure, packZero, packZero); },
+                    [&](int l) { return pvt.viscosity(0, temperature, pressure(l), zero, zero); });
+}